@@ -11,4 +11,5 @@
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_impl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_local_segments.hpp>
 
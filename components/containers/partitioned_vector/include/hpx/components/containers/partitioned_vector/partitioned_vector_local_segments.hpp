@@ -0,0 +1,73 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_local_segments.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_segmented_iterator.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace hpx {
+
+    /// Return the partitions of the given partitioned_vector which are
+    /// located on the calling locality. Each partition is exposed as a
+    /// contiguous range of elements, which allows to apply the (vectorized)
+    /// algorithms directly to the local data without going through the
+    /// segmented iterators.
+    ///
+    /// \note The returned ranges are invalidated if the partitioned_vector
+    ///       is resized or destroyed.
+    template <typename T, typename Data>
+    std::vector<hpx::ranges::subrange_t<T*>> local_segments(
+        hpx::partitioned_vector<T, Data>& v)
+    {
+        static_assert(
+            hpx::traits::detail::is_contiguous_partition<T, Data>::value,
+            "local_segments requires the partitions to store their "
+            "elements contiguously");
+
+        std::uint32_t const this_locality = hpx::get_locality_id();
+
+        std::vector<hpx::ranges::subrange_t<T*>> segments;
+        auto end = v.segment_end(this_locality);
+        for (auto it = v.segment_begin(this_locality); it != end; ++it)
+        {
+            Data& data = *it;
+            segments.emplace_back(data.data(), data.data() + data.size());
+        }
+        return segments;
+    }
+
+    /// \copydoc local_segments
+    template <typename T, typename Data>
+    std::vector<hpx::ranges::subrange_t<T const*>> local_segments(
+        hpx::partitioned_vector<T, Data> const& v)
+    {
+        static_assert(
+            hpx::traits::detail::is_contiguous_partition<T, Data>::value,
+            "local_segments requires the partitions to store their "
+            "elements contiguously");
+
+        std::uint32_t const this_locality = hpx::get_locality_id();
+
+        std::vector<hpx::ranges::subrange_t<T const*>> segments;
+        auto end = v.segment_cend(this_locality);
+        for (auto it = v.segment_cbegin(this_locality); it != end; ++it)
+        {
+            Data const& data = *it;
+            segments.emplace_back(data.data(), data.data() + data.size());
+        }
+        return segments;
+    }
+}    // namespace hpx
@@ -1225,6 +1225,72 @@ namespace hpx { namespace traits {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        // The elements of a partition are stored contiguously if the
+        // underlying data type does so (and does not hand out proxies).
+        template <typename T, typename Data>
+        struct is_contiguous_partition
+          : std::integral_constant<bool,
+                is_contiguous_iterator_v<typename Data::iterator> &&
+                    std::is_same<T&, typename Data::reference>::value>
+        {
+        };
+    }    // namespace detail
+
+    // The local algorithms can be invoked on plain pointers referring to the
+    // elements of a partition located on the calling locality.
+    template <typename T, typename Data>
+    struct segmented_local_pointer_traits<
+        segmented::local_vector_iterator<T, Data>>
+    {
+        typedef typename detail::is_contiguous_partition<T, Data>::type
+            is_contiguous;
+
+        typedef T* pointer;
+
+        static pointer local(segmented::local_vector_iterator<T, Data> it)
+        {
+            return it.get_data()->get_data().data() + it.get_local_index();
+        }
+    };
+
+    template <typename T, typename Data>
+    struct segmented_local_pointer_traits<
+        segmented::const_local_vector_iterator<T, Data>>
+    {
+        typedef typename detail::is_contiguous_partition<T, Data>::type
+            is_contiguous;
+
+        typedef T const* pointer;
+
+        static pointer local(segmented::const_local_vector_iterator<T, Data> it)
+        {
+            return it.get_data()->get_data().data() + it.get_local_index();
+        }
+    };
+
+    // The raw local iterators refer to the elements of the partition, which
+    // allows for copy operations to be turned into a memmove.
+    template <typename T, typename Data, typename BaseIter>
+    struct is_contiguous_iterator<
+        segmented::local_raw_vector_iterator<T, Data, BaseIter>, false>
+      : std::integral_constant<bool,
+            is_contiguous_iterator_v<BaseIter> &&
+                detail::is_contiguous_partition<T, Data>::value>
+    {
+    };
+
+    template <typename T, typename Data, typename BaseIter>
+    struct is_contiguous_iterator<
+        segmented::const_local_raw_vector_iterator<T, Data, BaseIter>, false>
+      : std::integral_constant<bool,
+            is_contiguous_iterator_v<BaseIter> &&
+                detail::is_contiguous_partition<T, Data>::value>
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Data>
     struct is_value_proxy<
@@ -0,0 +1,108 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_local_segments.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/find_all_localities.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct increment
+{
+    void operator()(int& val) const
+    {
+        ++val;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+template <typename ExPolicy>
+void test_local_segments(ExPolicy&& policy, hpx::partitioned_vector<int>& v)
+{
+    std::uint32_t const here = hpx::get_locality_id();
+
+    // the local segments cover all elements stored on this locality
+    std::size_t count = 0;
+    for (auto const& segment : hpx::local_segments(v))
+    {
+        hpx::for_each(policy, segment.begin(), segment.end(), increment());
+        count += segment.size();
+    }
+
+    std::size_t expected = 0;
+    for (auto it = v.segment_begin(here); it != v.segment_end(here); ++it)
+    {
+        expected += it->size();
+    }
+    HPX_TEST_EQ(count, expected);
+
+    // the local data has been modified in place
+    hpx::partitioned_vector<int> const& cv = v;
+    for (auto const& segment : hpx::local_segments(cv))
+    {
+        for (int val : segment)
+        {
+            HPX_TEST_EQ(val, 43);
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_segmented_algorithms(
+    ExPolicy&& policy, hpx::partitioned_vector<int>& v)
+{
+    // these are executed on the local segments through plain pointers
+    hpx::fill(policy, v.begin(), v.end(), 1);
+    hpx::for_each(policy, v.begin(), v.end(), increment());
+
+    int sum = hpx::reduce(policy, v.begin(), v.end(), 0, std::plus<int>());
+    HPX_TEST_EQ(std::size_t(sum), 2 * v.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    {
+        hpx::partitioned_vector<int> v(
+            1007, 42, hpx::container_layout(3 * localities.size(), localities));
+
+        test_local_segments(hpx::execution::seq, v);
+
+        hpx::fill(hpx::execution::par, v.begin(), v.end(), 42);
+        test_local_segments(hpx::execution::par, v);
+
+        hpx::fill(hpx::execution::par, v.begin(), v.end(), 42);
+        test_local_segments(hpx::execution::par_unseq, v);
+
+        test_segmented_algorithms(hpx::execution::seq, v);
+        test_segmented_algorithms(hpx::execution::par, v);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -14,16 +14,20 @@
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/iostreams/manipulators.hpp>
 #include <hpx/components/iostreams/server/output_stream.hpp>
+#include <hpx/components_base/agas_interface.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/async_distributed.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <boost/iostreams/stream.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <ios>
 #include <iterator>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <sstream>
@@ -148,6 +152,16 @@ namespace hpx { namespace iostreams
             release_ostream(get_outstream_name(tag), id);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Return the minimal amount of output (in bytes) to collect before it
+        // is sent to the console, zero if output is not aggregated (see
+        // hpx.iostreams.aggregate).
+        HPX_IOSTREAMS_EXPORT std::size_t get_aggregate_size();
+
+        // Return the time (in milliseconds) after which aggregated output is
+        // sent to the console regardless of its size.
+        HPX_IOSTREAMS_EXPORT std::int64_t get_aggregate_interval();
+
         ///////////////////////////////////////////////////////////////////////
         void register_ostreams();
         void unregister_ostreams();
@@ -177,6 +191,18 @@ namespace hpx { namespace iostreams
         using detail::buffer::mtx_;
         std::atomic<std::uint64_t> generational_count_;
 
+        // Output is aggregated on remote localities if requested. It is sent
+        // to the console only once aggregate_size_ bytes were collected or
+        // when the timer fires, synchronous flushes are sent right away.
+        std::size_t aggregate_size_;
+        std::unique_ptr<util::interval_timer> aggregate_timer_;
+
+        bool aggregate_locked() const
+        {
+            return aggregate_size_ != 0 &&
+                this->detail::buffer::size_locked() < aggregate_size_;
+        }
+
         // Performs a lazy streaming operation.
         template <typename T>
         ostream& streaming_operator_lazy(T const& subject)
@@ -196,7 +222,7 @@ namespace hpx { namespace iostreams
 
             // If the buffer isn't empty, send it asynchronously to the
             // destination.
-            if (!this->detail::buffer::empty_locked())
+            if (!this->detail::buffer::empty_locked() && !aggregate_locked())
             {
                 // Create the next buffer, returns the previous buffer
                 buffer next = this->detail::buffer::init_locked();
@@ -252,11 +278,12 @@ namespace hpx { namespace iostreams
         ///////////////////////////////////////////////////////////////////////
         friend struct detail::buffer_sink<char>;
 
-        bool flush()
+        bool flush(bool force = false)
         {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
             std::unique_lock<mutex_type> l(*mtx_);
-            if (!this->detail::buffer::empty_locked())
+            if (!this->detail::buffer::empty_locked() &&
+                (force || !aggregate_locked()))
             {
                 // Create the next buffer, returns the previous buffer
                 buffer next = this->detail::buffer::init_locked();
@@ -292,12 +319,30 @@ namespace hpx { namespace iostreams
         void initialize(Tag tag)
         {
             *static_cast<base_type*>(this) = detail::create_ostream(tag);
+
+            if (!agas::is_console())
+            {
+                aggregate_size_ = detail::get_aggregate_size();
+                if (aggregate_size_ != 0)
+                {
+                    // the timer is stopped during pre-shutdown, all pending
+                    // output is sent by uninitialize
+                    aggregate_timer_ = std::make_unique<util::interval_timer>(
+                        [this]() { return flush(true); },
+                        detail::get_aggregate_interval() * 1000,
+                        "hpx::iostreams::ostream::flush", true);
+                    aggregate_timer_->start(false);
+                }
+            }
         }
 
         // reset this object during runtime system shutdown
         template <typename Tag>
         void uninitialize(Tag tag)
         {
+            aggregate_timer_.reset();
+            aggregate_size_ = 0;
+
             std::unique_lock<mutex_type> l(*mtx_, std::try_to_lock);
             if (l)
             {
@@ -315,6 +360,7 @@ namespace hpx { namespace iostreams
           , buffer()
           , stream_base_type(*this)
           , generational_count_(0)
+          , aggregate_size_(0)
         {}
 
         // hpx::flush manipulator
@@ -13,6 +13,7 @@
 #include <hpx/components/iostreams/export_definitions.hpp>
 #include <hpx/components/iostreams/write_functions.hpp>
 
+#include <cstddef>
 #include <iosfwd>
 #include <memory>
 #include <mutex>
@@ -75,6 +76,27 @@ namespace hpx { namespace iostreams { namespace detail {
             return !data_.get() || data_->empty();
         }
 
+        std::size_t size_locked() const
+        {
+            return data_.get() ? data_->size() : 0;
+        }
+
+        // Append the content of the given buffer to this one.
+        void append(buffer const& rhs)
+        {
+            std::lock_guard<mutex_type> l(*mtx_);
+            std::lock_guard<mutex_type> rl(*rhs.mtx_);
+            if (rhs.data_.get() && !rhs.data_->empty())
+            {
+                if (!data_.get())
+                {
+                    data_ = std::make_shared<std::vector<char>>();
+                }
+                data_->insert(
+                    data_->end(), rhs.data_->begin(), rhs.data_->end());
+            }
+        }
+
         buffer init()
         {
             std::lock_guard<mutex_type> l(*mtx_);
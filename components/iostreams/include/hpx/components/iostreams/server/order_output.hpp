@@ -36,28 +36,41 @@ namespace hpx { namespace iostreams { namespace detail
             if (count == data.first)
             {
                 // this is the next expected output line
+                while (true)
                 {
-                    // output the line as requested
-                    util::unlock_guard<std::unique_lock<Mutex> > ul(l);
-                    in.write(write_f, mtx);
-                }
-                ++data.first;
+                    // coalesce all consecutive pending buffers into one
+                    // write operation, this uses a fresh buffer as the
+                    // received buffers share their data with the caller
+                    output_data_type::iterator next = data.second.find(++count);
+                    if (next != data.second.end())
+                    {
+                        detail::buffer coalesced;
+                        coalesced.append(in);
+                        do
+                        {
+                            coalesced.append((*next).second);
+                            data.second.erase(next);
+                            next = data.second.find(++count);
+                        } while (next != data.second.end());
+                        in = HPX_MOVE(coalesced);
+                    }
 
-                // print all consecutive pending buffers
-                output_data_type::iterator next = data.second.find(++count);
-                while (next != data.second.end())
-                {
-                    buffer next_in = (*next).second;
                     {
-                        // output the next line
+                        // output the lines as requested
                         util::unlock_guard<std::unique_lock<Mutex> > ul(l);
-                        next_in.write(write_f, mtx);
+                        in.write(write_f, mtx);
                     }
-                    data.second.erase(next);
+                    data.first = count;
 
-                    // find next entry in map
-                    ++data.first;
-                    next = data.second.find(++count);
+                    // more output might have arrived in the meantime
+                    next = data.second.find(count);
+                    if (next == data.second.end())
+                    {
+                        break;
+                    }
+
+                    in = (*next).second;
+                    data.second.erase(next);
                 }
             }
             else
@@ -44,7 +44,7 @@ inline write_function_type make_iterator_write_function(Iterator it)
 inline void
 std_ostream_write_function(std::vector<char> const& in, std::ostream& os)
 {
-    std::copy(in.begin(), in.end(), std::ostream_iterator<char>(os));
+    os.write(in.data(), static_cast<std::streamsize>(in.size()));
     os.flush();
 }
 
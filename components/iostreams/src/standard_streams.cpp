@@ -14,11 +14,17 @@
 #include <hpx/components_base/server/create_component.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/modules/execution.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
+#include <hpx/runtime_local/runtime_local.hpp>
+#include <hpx/util/get_entry_as.hpp>
 
 #include <hpx/components/iostreams/ostream.hpp>
 #include <hpx/components/iostreams/standard_streams.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <sstream>
@@ -74,6 +80,26 @@ namespace hpx { namespace iostreams { namespace detail
         return agas::on_symbol_namespace_event(cout_name, true);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t get_aggregate_size()
+    {
+        util::runtime_configuration const& cfg = get_runtime().get_config();
+        if (util::get_entry_as<int>(cfg, "hpx.iostreams.aggregate", 0) == 0)
+        {
+            return 0;
+        }
+        return (std::max)(std::size_t(1),
+            util::get_entry_as<std::size_t>(
+                cfg, "hpx.iostreams.aggregate_size", 65536));
+    }
+
+    std::int64_t get_aggregate_interval()
+    {
+        return (std::max)(std::int64_t(1),
+            util::get_entry_as<std::int64_t>(get_runtime().get_config(),
+                "hpx.iostreams.aggregate_interval", 100));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     void release_ostream(char const* name, naming::id_type const& /* id */)
     {
@@ -0,0 +1,91 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::string make_line(std::uint32_t locality_id, std::size_t i)
+{
+    return "locality#" + std::to_string(locality_id) + ": line " +
+        std::to_string(i) + "\n";
+}
+
+std::int64_t get_parcel_send_count()
+{
+    return hpx::get_runtime_distributed()
+        .get_parcel_handler()
+        .get_bootstrap_parcelport()
+        ->get_parcel_send_count(false);
+}
+
+// the output is aggregated on remote localities, hpx::flush sends
+// everything collected so far, returns the number of parcels sent meanwhile
+std::int64_t write_lines(std::size_t count)
+{
+    std::int64_t const sent = get_parcel_send_count();
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        hpx::consolestream << make_line(hpx::get_locality_id(), i)
+                           << std::flush;
+    }
+    hpx::consolestream << hpx::flush;
+
+    return get_parcel_send_count() - sent;
+}
+HPX_PLAIN_ACTION(write_lines, write_lines_action)
+
+int hpx_main()
+{
+    std::size_t const count = 1000;
+
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    for (hpx::id_type const& id : localities)
+    {
+        // the lines were combined into far fewer writes, sending them one
+        // by one would have required at least one parcel per line
+        std::int64_t const sent = write_lines_action()(id, count);
+        HPX_TEST_LT(sent, std::int64_t(count / 10));
+
+        // all lines arrived in order
+        std::string expected;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            expected +=
+                make_line(hpx::naming::get_locality_id_from_id(id), i);
+        }
+
+        std::string const output = hpx::get_consolestream().str();
+        HPX_TEST(output.find(expected) != std::string::npos);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.iostreams.aggregate!=1",
+        "hpx.iostreams.aggregate_size!=4096",
+        "hpx.iostreams.aggregate_interval!=10"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
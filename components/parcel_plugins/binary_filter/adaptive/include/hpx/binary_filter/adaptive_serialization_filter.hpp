@@ -0,0 +1,90 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/binary_filter/adaptive_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    // The adaptive filter decides for each archive whether compressing it is
+    // worthwhile:
+    //
+    //  - archives smaller than hpx.parcel.adaptive_compression.min_size are
+    //    sent uncompressed,
+    //  - the first hpx.parcel.adaptive_compression.sample_size bytes of larger
+    //    archives are compressed using the fastest zlib level, the archive is
+    //    sent uncompressed if this does not shrink the sample below
+    //    hpx.parcel.adaptive_compression.max_ratio,
+    //  - otherwise the zlib level is chosen such that the expected time
+    //    needed for compressing the data does not exceed the time saved
+    //    while sending it. The link bandwidth is either taken from
+    //    hpx.parcel.adaptive_compression.bandwidth (in MB/s) or estimated from
+    //    the statistics gathered by the bootstrap parcelport.
+    //
+    // The first byte of the produced data holds the zlib level used for
+    // compressing the remainder (zero if the data was stored uncompressed).
+    struct HPX_LIBRARY_EXPORT adaptive_serialization_filter
+      : public serialization::binary_filter
+    {
+        explicit adaptive_serialization_filter(bool /* compress */ = false,
+            serialization::binary_filter* /* next_filter */ = nullptr) noexcept
+          : current_(0)
+          , flushed_(false)
+        {
+        }
+
+        void load(void* dst, std::size_t dst_count);
+        void save(void const* src, std::size_t src_count);
+        bool flush(void* dst, std::size_t dst_count, std::size_t& written);
+
+        void set_max_length(std::size_t size);
+        std::size_t init_data(
+            char const* buffer, std::size_t size, std::size_t buffer_size);
+
+    private:
+        // compress (or store) the collected data into compressed_
+        void compress();
+
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive&, const unsigned int)
+        {
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(adaptive_serialization_filter);
+
+        std::vector<char> buffer_;
+        std::vector<char> compressed_;
+        std::size_t current_;
+        bool flushed_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // statistics exposed as performance counters by this plugin
+    HPX_LIBRARY_EXPORT std::int64_t get_adaptive_bytes_in(bool reset);
+    HPX_LIBRARY_EXPORT std::int64_t get_adaptive_bytes_out(bool reset);
+    HPX_LIBRARY_EXPORT std::int64_t get_adaptive_bytes_saved(bool reset);
+    HPX_LIBRARY_EXPORT std::int64_t get_adaptive_compression_time(bool reset);
+    HPX_LIBRARY_EXPORT std::int64_t get_adaptive_skipped_count(bool reset);
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,467 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/adaptive_serialization_filter.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/modules/actions.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+#include <hpx/runtime_distributed.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/parcelset/parcelhandler.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#endif
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::adaptive_serialization_filter,
+    adaptive_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // zlib levels the filter chooses from
+        constexpr int levels[] = {Z_BEST_SPEED, 6, Z_BEST_COMPRESSION};
+        constexpr std::size_t num_levels = sizeof(levels) / sizeof(levels[0]);
+
+        struct adaptive_config
+        {
+            adaptive_config()
+              : min_size_(hpx::util::from_string<std::size_t>(
+                    get_config_entry(
+                        "hpx.parcel.adaptive_compression.min_size", "1024"),
+                    1024))
+              , sample_size_(hpx::util::from_string<std::size_t>(
+                    get_config_entry(
+                        "hpx.parcel.adaptive_compression.sample_size", "4096"),
+                    4096))
+              , max_ratio_(hpx::util::from_string<double>(
+                    get_config_entry(
+                        "hpx.parcel.adaptive_compression.max_ratio", "0.9"),
+                    0.9))
+              , bandwidth_(hpx::util::from_string<double>(
+                    get_config_entry(
+                        "hpx.parcel.adaptive_compression.bandwidth", "0"),
+                    0.0))
+            {
+                sample_size_ = (std::max)(sample_size_, std::size_t(64));
+            }
+
+            std::size_t min_size_;
+            std::size_t sample_size_;
+            double max_ratio_;
+            double bandwidth_;    // MB/s, zero: estimate from parcelport
+        };
+
+        adaptive_config const& get_config()
+        {
+            static adaptive_config const config;
+            return config;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The cost of compressing data (in picoseconds per byte) and the
+        // achieved compression ratio (in per mille) for each of the levels,
+        // kept as exponentially weighted moving averages. The initial values
+        // are conservative estimates which are refined as soon as the
+        // corresponding level has been used. Concurrent updates may get lost,
+        // which is acceptable for these estimates.
+        std::atomic<std::int64_t> level_cost[num_levels] = {
+            {10000}, {30000}, {80000}};
+        std::atomic<std::int64_t> level_ratio[num_levels] = {
+            {0}, {0}, {0}};
+
+        void update_average(std::atomic<std::int64_t>& avg, std::int64_t value)
+        {
+            std::int64_t const old = avg.load(std::memory_order_relaxed);
+            avg.store(old == 0 ? value : (7 * old + value) / 8,
+                std::memory_order_relaxed);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // statistics
+        std::atomic<std::int64_t> bytes_in(0);
+        std::atomic<std::int64_t> bytes_out(0);
+        std::atomic<std::int64_t> bytes_saved(0);
+        std::atomic<std::int64_t> compression_time(0);
+        std::atomic<std::int64_t> skipped_count(0);
+
+        std::int64_t get_and_reset(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            return reset ? value.exchange(0) : value.load();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // bandwidth of the link in bytes per nanosecond, zero if unknown
+        double link_bandwidth()
+        {
+            double const configured = get_config().bandwidth_;
+            if (configured > 0)
+            {
+                return configured * 1e-3;    // MB/s -> bytes/ns
+            }
+
+#if defined(HPX_HAVE_NETWORKING)
+            runtime_distributed* rt = get_runtime_distributed_ptr();
+            if (rt != nullptr)
+            {
+                std::shared_ptr<parcelset::parcelport> pp =
+                    rt->get_parcel_handler().get_bootstrap_parcelport();
+                if (pp)
+                {
+                    std::int64_t const time = pp->get_sending_time(false);
+                    if (time > 0)
+                    {
+                        return double(pp->get_data_sent(false)) / double(time);
+                    }
+                }
+            }
+#endif
+            return 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Select the index of the level to use for data of the given size and
+        // an estimated compression ratio, -1 if compressing does not pay off.
+        int select_level(std::size_t size, double sample_ratio)
+        {
+            double const bandwidth = link_bandwidth();
+            if (bandwidth == 0)
+            {
+                // nothing is known about the link, prefer cheap compression
+                return 0;
+            }
+
+            double const base_ratio =
+                double(level_ratio[0].load(std::memory_order_relaxed)) * 1e-3;
+
+            // time (ns) needed to send the data uncompressed
+            double best_time = double(size) / bandwidth;
+            int best_level = -1;
+
+            for (std::size_t i = 0; i != num_levels; ++i)
+            {
+                double const cost =
+                    double(level_cost[i].load(std::memory_order_relaxed)) *
+                    1e-3;
+
+                // scale the sampled ratio by the relative efficiency of
+                // this level as observed so far
+                double ratio = sample_ratio;
+                std::int64_t const measured =
+                    level_ratio[i].load(std::memory_order_relaxed);
+                if (i != 0 && measured != 0 && base_ratio != 0)
+                {
+                    ratio *= double(measured) * 1e-3 / base_ratio;
+                }
+
+                double const time =
+                    double(size) * cost + double(size) * ratio / bandwidth;
+                if (time < best_time)
+                {
+                    best_time = time;
+                    best_level = static_cast<int>(i);
+                }
+            }
+            return best_level;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t get_adaptive_bytes_in(bool reset)
+    {
+        return detail::get_and_reset(detail::bytes_in, reset);
+    }
+
+    std::int64_t get_adaptive_bytes_out(bool reset)
+    {
+        return detail::get_and_reset(detail::bytes_out, reset);
+    }
+
+    std::int64_t get_adaptive_bytes_saved(bool reset)
+    {
+        return detail::get_and_reset(detail::bytes_saved, reset);
+    }
+
+    std::int64_t get_adaptive_compression_time(bool reset)
+    {
+        return detail::get_and_reset(detail::compression_time, reset);
+    }
+
+    std::int64_t get_adaptive_skipped_count(bool reset)
+    {
+        return detail::get_and_reset(detail::skipped_count, reset);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    std::size_t adaptive_serialization_filter::init_data(
+        char const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "adaptive_serialization_filter::init_data",
+                "archive data bstream is too short");
+            return 0;
+        }
+
+        buffer_.resize(buffer_size);
+
+        int const level = static_cast<unsigned char>(buffer[0]);
+        if (level == 0)
+        {
+            // the data was stored uncompressed
+            if (size - 1 < buffer_size)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "adaptive_serialization_filter::init_data",
+                    hpx::util::format("decompression failure, number of "
+                                      "bytes expected: {}, number of bytes "
+                                      "available: {}",
+                        buffer_size, size - 1));
+                return 0;
+            }
+            std::memcpy(buffer_.data(), buffer + 1, buffer_size);
+        }
+        else
+        {
+            uLongf decoded = static_cast<uLongf>(buffer_size);
+            int const result =
+                uncompress(reinterpret_cast<Bytef*>(buffer_.data()), &decoded,
+                    reinterpret_cast<Bytef const*>(buffer + 1),
+                    static_cast<uLong>(size - 1));
+            if (result != Z_OK || decoded != buffer_size)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "adaptive_serialization_filter::init_data",
+                    hpx::util::format("decompression failure, number of "
+                                      "bytes expected: {}, number of bytes "
+                                      "decoded: {}, zlib error: {}",
+                        buffer_size, decoded, result));
+                return 0;
+            }
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "adaptive_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        buffer_.insert(buffer_.end(), src_begin, src_begin + src_count);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::compress()
+    {
+        detail::adaptive_config const& config = detail::get_config();
+        std::size_t const size = buffer_.size();
+
+        hpx::chrono::high_resolution_timer timer;
+
+        int level_index = -1;
+        if (size >= config.min_size_)
+        {
+            // compress a sample of the data using the fastest level to
+            // detect incompressible payloads
+            std::size_t const sample_size = (std::min)(size,
+                config.sample_size_);
+            std::vector<Bytef> sample(compressBound(uLong(sample_size)));
+
+            uLongf sample_compressed = static_cast<uLongf>(sample.size());
+            int const result = compress2(sample.data(), &sample_compressed,
+                reinterpret_cast<Bytef const*>(buffer_.data()),
+                static_cast<uLong>(sample_size), detail::levels[0]);
+
+            double const ratio =
+                double(sample_compressed) / double(sample_size);
+            if (result == Z_OK && ratio < config.max_ratio_)
+            {
+                level_index = detail::select_level(size, ratio);
+            }
+        }
+
+        if (level_index != -1)
+        {
+            int const level = detail::levels[level_index];
+
+            std::int64_t const start = timer.elapsed_nanoseconds();
+
+            compressed_.resize(1 + compressBound(uLong(size)));
+            uLongf compressed_size =
+                static_cast<uLongf>(compressed_.size() - 1);
+            int const result =
+                compress2(reinterpret_cast<Bytef*>(compressed_.data() + 1),
+                    &compressed_size,
+                    reinterpret_cast<Bytef const*>(buffer_.data()),
+                    static_cast<uLong>(size), level);
+
+            if (result == Z_OK && compressed_size < size)
+            {
+                compressed_[0] = static_cast<char>(level);
+                compressed_.resize(1 + compressed_size);
+
+                std::int64_t const elapsed =
+                    timer.elapsed_nanoseconds() - start;
+                detail::update_average(detail::level_cost[level_index],
+                    (std::max)(std::int64_t(1),
+                        std::int64_t(1000 * elapsed / std::int64_t(size))));
+                detail::update_average(detail::level_ratio[level_index],
+                    (std::max)(std::int64_t(1),
+                        std::int64_t(1000 * compressed_size / size)));
+            }
+            else
+            {
+                level_index = -1;
+            }
+        }
+
+        if (level_index == -1)
+        {
+            // store the data uncompressed
+            compressed_.resize(1 + size);
+            compressed_[0] = 0;
+            if (size != 0)
+            {
+                std::memcpy(compressed_.data() + 1, buffer_.data(), size);
+            }
+            ++detail::skipped_count;
+        }
+
+        detail::bytes_in += static_cast<std::int64_t>(size);
+        detail::bytes_out += static_cast<std::int64_t>(compressed_.size());
+        if (compressed_.size() < size)
+        {
+            detail::bytes_saved +=
+                static_cast<std::int64_t>(size - compressed_.size());
+        }
+        detail::compression_time += timer.elapsed_nanoseconds();
+
+        current_ = 0;
+    }
+
+    bool adaptive_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        if (!flushed_)
+        {
+            compress();
+            flushed_ = true;
+        }
+
+        // copy out as much as fits, we will be called again with a larger
+        // destination buffer if needed
+        std::size_t const count =
+            (std::min)(dst_count, compressed_.size() - current_);
+        if (count != 0)
+        {
+            std::memcpy(dst, compressed_.data() + current_, count);
+        }
+
+        current_ += count;
+        written = count;
+        return current_ == compressed_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This function will be registered as a startup function for HPX below.
+    void startup()
+    {
+        namespace pc = hpx::performance_counters;
+
+        pc::install_counter_type("/compression/adaptive/count/bytes-in",
+            &get_adaptive_bytes_in,
+            "returns the number of bytes handed to the adaptive compression "
+            "filter",
+            "bytes", pc::counter_monotonically_increasing);
+        pc::install_counter_type("/compression/adaptive/count/bytes-out",
+            &get_adaptive_bytes_out,
+            "returns the number of bytes produced by the adaptive compression "
+            "filter",
+            "bytes", pc::counter_monotonically_increasing);
+        pc::install_counter_type("/compression/adaptive/count/bytes-saved",
+            &get_adaptive_bytes_saved,
+            "returns the number of bytes saved by the adaptive compression "
+            "filter",
+            "bytes", pc::counter_monotonically_increasing);
+        pc::install_counter_type("/compression/adaptive/count/skipped",
+            &get_adaptive_skipped_count,
+            "returns the number of archives the adaptive compression filter "
+            "has sent uncompressed",
+            "", pc::counter_monotonically_increasing);
+        pc::install_counter_type("/compression/adaptive/time/compression",
+            &get_adaptive_compression_time,
+            "returns the overall time spent in the adaptive compression "
+            "filter",
+            "ns", pc::counter_monotonically_increasing);
+    }
+
+    bool get_startup(
+        hpx::startup_function_type& startup_func, bool& pre_startup)
+    {
+        startup_func = startup;    // function to run during startup
+        pre_startup = true;        // run 'startup' as pre-startup function
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// types.
+HPX_REGISTER_STARTUP_MODULE_DYNAMIC(
+    hpx::plugins::compression::get_startup)
+
+#endif
@@ -66,4 +66,18 @@ namespace hpx { namespace traits {
       : segmented_local_iterator_traits<Iterator>::is_segmented_local_iterator
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // traits allowing to access the elements referenced by an iterator with a
+    // purely local representation through a plain pointer, this is possible
+    // only if the elements of the segment are stored contiguously
+    template <typename Iterator, typename Enable = void>
+    struct segmented_local_pointer_traits
+    {
+        typedef std::false_type is_contiguous;
+    };
+
+    template <typename Iterator>
+    inline constexpr bool is_segmented_local_contiguous_v =
+        segmented_local_pointer_traits<Iterator>::is_contiguous::value;
 }}    // namespace hpx::traits
@@ -222,6 +222,32 @@ namespace hpx {
         using future_or_shared_state_result_t =
             typename future_or_shared_state_result<R>::type;
 
+        ///////////////////////////////////////////////////////////////////////
+        // Return whether all futures of the given range are ready (deferred
+        // futures are executed). Waiting for such a range does not require
+        // to create a frame and to attach any continuations.
+        template <typename Range>
+        bool is_range_ready(Range const& values)
+        {
+            for (auto const& value : values)
+            {
+                auto const& state =
+                    hpx::traits::detail::get_shared_state(value);
+
+                if (state && !state->is_ready())
+                {
+                    state->execute_deferred();
+
+                    // execute_deferred might have made the future ready
+                    if (!state->is_ready())
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Tuple>
         struct wait_all_frame    //-V690
@@ -390,7 +416,7 @@ namespace hpx {
     template <typename Future>
     void wait_all_nothrow(std::vector<Future> const& values)
     {
-        if (!values.empty())
+        if (!hpx::detail::is_range_ready(values))
         {
             using result_type = hpx::tuple<std::vector<Future> const&>;
             using frame_type = hpx::detail::wait_all_frame<result_type>;
@@ -448,14 +474,17 @@ namespace hpx {
     template <typename Future, std::size_t N>
     void wait_all_nothrow(std::array<Future, N> const& values)
     {
-        using result_type = hpx::tuple<std::array<Future, N> const&>;
-        using frame_type = hpx::detail::wait_all_frame<result_type>;
+        if (!hpx::detail::is_range_ready(values))
+        {
+            using result_type = hpx::tuple<std::array<Future, N> const&>;
+            using frame_type = hpx::detail::wait_all_frame<result_type>;
 
-        result_type data(values);
+            result_type data(values);
 
-        // frame is initialized with initial reference count
-        hpx::intrusive_ptr<frame_type> frame(new frame_type(data), false);
-        frame->wait_all();
+            // frame is initialized with initial reference count
+            hpx::intrusive_ptr<frame_type> frame(new frame_type(data), false);
+            frame->wait_all();
+        }
     }
 
     template <typename Future, std::size_t N>
@@ -144,8 +144,10 @@ namespace hpx {
 #include <hpx/futures/traits/future_traits.hpp>
 #include <hpx/futures/traits/is_future.hpp>
 #include <hpx/futures/traits/is_future_range.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/pack_traversal/pack_traversal_async.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <iterator>
 #include <type_traits>
@@ -223,23 +225,108 @@ namespace hpx {
             }
         };
 
+        // Joining a single range of futures does not require to traverse the
+        // futures one after the other. The frame stores the range inline,
+        // attaches a continuation to all futures which are not ready yet at
+        // once, and becomes ready as soon as its counter drops to zero. No
+        // continuation is attached if all futures are ready already.
+        template <typename Range>
+        class async_when_all_range_frame : public future_data<Range>
+        {
+        public:
+            using result_type = Range;
+            using type = hpx::future<result_type>;
+            using base_type = hpx::lcos::detail::future_data<result_type>;
+            using init_no_addref = typename base_type::init_no_addref;
+
+            async_when_all_range_frame(
+                init_no_addref no_addref, Range&& values) noexcept
+              : base_type(no_addref)
+              , values_(HPX_MOVE(values))
+              , count_(1)
+            {
+            }
+
+            void attach()
+            {
+                for (auto& value : values_)
+                {
+                    if (!async_visit_future(value))
+                    {
+                        count_.fetch_add(1, std::memory_order_relaxed);
+
+                        hpx::intrusive_ptr<async_when_all_range_frame> this_(
+                            this);
+                        async_detach_future(value,
+                            [this_ = HPX_MOVE(this_)]() -> void {
+                                this_->on_future_ready();
+                            });
+                    }
+                }
+
+                // release the reference held while attaching continuations
+                on_future_ready();
+            }
+
+        private:
+            void on_future_ready()
+            {
+                if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                {
+                    this->set_value(HPX_MOVE(values_));
+                }
+            }
+
+            Range values_;
+            std::atomic<std::size_t> count_;
+        };
+
+        template <typename Range>
+        hpx::future<Range> when_all_range_impl(Range&& values)
+        {
+            using frame_type = async_when_all_range_frame<Range>;
+            using no_addref = typename frame_type::init_no_addref;
+
+            // frame is initialized with initial reference count
+            hpx::intrusive_ptr<frame_type> frame(
+                new frame_type(no_addref{}, HPX_MOVE(values)), false);
+            frame->attach();
+
+            return hpx::traits::future_access<
+                typename frame_type::type>::create(HPX_MOVE(frame));
+        }
+
         template <typename... T>
         typename async_when_all_frame<
             hpx::tuple<hpx::traits::acquire_future_t<T>...>>::type
         when_all_impl(T&&... args)
         {
             using result_type = hpx::tuple<hpx::traits::acquire_future_t<T>...>;
-            using frame_type = async_when_all_frame<result_type>;
-            using no_addref = typename frame_type::base_type::init_no_addref;
 
-            auto frame = hpx::util::traverse_pack_async_allocator(
-                hpx::util::internal_allocator<>{},
-                hpx::util::async_traverse_in_place_tag<frame_type>{},
-                no_addref{},
-                hpx::traits::acquire_future_disp()(HPX_FORWARD(T, args))...);
+            if constexpr (sizeof...(T) == 1 &&
+                (hpx::traits::is_future_range_v<
+                     hpx::traits::acquire_future_t<T>> &&
+                    ...))
+            {
+                return when_all_range_impl(hpx::traits::acquire_future_disp()(
+                    HPX_FORWARD(T, args))...);
+            }
+            else
+            {
+                using frame_type = async_when_all_frame<result_type>;
+                using no_addref =
+                    typename frame_type::base_type::init_no_addref;
+
+                auto frame = hpx::util::traverse_pack_async_allocator(
+                    hpx::util::internal_allocator<>{},
+                    hpx::util::async_traverse_in_place_tag<frame_type>{},
+                    no_addref{},
+                    hpx::traits::acquire_future_disp()(
+                        HPX_FORWARD(T, args))...);
 
-            return hpx::traits::future_access<
-                typename frame_type::type>::create(HPX_MOVE(frame));
+                return hpx::traits::future_access<
+                    typename frame_type::type>::create(HPX_MOVE(frame));
+            }
         }
     }}    // namespace lcos::detail
 
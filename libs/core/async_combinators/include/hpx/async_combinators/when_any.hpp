@@ -383,8 +383,26 @@ namespace hpx {
     {
         using result_type = std::decay_t<Range>;
 
+        result_type lazy_values =
+            hpx::traits::acquire_future<result_type>()(values);
+
+        // There is no need to create a thread waiting for any of the futures
+        // to become ready if one of them is ready already.
+        std::size_t index = 0;
+        for (auto const& value : lazy_values)
+        {
+            if (value.is_ready())
+            {
+                hpx::when_any_result<result_type> result(
+                    HPX_MOVE(lazy_values));
+                result.index = index;
+                return hpx::make_ready_future(HPX_MOVE(result));
+            }
+            ++index;
+        }
+
         auto f = std::make_shared<lcos::detail::when_any<result_type>>(
-            hpx::traits::acquire_future<result_type>()(values));
+            HPX_MOVE(lazy_values));
 
         lcos::local::futures_factory<hpx::when_any_result<result_type>()> p(
             [f = HPX_MOVE(f)]() -> hpx::when_any_result<result_type> {
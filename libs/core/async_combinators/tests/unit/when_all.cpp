@@ -12,6 +12,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <deque>
 #include <list>
 #include <memory>
@@ -249,6 +250,59 @@ void test_wait_for_all_deferred_futures()
     HPX_TEST(hpx::get<1>(result).is_ready());
 }
 
+void test_wait_for_all_ready_futures()
+{
+    std::vector<hpx::future<int>> futures;
+    for (int j = 0; j < 10; ++j)
+    {
+        futures.push_back(hpx::make_ready_future(j));
+    }
+
+    // joining ready futures does not have to wait for anything
+    hpx::future<std::vector<hpx::future<int>>> r = hpx::when_all(futures);
+    HPX_TEST(r.is_ready());
+
+    std::vector<hpx::future<int>> result = r.get();
+    HPX_TEST_EQ(result.size(), std::size_t(10));
+    for (int j = 0; j < 10; ++j)
+    {
+        HPX_TEST_EQ(result[j].get(), j);
+    }
+}
+
+void test_wait_for_all_mixed_futures()
+{
+    std::vector<hpx::lcos::local::promise<int>> promises(5);
+    std::vector<hpx::future<int>> futures;
+    for (int j = 0; j < 10; ++j)
+    {
+        if (j % 2 == 0)
+        {
+            futures.push_back(hpx::make_ready_future(j));
+        }
+        else
+        {
+            futures.push_back(promises[j / 2].get_future());
+        }
+    }
+
+    hpx::future<std::vector<hpx::future<int>>> r = hpx::when_all(futures);
+    HPX_TEST(!r.is_ready());
+
+    for (int j = 0; j < 5; ++j)
+    {
+        HPX_TEST(!r.is_ready());
+        promises[j].set_value(2 * j + 1);
+    }
+
+    std::vector<hpx::future<int>> result = r.get();
+    HPX_TEST_EQ(result.size(), std::size_t(10));
+    for (int j = 0; j < 10; ++j)
+    {
+        HPX_TEST_EQ(result[j].get(), j);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 using hpx::program_options::options_description;
 using hpx::program_options::variables_map;
@@ -271,6 +325,8 @@ int hpx_main(variables_map&)
         test_wait_for_all_five_futures();
         test_wait_for_all_late_futures();
         test_wait_for_all_deferred_futures();
+        test_wait_for_all_ready_futures();
+        test_wait_for_all_mixed_futures();
     }
 
     hpx::local::finalize();
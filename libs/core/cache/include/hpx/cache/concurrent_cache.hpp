@@ -0,0 +1,809 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/cache/detail/frequency_sketch.hpp>
+#include <hpx/cache/detail/shared_spinlock.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace util { namespace cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp hpx/cache/concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache implements a local (non-distributed)
+    ///        cache which may be accessed by many threads at the same time.
+    ///
+    /// The keys are distributed over several independent shards (based on
+    /// their hash values), each of which is protected by its own reader/writer
+    /// spinlock. Lookups acquire the shard's lock in shared mode only, which
+    /// allows for lookups of the same shard to proceed in parallel. Instead
+    /// of updating the access frequencies directly, a lookup appends the hash
+    /// of its key to one of a few small read buffers of the shard (selected
+    /// based on the calling thread). The buffered accesses are applied by the
+    /// next thread holding the shard's lock exclusively. Accesses arriving
+    /// while the buffer is full are dropped, which only makes the recorded
+    /// frequencies less accurate under heavy contention.
+    ///
+    /// Entries are evicted using the W-TinyLFU policy: newly inserted entries
+    /// are kept in a small LRU window (about 1% of the capacity). Entries
+    /// leaving the window are admitted to the main region (managed using a
+    /// CLOCK algorithm) only if they were accessed more frequently than the
+    /// entry which would have to be evicted in their favor. The access
+    /// frequencies are approximated using a count-min sketch. This makes the
+    /// cache resistant to scans over large numbers of keys which are accessed
+    /// once only.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache,
+    ///                       must model the CacheEntry concept. The value
+    ///                       returned by the entry's \a get_size function is
+    ///                       used as the weight of the entry when enforcing the
+    ///                       capacity of the cache (see \a size_entry).
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept and has to be safe to be
+    ///                       updated concurrently (e.g. \a no_statistics or
+    ///                       \a concurrent_statistics).
+    /// \tparam Hash          The hash function used for the keys
+    /// \tparam KeyEqual      The function used to compare keys for equality
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class concurrent_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+
+        static constexpr std::size_t max_num_shards = 64;
+        static constexpr size_type min_shard_capacity = 16;
+
+        struct node
+        {
+            node(key_type const& key, entry_type const& entry, size_type size,
+                std::size_t hash)
+              : value(key, entry)
+              , size(size)
+              , hash(hash)
+              , referenced(false)
+              , in_window(true)
+            {
+            }
+
+            entry_pair value;
+            size_type size;
+            std::size_t hash;
+            std::atomic<bool> referenced;
+            bool in_window;
+        };
+
+        // Accesses recorded while holding the shard's lock in shared mode.
+        // Readers claim a slot by incrementing count, the slots are read and
+        // count is reset only while holding the lock exclusively.
+        struct read_buffer
+        {
+            static constexpr std::size_t size = 16;
+
+            std::atomic<std::size_t> count{0};
+            std::size_t hashes[size];
+        };
+
+        static constexpr std::size_t num_read_buffers = 4;
+
+        using storage_type = std::list<node>;
+        using iterator = typename storage_type::iterator;
+        using map_type = std::unordered_map<Key, iterator, Hash, KeyEqual>;
+
+        struct shard
+        {
+            mutable detail::shared_spinlock mtx;
+
+            map_type map;
+            storage_type window;    // most recently inserted entries first
+            storage_type main;
+            iterator hand;          // CLOCK hand into main
+
+            size_type window_size = 0;
+            size_type main_size = 0;
+            std::atomic<size_type> current_size{0};
+
+            size_type capacity = 0;
+            size_type window_capacity = 0;
+
+            detail::frequency_sketch sketch;
+            util::cache_aligned_data<read_buffer>
+                read_buffers[num_read_buffers];
+        };
+
+        using shard_type = util::cache_aligned_data<shard>;
+
+        using unique_lock = std::unique_lock<detail::shared_spinlock>;
+        using shared_lock = std::shared_lock<detail::shared_spinlock>;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal size this cache is allowed to
+        ///                   reach any time. The default is zero (no size
+        ///                   limitation). The unit of this value is
+        ///                   determined by the unit of the values returned by
+        ///                   the entry's \a get_size function.
+        /// \param num_shards [in] The number of shards to use, rounded up to
+        ///                   the next power of two. The default is zero, which
+        ///                   selects a number based on the number of cores
+        ///                   and the maximal size of the cache.
+        ///
+        /// \note             The capacity is split evenly between the shards,
+        ///                   entries larger than the capacity of a single
+        ///                   shard can't be cached.
+        explicit concurrent_cache(
+            size_type max_size = 0, std::size_t num_shards = 0)
+          : num_shards_(get_num_shards(max_size, num_shards))
+          , shards_(new shard_type[num_shards_])
+          , max_size_(max_size)
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                s.hand = s.main.end();
+                set_capacity(s, shard_capacity(max_size, i));
+            }
+        }
+
+        concurrent_cache(concurrent_cache const&) = delete;
+        concurrent_cache& operator=(concurrent_cache const&) = delete;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current size of the cache.
+        ///
+        /// \returns The current size of this cache instance.
+        size_type size() const
+        {
+            size_type result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                result += shards_[i].data_.current_size.load(
+                    std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum size the cache is allowed to grow to.
+        ///
+        /// \returns    The maximum size this cache instance is currently
+        ///             allowed to reach. If this number is zero the cache has
+        ///             no limitation with regard to a maximum size.
+        size_type capacity() const
+        {
+            return max_size_.load(std::memory_order_relaxed);
+        }
+
+        /// \brief Return the number of shards used by this cache instance.
+        std::size_t num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum size this cache can grow to
+        ///
+        /// \param max_size    [in] The new maximum size this cache will be
+        ///             allowed to grow to. Entries are evicted if the cache
+        ///             currently holds more than that.
+        ///
+        /// \note       The number of shards is not changed.
+        void reserve(size_type max_size)
+        {
+            max_size_.store(max_size, std::memory_order_relaxed);
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+
+                unique_lock l(s.mtx);
+                drain_read_buffers(s);
+                set_capacity(s, shard_capacity(max_size, i));
+                make_room(s);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \param key    [in] The key for the entry which should be looked up
+        ///               in the cache.
+        ///
+        /// \note         This function does not mark the entry as being used.
+        ///               It just checks if the cache contains an entry
+        ///               corresponding to the given key.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool holds_key(key_type const& key) const
+        {
+            shard const& s = get_shard(hasher_(key));
+
+            shared_lock l(s.mtx);
+            return s.map.find(key) != s.map.end();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the key stored in the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function marks the entry as recently used if the
+        ///               key was found in the cache, but does not call the
+        ///               entry's \a touch function (the shard is locked in
+        ///               shared mode only).
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_get_entry);
+
+            std::size_t const hash = hasher_(key);
+            shard& s = get_shard(hash);
+
+            bool found = false;
+            bool buffer_full = false;
+            {
+                shared_lock l(s.mtx);
+
+                // record the access even for misses, this allows for keys
+                // which are requested repeatedly to be admitted once inserted
+                buffer_full = record_access(s, hash);
+
+                auto it = s.map.find(key);
+                if (it != s.map.end())
+                {
+                    // avoid writing to the cache line if not necessary
+                    node& n = *it->second;
+                    if (!n.referenced.load(std::memory_order_relaxed))
+                    {
+                        n.referenced.store(true, std::memory_order_relaxed);
+                    }
+
+                    // got hit
+                    realkey = n.value.first;
+                    entry = n.value.second;
+                    found = true;
+                }
+            }
+
+            // apply the buffered accesses unless another thread is about to
+            // do so anyways
+            if (buffer_full)
+            {
+                unique_lock l(s.mtx, std::try_to_lock);
+                if (l.owns_lock())
+                {
+                    drain_read_buffers(s);
+                }
+            }
+
+            // update statistics
+            if (found)
+            {
+                statistics_.got_hit();
+            }
+            else
+            {
+                statistics_.got_miss();
+            }
+            return found;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \note         The new entry is always inserted, even if that
+        ///               requires to evict other entries. It may however be
+        ///               evicted later on by the admission policy.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully added to the cache, otherwise it returns
+        ///               \a false (e.g. if the key is already in the cache, or
+        ///               if the entry's \a insert function returned false).
+        bool insert(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_insert_entry);
+
+            std::size_t const hash = hasher_(key);
+            shard& s = get_shard(hash);
+
+            unique_lock l(s.mtx);
+            drain_read_buffers(s);
+            s.sketch.increment(hash);
+            if (s.map.find(key) != s.map.end())
+            {
+                return false;
+            }
+            return insert_nonexist(s, key, entry, hash);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache. If the entry
+        ///               currently is not held by the cache it is added.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated or added.
+        bool update(key_type const& key, entry_type const& entry)
+        {
+            update_on_exit update(statistics_, statistics::method_update_entry);
+
+            std::size_t const hash = hasher_(key);
+            shard& s = get_shard(hash);
+
+            unique_lock l(s.mtx);
+            drain_read_buffers(s);
+            s.sketch.increment(hash);
+
+            // Is it already in the cache?
+            auto it = s.map.find(key);
+            if (it == s.map.end())
+            {
+                // got miss
+                statistics_.got_miss();    // update statistics
+                update_on_exit update(
+                    statistics_, statistics::method_insert_entry);
+                return insert_nonexist(s, key, entry, hash);
+            }
+
+            // got hit!
+            node& n = *it->second;
+            size_type const size = entry.get_size();
+            if (size > s.capacity)
+            {
+                erase_node(s, it->second);
+                s.map.erase(it);
+                statistics_.got_eviction();
+                return false;
+            }
+
+            account(s, n.in_window, n.size, size);
+            n.size = size;
+            n.value.second = entry;
+            n.referenced.store(true, std::memory_order_relaxed);
+
+            // update statistics
+            statistics_.got_hit();
+
+            make_room(s);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               (a pair of the key and the entry) currently held in
+        ///               the cache. An entry is considered for removal from
+        ///               the cache whenever the value returned from this
+        ///               invocation is \a true.
+        ///
+        /// \returns      This function returns the overall size of the removed
+        ///               entries (which is the sum of the values returned by
+        ///               the \a entry#get_size functions of the removed
+        ///               entries).
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            update_on_exit update(statistics_, statistics::method_erase_entry);
+
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+
+                unique_lock l(s.mtx);
+                for (auto it = s.map.begin(); it != s.map.end(); /**/)
+                {
+                    iterator jt = it->second;
+                    if (ep(static_cast<entry_pair const&>(jt->value)))
+                    {
+                        erased += jt->size;
+                        erase_node(s, jt);
+                        it = s.map.erase(it);
+
+                        // update statistics
+                        statistics_.got_eviction();
+                    }
+                    else
+                    {
+                        ++it;
+                    }
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the overall size of the removed
+        ///               entries (which is the sum of the values returned by
+        ///               the \a entry#get_size functions of the removed
+        ///               entries).
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+
+                unique_lock l(s.mtx);
+                erased += s.window_size + s.main_size;
+
+                s.map.clear();
+                s.window.clear();
+                s.main.clear();
+                s.hand = s.main.end();
+                s.window_size = 0;
+                s.main_size = 0;
+                s.current_size.store(0, std::memory_order_relaxed);
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Allow to access the embedded statistics instance
+        ///
+        /// \returns      This function returns a reference to the statistics
+        ///               instance embedded inside this cache
+        statistics_type const& get_statistics() const
+        {
+            return statistics_;
+        }
+
+        statistics_type& get_statistics()
+        {
+            return statistics_;
+        }
+
+    private:
+        ///////////////////////////////////////////////////////////////////////
+        static std::size_t get_num_shards(
+            size_type max_size, std::size_t num_shards)
+        {
+            if (num_shards == 0)
+            {
+                std::size_t const cores = std::thread::hardware_concurrency();
+                num_shards = (std::min)(cores, max_num_shards);
+
+                // avoid shards which are too small to be useful
+                if (max_size != 0)
+                {
+                    num_shards = (std::min)(num_shards,
+                        (std::max)(
+                            max_size / min_shard_capacity, std::size_t(1)));
+                }
+            }
+
+            std::size_t result = 1;
+            while (result < num_shards)
+                result <<= 1;
+            return result;
+        }
+
+        // distribute the capacity such that the shards add up to max_size
+        size_type shard_capacity(size_type max_size, std::size_t i) const
+        {
+            if (max_size == 0)
+                return (std::numeric_limits<size_type>::max)();
+
+            return max_size / num_shards_ +
+                (i < max_size % num_shards_ ? 1 : 0);
+        }
+
+        static void set_capacity(shard& s, size_type capacity)
+        {
+            s.capacity = capacity;
+            if (capacity == (std::numeric_limits<size_type>::max)())
+            {
+                s.window_capacity = capacity;
+            }
+            else
+            {
+                s.window_capacity =
+                    (std::max)(capacity / 100, size_type(1));
+                s.sketch.resize(capacity);
+            }
+        }
+
+        shard& get_shard(std::size_t hash) const noexcept
+        {
+            // use the upper bits of the hash value as the lower bits are used
+            // by the hash tables of the shards
+            std::uint64_t const h =
+                static_cast<std::uint64_t>(hash) * 0x9e3779b97f4a7c15ull;
+            return shards_[static_cast<std::size_t>(h >> 32) &
+                (num_shards_ - 1)]
+                .data_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // spread the threads over the read buffers of a shard
+        static std::size_t read_buffer_index() noexcept
+        {
+            thread_local std::size_t const index = static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(
+                     std::hash<std::thread::id>()(std::this_thread::get_id())) *
+                    0x9e3779b97f4a7c15ull) >>
+                32);
+            return index & (num_read_buffers - 1);
+        }
+
+        // record an access while holding the shard's lock in shared mode,
+        // returns whether the buffer used is full
+        static bool record_access(shard& s, std::size_t hash) noexcept
+        {
+            read_buffer& b = s.read_buffers[read_buffer_index()].data_;
+
+            // avoid writing to the cache line if the buffer is full already
+            if (b.count.load(std::memory_order_relaxed) >= read_buffer::size)
+            {
+                return true;
+            }
+
+            std::size_t const i =
+                b.count.fetch_add(1, std::memory_order_relaxed);
+            if (i < read_buffer::size)
+            {
+                b.hashes[i] = hash;
+            }
+            return i + 1 >= read_buffer::size;
+        }
+
+        // apply the recorded accesses to the sketch, the shard's lock has to
+        // be held exclusively
+        static void drain_read_buffers(shard& s) noexcept
+        {
+            for (auto& buffer : s.read_buffers)
+            {
+                read_buffer& b = buffer.data_;
+                std::size_t const count = (std::min)(
+                    b.count.load(std::memory_order_relaxed), read_buffer::size);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    s.sketch.increment(b.hashes[i]);
+                }
+                b.count.store(0, std::memory_order_relaxed);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool insert_nonexist(shard& s, key_type const& key,
+            entry_type const& entry, std::size_t hash)
+        {
+            entry_type e(entry);
+            if (!e.insert())
+            {
+                return false;
+            }
+
+            size_type const size = e.get_size();
+            if (size > s.capacity)
+            {
+                return false;
+            }
+
+            // insert into the window ...
+            s.window.emplace_front(key, e, size, hash);
+            s.map.emplace(key, s.window.begin());
+            account(s, true, 0, size);
+
+            // update statistics
+            statistics_.got_insertion();
+
+            // Do we need to evict cache entries?
+            make_room(s);
+            return true;
+        }
+
+        static void account(
+            shard& s, bool in_window, size_type old_size, size_type new_size)
+        {
+            size_type& region = in_window ? s.window_size : s.main_size;
+            region = region - old_size + new_size;
+            s.current_size.store(
+                s.window_size + s.main_size, std::memory_order_relaxed);
+        }
+
+        // remove the given node from its region, does not touch the map
+        static void erase_node(shard& s, iterator it)
+        {
+            account(s, it->in_window, it->size, 0);
+            if (it->in_window)
+            {
+                s.window.erase(it);
+            }
+            else
+            {
+                if (it == s.hand)
+                    ++s.hand;
+                s.main.erase(it);
+            }
+        }
+
+        void evict(shard& s, iterator it)
+        {
+            s.map.erase(it->value.first);
+            erase_node(s, it);
+
+            // update statistics
+            statistics_.got_eviction();
+        }
+
+        // advance the CLOCK hand to the next entry which has not been
+        // referenced since the hand passed over it the last time
+        static iterator select_victim(shard& s)
+        {
+            HPX_ASSERT(!s.main.empty());
+            while (true)
+            {
+                if (s.hand == s.main.end())
+                    s.hand = s.main.begin();
+
+                if (!s.hand->referenced.load(std::memory_order_relaxed))
+                    return s.hand;
+
+                s.hand->referenced.store(false, std::memory_order_relaxed);
+                ++s.hand;
+            }
+        }
+
+        bool exceeds_capacity(shard const& s, size_type additional) const
+        {
+            return s.window_size + s.main_size + additional > s.capacity;
+        }
+
+        // move entries which overflow the window into the main region
+        // (subject to admission) and evict entries until the shard fits
+        // into its capacity
+        void make_room(shard& s)
+        {
+            while (s.window_size > s.window_capacity && !s.window.empty())
+            {
+                iterator candidate = std::prev(s.window.end());
+                size_type const size = candidate->size;
+
+                // temporarily remove the candidate from the window
+                s.window_size -= size;
+
+                bool admit = true;
+                while (exceeds_capacity(s, size))
+                {
+                    if (s.main.empty())
+                    {
+                        admit = false;
+                        break;
+                    }
+
+                    iterator victim = select_victim(s);
+                    if (s.sketch.frequency(candidate->hash) <=
+                        s.sketch.frequency(victim->hash))
+                    {
+                        admit = false;
+                        break;
+                    }
+                    evict(s, victim);
+                }
+
+                s.window_size += size;
+                if (!admit)
+                {
+                    evict(s, candidate);
+                    continue;
+                }
+
+                // insert the candidate just behind the CLOCK hand
+                s.main.splice(s.hand, s.window, candidate);
+                candidate->in_window = false;
+                s.window_size -= size;
+                s.main_size += size;
+            }
+
+            // the main region may still be too large after its capacity has
+            // been reduced or an entry has grown
+            while (exceeds_capacity(s, 0) && !s.main.empty())
+            {
+                evict(s, select_victim(s));
+            }
+            while (exceeds_capacity(s, 0) && !s.window.empty())
+            {
+                evict(s, std::prev(s.window.end()));
+            }
+
+            s.current_size.store(
+                s.window_size + s.main_size, std::memory_order_relaxed);
+        }
+
+    private:
+        std::size_t const num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+        std::atomic<size_type> max_size_;
+
+        Hash hasher_;
+        statistics_type statistics_;
+    };
+}}}    // namespace hpx::util::cache
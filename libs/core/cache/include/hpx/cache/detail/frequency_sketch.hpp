@@ -0,0 +1,130 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace hpx { namespace util { namespace cache { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Approximate access frequencies of keys (given by their hash values) as
+    // needed for the TinyLFU admission policy: a count-min sketch using four
+    // rows of saturating counters, each row holding four counters per
+    // expected entry. All counters are halved once the number of recorded
+    // accesses reaches ten times the number of expected entries, which lets
+    // the frequencies of keys that are not accessed anymore decay over time.
+    //
+    // All operations may be invoked concurrently, the results are
+    // approximations anyways.
+    class frequency_sketch
+    {
+        static constexpr std::size_t num_rows = 4;
+        static constexpr std::uint8_t max_count = 15;
+
+    public:
+        explicit frequency_sketch(std::size_t expected_entries = 0)
+        {
+            resize(expected_entries);
+        }
+
+        // not thread-safe
+        void resize(std::size_t expected_entries)
+        {
+            expected_entries = (std::max)(expected_entries, std::size_t(16));
+
+            std::size_t width = 64;
+            while (width < 4 * expected_entries &&
+                width < (std::size_t(1) << 24))
+            {
+                width <<= 1;
+            }
+
+            width_mask_ = width - 1;
+            sample_size_ = 10 * (std::min)(expected_entries, width);
+            counters_.reset(new std::atomic<std::uint8_t>[num_rows * width]);
+            for (std::size_t i = 0; i != num_rows * width; ++i)
+            {
+                counters_[i].store(0, std::memory_order_relaxed);
+            }
+            additions_.store(0, std::memory_order_relaxed);
+        }
+
+        void increment(std::size_t hash) noexcept
+        {
+            for (std::size_t row = 0; row != num_rows; ++row)
+            {
+                std::atomic<std::uint8_t>& c = counter(row, hash);
+                std::uint8_t value = c.load(std::memory_order_relaxed);
+                if (value != max_count)
+                {
+                    c.compare_exchange_weak(value, std::uint8_t(value + 1),
+                        std::memory_order_relaxed);
+                }
+            }
+
+            if (additions_.fetch_add(1, std::memory_order_relaxed) + 1 ==
+                sample_size_)
+            {
+                age();
+            }
+        }
+
+        std::uint8_t frequency(std::size_t hash) const noexcept
+        {
+            std::uint8_t result = max_count;
+            for (std::size_t row = 0; row != num_rows; ++row)
+            {
+                std::uint8_t const value =
+                    counter(row, hash).load(std::memory_order_relaxed);
+                if (value < result)
+                    result = value;
+            }
+            return result;
+        }
+
+    private:
+        static std::size_t mix(std::size_t hash, std::size_t row) noexcept
+        {
+            // splitmix64 finalizer, seeded differently for each row
+            std::uint64_t h = static_cast<std::uint64_t>(hash) +
+                (row + 1) * 0x9e3779b97f4a7c15ull;
+            h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ull;
+            h = (h ^ (h >> 27)) * 0x94d049bb133111ebull;
+            return static_cast<std::size_t>(h ^ (h >> 31));
+        }
+
+        std::atomic<std::uint8_t>& counter(
+            std::size_t row, std::size_t hash) const noexcept
+        {
+            return counters_[row * (width_mask_ + 1) +
+                (mix(hash, row) & width_mask_)];
+        }
+
+        void age() noexcept
+        {
+            std::size_t const size = num_rows * (width_mask_ + 1);
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                counters_[i].store(
+                    counters_[i].load(std::memory_order_relaxed) >> 1,
+                    std::memory_order_relaxed);
+            }
+            additions_.store(sample_size_ / 2, std::memory_order_relaxed);
+        }
+
+        std::size_t width_mask_ = 0;
+        std::size_t sample_size_ = 0;
+        std::unique_ptr<std::atomic<std::uint8_t>[]> counters_;
+        std::atomic<std::size_t> additions_{0};
+    };
+}}}}    // namespace hpx::util::cache::detail
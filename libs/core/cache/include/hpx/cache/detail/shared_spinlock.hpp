@@ -0,0 +1,91 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx { namespace util { namespace cache { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A reader/writer spinlock protecting a single shard of a concurrent
+    // cache. Readers only contend on a single atomic counter, writers take
+    // precedence over newly arriving readers to avoid being starved.
+    class shared_spinlock
+    {
+        static constexpr std::int32_t writer = -1;
+
+    public:
+        shared_spinlock() = default;
+
+        shared_spinlock(shared_spinlock const&) = delete;
+        shared_spinlock& operator=(shared_spinlock const&) = delete;
+
+        void lock_shared() noexcept
+        {
+            for (std::size_t k = 0; /**/; ++k)
+            {
+                if (!writer_waiting_.load(std::memory_order_relaxed))
+                {
+                    std::int32_t state = state_.load(std::memory_order_relaxed);
+                    if (state != writer &&
+                        state_.compare_exchange_weak(state, state + 1,
+                            std::memory_order_acquire,
+                            std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                }
+                hpx::execution_base::this_thread::yield_k(
+                    k, "hpx::util::cache::detail::shared_spinlock");
+            }
+        }
+
+        void unlock_shared() noexcept
+        {
+            state_.fetch_sub(1, std::memory_order_release);
+        }
+
+        void lock() noexcept
+        {
+            writer_waiting_.store(true, std::memory_order_relaxed);
+            for (std::size_t k = 0; /**/; ++k)
+            {
+                std::int32_t state = 0;
+                if (state_.compare_exchange_weak(state, writer,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    writer_waiting_.store(false, std::memory_order_relaxed);
+                    return;
+                }
+                writer_waiting_.store(true, std::memory_order_relaxed);
+                hpx::execution_base::this_thread::yield_k(
+                    k, "hpx::util::cache::detail::shared_spinlock");
+            }
+        }
+
+        bool try_lock() noexcept
+        {
+            std::int32_t state = 0;
+            return state_.compare_exchange_strong(state, writer,
+                std::memory_order_acquire, std::memory_order_relaxed);
+        }
+
+        void unlock() noexcept
+        {
+            state_.store(0, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<std::int32_t> state_{0};
+        std::atomic<bool> writer_waiting_{false};
+    };
+}}}}    // namespace hpx::util::cache::detail
@@ -0,0 +1,160 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <atomic>
+#include <cstddef>
+
+namespace hpx { namespace util { namespace cache { namespace statistics {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The \a concurrent_statistics collect the same numbers as the
+    /// \a local_statistics, but may be updated from several threads at the
+    /// same time (as required by the \a concurrent_cache). The counters are
+    /// spread over several cache lines to avoid contention, they are summed
+    /// up when being queried.
+    class concurrent_statistics : public no_statistics
+    {
+        static constexpr std::size_t num_stripes = 16;
+
+        struct counters
+        {
+            std::atomic<std::size_t> hits{0};
+            std::atomic<std::size_t> misses{0};
+            std::atomic<std::size_t> insertions{0};
+            std::atomic<std::size_t> evictions{0};
+        };
+
+        using counters_type = util::cache_aligned_data<counters>;
+        using member_type = std::atomic<std::size_t> counters::*;
+
+    public:
+        concurrent_statistics() = default;
+
+        concurrent_statistics(concurrent_statistics const&) = delete;
+        concurrent_statistics& operator=(concurrent_statistics const&) = delete;
+
+        std::size_t hits() const
+        {
+            return load(&counters::hits);
+        }
+        std::size_t misses() const
+        {
+            return load(&counters::misses);
+        }
+        std::size_t insertions() const
+        {
+            return load(&counters::insertions);
+        }
+        std::size_t evictions() const
+        {
+            return load(&counters::evictions);
+        }
+
+        std::size_t hits(bool reset)
+        {
+            return reset ? exchange(&counters::hits) : hits();
+        }
+        std::size_t misses(bool reset)
+        {
+            return reset ? exchange(&counters::misses) : misses();
+        }
+        std::size_t insertions(bool reset)
+        {
+            return reset ? exchange(&counters::insertions) : insertions();
+        }
+        std::size_t evictions(bool reset)
+        {
+            return reset ? exchange(&counters::evictions) : evictions();
+        }
+
+        /// \brief  The function \a got_hit will be called by a cache instance
+        ///         whenever a entry got touched.
+        void got_hit()
+        {
+            increment(&counters::hits);
+        }
+
+        /// \brief  The function \a got_miss will be called by a cache instance
+        ///         whenever a requested entry has not been found in the cache.
+        void got_miss()
+        {
+            increment(&counters::misses);
+        }
+
+        /// \brief  The function \a got_insertion will be called by a cache
+        ///         instance whenever a new entry has been inserted.
+        void got_insertion()
+        {
+            increment(&counters::insertions);
+        }
+
+        /// \brief  The function \a got_eviction will be called by a cache
+        ///         instance whenever an entry has been removed from the cache
+        ///         because a new inserted entry let the cache grow beyond its
+        ///         capacity.
+        void got_eviction()
+        {
+            increment(&counters::evictions);
+        }
+
+        /// \brief Reset all statistics
+        void clear()
+        {
+            for (counters_type& c : stripes_)
+            {
+                c.data_.hits.store(0, std::memory_order_relaxed);
+                c.data_.misses.store(0, std::memory_order_relaxed);
+                c.data_.insertions.store(0, std::memory_order_relaxed);
+                c.data_.evictions.store(0, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        // OS-threads are assigned to the stripes in round-robin fashion
+        static std::size_t get_stripe() noexcept
+        {
+            static std::atomic<std::size_t> next_stripe(0);
+            thread_local std::size_t const stripe =
+                next_stripe.fetch_add(1, std::memory_order_relaxed) %
+                num_stripes;
+            return stripe;
+        }
+
+        void increment(member_type m) noexcept
+        {
+            (stripes_[get_stripe()].data_.*m)
+                .fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::size_t load(member_type m) const noexcept
+        {
+            std::size_t result = 0;
+            for (counters_type const& c : stripes_)
+            {
+                result += (c.data_.*m).load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        std::size_t exchange(member_type m) noexcept
+        {
+            std::size_t result = 0;
+            for (counters_type& c : stripes_)
+            {
+                result += (c.data_.*m).exchange(0, std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        counters_type stripes_[num_stripes];
+    };
+}}}}    // namespace hpx::util::cache::statistics
@@ -0,0 +1,242 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/entries/entry.hpp>
+#include <hpx/cache/entries/size_entry.hpp>
+#include <hpx/cache/statistics/concurrent_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_get()
+{
+    using namespace hpx::util::cache;
+
+    using entry_type = entries::entry<std::string>;
+    using cache_type = concurrent_cache<int, entry_type,
+        statistics::concurrent_statistics>;
+
+    cache_type c(64);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(64), c.capacity());
+
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(c.insert(i, entry_type(std::to_string(i))));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(10), c.size());
+
+    // inserting an existing key fails
+    HPX_TEST(!c.insert(0, entry_type("0")));
+
+    for (int i = 0; i != 10; ++i)
+    {
+        entry_type e;
+        HPX_TEST(c.get_entry(i, e));
+        HPX_TEST_EQ(e.get(), std::to_string(i));
+        HPX_TEST(c.holds_key(i));
+    }
+
+    entry_type e;
+    HPX_TEST(!c.get_entry(42, e));
+
+    // update replaces the value
+    HPX_TEST(c.update(3, entry_type("three")));
+    HPX_TEST(c.get_entry(3, e));
+    HPX_TEST_EQ(e.get(), std::string("three"));
+
+    // erase all odd keys
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(5),
+        c.erase([](std::pair<int, entry_type> const& p) {
+            return p.first % 2 != 0;
+        }));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(5), c.size());
+    HPX_TEST(!c.holds_key(1));
+    HPX_TEST(c.holds_key(2));
+
+    statistics::concurrent_statistics const& stats = c.get_statistics();
+    HPX_TEST_EQ(static_cast<std::size_t>(12), stats.hits());
+    HPX_TEST_EQ(static_cast<std::size_t>(1), stats.misses());
+    HPX_TEST_EQ(static_cast<std::size_t>(10), stats.insertions());
+    HPX_TEST_EQ(static_cast<std::size_t>(5), stats.evictions());
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(5), c.clear());
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_weighted_capacity()
+{
+    using namespace hpx::util::cache;
+
+    using entry_type = entries::size_entry<int>;
+    using cache_type = concurrent_cache<int, entry_type>;
+
+    cache_type c(100, 1);
+    HPX_TEST_EQ(static_cast<std::size_t>(1), c.num_shards());
+
+    for (int i = 0; i != 100; ++i)
+    {
+        c.insert(i, entry_type(i, 7));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(100));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(98), c.size());
+
+    // entries larger than the capacity are rejected
+    HPX_TEST(!c.insert(1000, entry_type(1000, 101)));
+
+    // shrinking the cache evicts entries
+    c.reserve(50);
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(50));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_scan_resistance()
+{
+    using namespace hpx::util::cache;
+
+    using entry_type = entries::entry<int>;
+    using cache_type = concurrent_cache<int, entry_type>;
+
+    constexpr int hot_keys = 50;
+    cache_type c(100, 1);
+
+    // establish a set of frequently accessed keys
+    for (int k = 0; k != hot_keys; ++k)
+    {
+        c.insert(k, entry_type(k));
+    }
+    for (int round = 0; round != 4; ++round)
+    {
+        for (int k = 0; k != hot_keys; ++k)
+        {
+            entry_type e;
+            c.get_entry(k, e);
+        }
+    }
+
+    // a scan over many keys accessed once only should not flush them while
+    // they are still being used
+    for (int k = 1000; k != 11000; ++k)
+    {
+        c.insert(k, entry_type(k));
+
+        entry_type e;
+        c.get_entry(k % hot_keys, e);
+    }
+
+    int retained = 0;
+    for (int k = 0; k != hot_keys; ++k)
+    {
+        if (c.holds_key(k))
+            ++retained;
+    }
+    HPX_TEST_LTE(hot_keys - 2, retained);
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(100));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// lookups are recorded in the read buffers of the shard, they have to be
+// taken into account when deciding whether to admit a new entry
+void test_buffered_reads()
+{
+    using namespace hpx::util::cache;
+
+    using entry_type = entries::entry<int>;
+    using cache_type = concurrent_cache<int, entry_type>;
+
+    cache_type c(100, 1);
+    for (int k = 0; k != 100; ++k)
+    {
+        c.insert(k, entry_type(k));
+    }
+
+    // a key which was accessed once only is not admitted
+    c.insert(1000, entry_type(1000));
+    c.insert(1001, entry_type(1001));
+    HPX_TEST(!c.holds_key(1000));
+
+    // a key which was requested repeatedly before is admitted, more accesses
+    // are recorded than fit into a single read buffer
+    entry_type e;
+    for (int i = 0; i != 20; ++i)
+    {
+        HPX_TEST(!c.get_entry(2000, e));
+    }
+    c.insert(2000, entry_type(2000));
+    c.insert(2001, entry_type(2001));
+    HPX_TEST(c.holds_key(2000));
+    HPX_TEST(c.get_entry(2000, e));
+    HPX_TEST_EQ(e.get(), 2000);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    using namespace hpx::util::cache;
+
+    using entry_type = entries::entry<int>;
+    using cache_type = concurrent_cache<int, entry_type,
+        statistics::concurrent_statistics>;
+
+    constexpr int num_threads = 8;
+    constexpr int num_iterations = 20000;
+
+    cache_type c(1024);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            for (int i = 0; i != num_iterations; ++i)
+            {
+                int const key = (i * 7 + t) % 2048;
+
+                entry_type e;
+                if (c.get_entry(key, e))
+                {
+                    HPX_TEST_EQ(e.get(), key);
+                }
+                else
+                {
+                    c.insert(key, entry_type(key));
+                }
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(1024));
+
+    statistics::concurrent_statistics& stats = c.get_statistics();
+    HPX_TEST_EQ(static_cast<std::size_t>(num_threads * num_iterations),
+        stats.hits() + stats.misses());
+    HPX_TEST_EQ(stats.insertions() - stats.evictions(), c.size());
+
+    std::size_t const hits = stats.hits(true);
+    HPX_TEST_LTE(static_cast<std::size_t>(1), hits);
+    HPX_TEST_EQ(static_cast<std::size_t>(0), stats.hits());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_get();
+    test_weighted_capacity();
+    test_scan_resistance();
+    test_buffered_reads();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
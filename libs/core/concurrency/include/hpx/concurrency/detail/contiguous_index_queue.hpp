@@ -10,9 +10,11 @@
 #include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/optional.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 namespace hpx { namespace concurrency { namespace detail {
     /// \brief A concurrent queue which can only hold contiguous ranges of
@@ -55,6 +57,21 @@ namespace hpx { namespace concurrency { namespace detail {
                 return range{first, last - 1};
             }
 
+            constexpr range increment_first(T count) noexcept
+            {
+                return range{first + count, last};
+            }
+
+            constexpr range decrement_last(T count) noexcept
+            {
+                return range{first, last - count};
+            }
+
+            constexpr T size() noexcept
+            {
+                return empty() ? T(0) : last - first;
+            }
+
             constexpr bool empty() noexcept
             {
                 return first >= last;
@@ -77,6 +94,29 @@ namespace hpx { namespace concurrency { namespace detail {
             HPX_ASSERT(first <= last);
         }
 
+        /// \brief Refill an empty queue with the given range.
+        ///
+        /// Unlike reset, this may be called while other threads are popping
+        /// items from the queue. The queue is refilled only if it is empty,
+        /// otherwise it is left unchanged and false is returned.
+        ///
+        /// \param first Beginning of the new range.
+        /// \param last End of the new range.
+        constexpr bool refill(T first, T last) noexcept
+        {
+            HPX_ASSERT(first <= last);
+
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+            if (!expected_range.empty())
+            {
+                return false;
+            }
+
+            return current_range.data_.compare_exchange_strong(
+                expected_range, range{first, last});
+        }
+
         /// \brief Construct a new contiguous_index_queue.
         ///
         /// Construct a new queue with an empty range.
@@ -176,11 +216,86 @@ namespace hpx { namespace concurrency { namespace detail {
             return hpx::util::make_optional(index);
         }
 
+        /// \brief Attempt to pop a range of items from the left of the queue.
+        ///
+        /// Attempt to pop at most count items from the left (beginning) of the
+        /// queue. The popped items are returned as the half-open range
+        /// [first, last). If no items are left hpx::util::nullopt is returned.
+        constexpr hpx::util::optional<std::pair<T, T>> pop_range_left(
+            T count) noexcept
+        {
+            HPX_ASSERT(count > 0);
+
+            range desired_range{0, 0};
+            T first = 0;
+
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::util::nullopt;
+                }
+
+                first = expected_range.first;
+                desired_range = expected_range.increment_first(
+                    (std::min)(count, expected_range.size()));
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::util::make_optional(
+                std::make_pair(first, desired_range.first));
+        }
+
+        /// \brief Attempt to pop a range of items from the right of the queue.
+        ///
+        /// Attempt to pop at most count items from the right (end) of the
+        /// queue. The popped items are returned as the half-open range
+        /// [first, last). If no items are left hpx::util::nullopt is returned.
+        constexpr hpx::util::optional<std::pair<T, T>> pop_range_right(
+            T count) noexcept
+        {
+            HPX_ASSERT(count > 0);
+
+            range desired_range{0, 0};
+            T last = 0;
+
+            range expected_range =
+                current_range.data_.load(std::memory_order_relaxed);
+
+            do
+            {
+                if (expected_range.empty())
+                {
+                    return hpx::util::nullopt;
+                }
+
+                last = expected_range.last;
+                desired_range = expected_range.decrement_last(
+                    (std::min)(count, expected_range.size()));
+            } while (!current_range.data_.compare_exchange_weak(
+                expected_range, desired_range));
+
+            return hpx::util::make_optional(
+                std::make_pair(desired_range.last, last));
+        }
+
         constexpr bool empty() noexcept
         {
             return current_range.data_.load(std::memory_order_relaxed).empty();
         }
 
+        /// \brief Return the number of items left in the queue.
+        ///
+        /// The returned value is only a snapshot and may be outdated by the
+        /// time it is used if other threads are concurrently popping items.
+        constexpr T size() noexcept
+        {
+            return current_range.data_.load(std::memory_order_relaxed).size();
+        }
+
     private:
         range initial_range;
         hpx::util::cache_line_data<std::atomic<range>> current_range;
@@ -21,6 +21,7 @@
 #include <functional>
 #include <iterator>
 #include <random>
+#include <utility>
 #include <vector>
 
 unsigned int seed = std::random_device{}();
@@ -89,13 +90,56 @@ void test_basic()
         HPX_TEST(!q.pop_left());
         HPX_TEST(!q.pop_right());
     }
+
+    {
+        // Popping ranges should give us the expected sub-ranges and never
+        // more items than are left in the queue.
+        std::uint32_t first = 3;
+        std::uint32_t last = 12;
+        hpx::concurrency::detail::contiguous_index_queue<> q{first, last};
+        HPX_TEST_EQ(q.size(), last - first);
+
+        auto r = q.pop_range_left(2);
+        HPX_TEST(r);
+        HPX_TEST_EQ(r->first, std::uint32_t(3));
+        HPX_TEST_EQ(r->second, std::uint32_t(5));
+        HPX_TEST_EQ(q.size(), std::uint32_t(7));
+
+        r = q.pop_range_right(3);
+        HPX_TEST(r);
+        HPX_TEST_EQ(r->first, std::uint32_t(9));
+        HPX_TEST_EQ(r->second, std::uint32_t(12));
+        HPX_TEST_EQ(q.size(), std::uint32_t(4));
+
+        r = q.pop_range_left(10);
+        HPX_TEST(r);
+        HPX_TEST_EQ(r->first, std::uint32_t(5));
+        HPX_TEST_EQ(r->second, std::uint32_t(9));
+
+        HPX_TEST(q.empty());
+        HPX_TEST_EQ(q.size(), std::uint32_t(0));
+        HPX_TEST(!q.pop_range_left(1));
+        HPX_TEST(!q.pop_range_right(1));
+
+        // Only empty queues can be refilled.
+        HPX_TEST(q.refill(20, 25));
+        HPX_TEST_EQ(q.size(), std::uint32_t(5));
+        HPX_TEST(!q.refill(30, 35));
+
+        r = q.pop_range_left(10);
+        HPX_TEST(r);
+        HPX_TEST_EQ(r->first, std::uint32_t(20));
+        HPX_TEST_EQ(r->second, std::uint32_t(25));
+        HPX_TEST(q.empty());
+    }
 }
 
 enum class pop_mode
 {
     left,
     right,
-    random
+    random,
+    range
 };
 
 void test_concurrent_worker(pop_mode m, std::size_t thread_index,
@@ -129,6 +173,21 @@ void test_concurrent_worker(pop_mode m, std::size_t thread_index,
             popped_indices.push_back(curr.value());
         }
         break;
+    case pop_mode::range:
+    {
+        std::uniform_int_distribution<std::uint32_t> c(1, 17);
+        hpx::optional<std::pair<std::uint32_t, std::uint32_t>> curr_range;
+        while (d(r) == 0 ? (curr_range = q.pop_range_left(c(r))) :
+                           (curr_range = q.pop_range_right(c(r))))
+        {
+            for (std::uint32_t i = curr_range->first; i != curr_range->second;
+                 ++i)
+            {
+                popped_indices.push_back(i);
+            }
+        }
+    }
+    break;
     default:
         HPX_TEST(false);
     }
@@ -202,6 +261,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     test_concurrent(pop_mode::left);
     test_concurrent(pop_mode::right);
     test_concurrent(pop_mode::random);
+    test_concurrent(pop_mode::range);
     return hpx::local::finalize();
 }
 
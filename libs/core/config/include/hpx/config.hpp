@@ -205,6 +205,13 @@
 #  define HPX_SPINLOCK_DEADLOCK_DETECTION_LIMIT 1073741823
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the size (in bytes) of the storage embedded in each HPX thread
+/// which is used to hold the thread function without allocating memory.
+#if !defined(HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE)
+#  define HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE 96
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the default number of coroutine heaps.
 #if !defined(HPX_COROUTINE_NUM_HEAPS)
@@ -17,6 +17,7 @@
 #include <hpx/execution_base/completion_scheduler.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
 #include <hpx/functional/detail/tag_priority_invoke.hpp>
 #include <hpx/functional/invoke_result.hpp>
 #include <hpx/iterator_support/counting_shape.hpp>
@@ -177,6 +178,28 @@ namespace hpx { namespace execution { namespace experimental {
                 HPX_FORWARD(Sender, sender), shape, HPX_FORWARD(F, f));
         }
 
+        // clang-format off
+        template <typename Sender, typename Shape, typename F,
+            typename Parameters,
+            HPX_CONCEPT_REQUIRES_(
+                is_sender_v<Sender> &&
+                hpx::traits::is_executor_parameters_v<Parameters> &&
+                hpx::execution::experimental::detail::
+                    is_completion_scheduler_tag_invocable_v<
+                        hpx::execution::experimental::set_value_t, Sender,
+                        bulk_t, Shape, F, Parameters>)>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_override_invoke(bulk_t,
+            Sender&& sender, Shape const& shape, F&& f, Parameters&& params)
+        {
+            auto scheduler =
+                hpx::execution::experimental::get_completion_scheduler<
+                    hpx::execution::experimental::set_value_t>(sender);
+            return hpx::functional::tag_invoke(bulk_t{}, HPX_MOVE(scheduler),
+                HPX_FORWARD(Sender, sender), shape, HPX_FORWARD(F, f),
+                HPX_FORWARD(Parameters, params));
+        }
+
         // clang-format off
         template <typename Sender, typename Shape, typename F,
             HPX_CONCEPT_REQUIRES_(
@@ -209,6 +232,25 @@ namespace hpx { namespace execution { namespace experimental {
                 HPX_FORWARD(F, f)};
         }
 
+        // The executor parameters object is only a hint used by schedulers
+        // that customize bulk (e.g. for selecting chunk sizes). If the
+        // completion scheduler of the predecessor does not support it, it is
+        // ignored.
+        // clang-format off
+        template <typename Sender, typename Shape, typename F,
+            typename Parameters,
+            HPX_CONCEPT_REQUIRES_(
+                is_sender_v<Sender> &&
+                hpx::traits::is_executor_parameters_v<Parameters>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            bulk_t, Sender&& sender, Shape&& shape, F&& f, Parameters&&)
+        {
+            return bulk_t{}(HPX_FORWARD(Sender, sender),
+                HPX_FORWARD(Shape, shape), HPX_FORWARD(F, f));
+        }
+
         template <typename Shape, typename F>
         friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
             bulk_t, Shape&& shape, F&& f)
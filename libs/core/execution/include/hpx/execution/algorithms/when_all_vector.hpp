@@ -0,0 +1,408 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/variant.hpp>
+#include <hpx/execution/algorithms/detail/single_result.hpp>
+#include <hpx/execution/algorithms/when_all.hpp>
+#include <hpx/execution/queries/get_stop_token.hpp>
+#include <hpx/execution_base/get_env.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/synchronization/stop_token.hpp>
+#include <hpx/type_support/detail/with_result_of.hpp>
+#include <hpx/type_support/pack.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+    namespace detail {
+
+        // This is a receiver to be connected to the ith predecessor sender
+        // passed to when_all_vector. When set_value is called, it will emplace
+        // the value sent into the ith position of the values stored in the
+        // operation state.
+        template <typename OperationState>
+        struct when_all_vector_receiver
+        {
+            OperationState& op_state;
+            std::size_t const i;
+
+            template <typename Error>
+            friend void tag_invoke(set_error_t, when_all_vector_receiver&& r,
+                Error&& error) noexcept
+            {
+                if (!r.op_state.set_stopped_error_called.exchange(true))
+                {
+                    r.op_state.stop_source_.request_stop();
+                    try
+                    {
+                        r.op_state.error = HPX_FORWARD(Error, error);
+                    }
+                    catch (...)
+                    {
+                        // NOLINTNEXTLINE(bugprone-throw-keyword-missing)
+                        r.op_state.error = std::current_exception();
+                    }
+                }
+                r.op_state.finish();
+            }
+
+            friend void tag_invoke(
+                set_stopped_t, when_all_vector_receiver&& r) noexcept
+            {
+                // request stop only if we're not in error state
+                if (!r.op_state.set_stopped_error_called.exchange(true))
+                {
+                    r.op_state.stop_source_.request_stop();
+                }
+                r.op_state.finish();
+            };
+
+            template <typename... Ts>
+            friend void tag_invoke(set_value_t, when_all_vector_receiver&& r,
+                Ts&&... ts) noexcept
+            {
+                if constexpr (sizeof...(Ts) != 0)
+                {
+                    if (!r.op_state.set_stopped_error_called)
+                    {
+                        try
+                        {
+                            r.op_state.values[r.i].emplace(
+                                HPX_FORWARD(Ts, ts)...);
+                        }
+                        catch (...)
+                        {
+                            if (!r.op_state.set_stopped_error_called.exchange(
+                                    true))
+                            {
+                                // NOLINTNEXTLINE(bugprone-throw-keyword-missing)
+                                r.op_state.error = std::current_exception();
+                            }
+                        }
+                    }
+                }
+
+                r.op_state.finish();
+            }
+
+            friend auto tag_invoke(get_env_t, when_all_vector_receiver const& r)
+                -> make_env_t<get_stop_token_t,
+                    hpx::experimental::in_place_stop_token,
+                    env_of_t<typename OperationState::receiver_type>>
+            {
+                return make_env<get_stop_token_t>(
+                    r.op_state.stop_source_.get_token(),
+                    hpx::execution::experimental::get_env(r.op_state.receiver));
+            }
+        };
+
+        template <typename T>
+        struct when_all_vector_value_types
+        {
+            using type = T;
+
+            template <template <typename...> class Tuple>
+            using apply = Tuple<std::vector<T>>;
+        };
+
+        template <>
+        struct when_all_vector_value_types<void>
+        {
+            // nothing is stored for predecessors sending no value
+            using type = hpx::util::unused_type;
+
+            template <template <typename...> class Tuple>
+            using apply = Tuple<>;
+        };
+
+        template <typename Sender>
+        struct when_all_vector_sender
+        {
+            using sender_type = std::decay_t<Sender>;
+            std::vector<sender_type> senders;
+
+            // the type of the (single) value sent by each of the predecessor
+            // senders, void if they send nothing
+            using element_value_type = detail::single_result_t<
+                typename hpx::execution::experimental::sender_traits<
+                    sender_type>::template value_types<hpx::util::pack,
+                    hpx::util::pack>>;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<
+                typename when_all_vector_value_types<std::decay_t<
+                    element_value_type>>::template apply<Tuple>>;
+
+            template <template <typename...> class Variant>
+            using error_types = hpx::util::detail::unique_concat_t<
+                typename hpx::execution::experimental::sender_traits<
+                    sender_type>::template error_types<Variant>,
+                Variant<std::exception_ptr>>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename Receiver, typename Senders>
+            struct operation_state
+            {
+                using receiver_type = std::decay_t<Receiver>;
+                using value_type = std::decay_t<element_value_type>;
+
+                using operation_state_type =
+                    std::decay_t<decltype(hpx::execution::experimental::connect(
+                        std::declval<std::conditional_t<
+                            std::is_lvalue_reference_v<Senders>,
+                            sender_type&, sender_type&&>>(),
+                        std::declval<
+                            when_all_vector_receiver<operation_state>>()))>;
+
+                HPX_NO_UNIQUE_ADDRESS receiver_type receiver;
+                std::size_t const num_predecessors;
+
+                // Number of predecessor senders that have not yet called any
+                // of the set signals.
+                std::atomic<std::size_t> predecessors_remaining;
+
+                // The values sent by the predecessor senders, the ith sender
+                // emplaces its value at position i.
+                std::vector<hpx::optional<
+                    typename when_all_vector_value_types<value_type>::type>>
+                    values;
+
+                hpx::optional<error_types<hpx::variant>> error;
+                std::atomic<bool> set_stopped_error_called{false};
+
+                hpx::experimental::in_place_stop_source stop_source_{};
+
+                using stop_token_t = stop_token_of_t<env_of_t<receiver_type>&>;
+                hpx::optional<typename stop_token_t::template callback_type<
+                    on_stop_requested>>
+                    on_stop_{};
+
+                // The operation states of all predecessor senders are stored
+                // in a single array. They are neither copyable nor movable,
+                // which is why they are wrapped into optionals and emplaced
+                // in place.
+                std::unique_ptr<hpx::optional<operation_state_type>[]>
+                    op_states;
+
+                template <typename Receiver_, typename Senders_>
+                operation_state(Receiver_&& receiver, Senders_&& senders)
+                  : receiver(HPX_FORWARD(Receiver_, receiver))
+                  , num_predecessors(senders.size())
+                  , predecessors_remaining(num_predecessors)
+                  , op_states(new hpx::optional<
+                        operation_state_type>[num_predecessors])
+                {
+                    if constexpr (!std::is_void_v<value_type>)
+                    {
+                        values.resize(num_predecessors);
+                    }
+
+                    for (std::size_t i = 0; i != num_predecessors; ++i)
+                    {
+                        using sender_ref_type =
+                            std::conditional_t<std::is_lvalue_reference_v<
+                                                   Senders_>,
+                                sender_type&, sender_type&&>;
+#if defined(HPX_HAVE_CXX17_COPY_ELISION)
+                        // with_result_of is used to emplace the operation
+                        // state returned from connect without any
+                        // intermediate copy construction (the operation
+                        // state is not required to be copyable nor movable).
+                        op_states[i].emplace(
+                            hpx::util::detail::with_result_of([&]() {
+                                return hpx::execution::experimental::connect(
+                                    static_cast<sender_ref_type>(senders[i]),
+                                    when_all_vector_receiver<operation_state>{
+                                        *this, i});
+                            }));
+#else
+                        // MSVC doesn't get copy elision quite right, the
+                        // operation state must be constructed explicitly
+                        // directly in place
+                        op_states[i].emplace_f(
+                            hpx::execution::experimental::connect,
+                            static_cast<sender_ref_type>(senders[i]),
+                            when_all_vector_receiver<operation_state>{
+                                *this, i});
+#endif
+                    }
+                }
+
+                operation_state(operation_state&&) = delete;
+                operation_state& operator=(operation_state&&) = delete;
+                operation_state(operation_state const&) = delete;
+                operation_state& operator=(operation_state const&) = delete;
+
+                void set_value() noexcept
+                {
+                    if constexpr (std::is_void_v<value_type>)
+                    {
+                        hpx::execution::experimental::set_value(
+                            HPX_MOVE(receiver));
+                    }
+                    else
+                    {
+                        try
+                        {
+                            std::vector<value_type> result;
+                            result.reserve(num_predecessors);
+                            for (auto& v : values)
+                            {
+                                result.push_back(HPX_MOVE(*v));
+                            }
+                            values.clear();
+
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(receiver), HPX_MOVE(result));
+                        }
+                        catch (...)
+                        {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(receiver), std::current_exception());
+                        }
+                    }
+                }
+
+                void finish() noexcept
+                {
+                    if (--predecessors_remaining == 0)
+                    {
+                        // Stop callback is no longer needed. Destroy it.
+                        on_stop_.reset();
+
+                        if (!set_stopped_error_called)
+                        {
+                            set_value();
+                        }
+                        else if (error)
+                        {
+                            hpx::visit(
+                                [this](auto&& error) {
+                                    hpx::execution::experimental::set_error(
+                                        HPX_MOVE(receiver),
+                                        HPX_FORWARD(decltype(error), error));
+                                },
+                                HPX_MOVE(error.value()));
+                        }
+                        else
+                        {
+                            hpx::execution::experimental::set_stopped(
+                                HPX_MOVE(receiver));
+                        }
+                    }
+                }
+
+                friend void tag_invoke(start_t, operation_state& os) noexcept
+                {
+                    // an empty range completes immediately
+                    if (os.num_predecessors == 0)
+                    {
+                        os.set_value();
+                        return;
+                    }
+
+                    // register stop callback
+                    os.on_stop_.emplace(
+                        hpx::execution::experimental::get_stop_token(
+                            hpx::execution::experimental::get_env(os.receiver)),
+                        on_stop_requested{os.stop_source_});
+
+                    // If a stop has already been requested. Don't bother
+                    // starting the child operations.
+                    if (os.stop_source_.stop_requested())
+                    {
+                        os.on_stop_.reset();
+                        hpx::execution::experimental::set_stopped(
+                            HPX_MOVE(os.receiver));
+                        return;
+                    }
+
+                    // The operation state might be destroyed as soon as the
+                    // last predecessor has completed, don't touch it
+                    // afterwards.
+                    auto* op_states = os.op_states.get();
+                    std::size_t const num_predecessors = os.num_predecessors;
+                    for (std::size_t i = 0; i != num_predecessors; ++i)
+                    {
+                        hpx::execution::experimental::start(*op_states[i]);
+                    }
+                }
+            };
+
+            template <typename Receiver>
+            friend auto tag_invoke(
+                connect_t, when_all_vector_sender&& s, Receiver&& receiver)
+            {
+                return operation_state<Receiver, std::vector<sender_type>&&>(
+                    HPX_FORWARD(Receiver, receiver), HPX_MOVE(s.senders));
+            }
+
+            template <typename Receiver>
+            friend auto tag_invoke(
+                connect_t, when_all_vector_sender& s, Receiver&& receiver)
+            {
+                return operation_state<Receiver, std::vector<sender_type>&>(
+                    receiver, s.senders);
+            }
+        };
+    }    // namespace detail
+
+    // execution::when_all_vector is used to join a dynamic number of sender
+    // chains of the same type and create a sender whose execution is
+    // dependent on all of the input senders. Each input sender must send at
+    // most a single value. The resulting sender sends a std::vector holding
+    // the values sent by the input senders (in the order of the input
+    // senders), or nothing if the input senders don't send any value.
+    //
+    // In contrast to the future based hpx::when_all, all operation states are
+    // stored in a single allocation and completion is tracked by a single
+    // counter.
+    inline constexpr struct when_all_vector_t final
+      : hpx::functional::detail::tag_fallback<when_all_vector_t>
+    {
+    private:
+        // clang-format off
+        template <typename Sender,
+            HPX_CONCEPT_REQUIRES_(
+                is_sender_v<Sender>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            when_all_vector_t, std::vector<Sender>&& senders)
+        {
+            return detail::when_all_vector_sender<Sender>{HPX_MOVE(senders)};
+        }
+
+        // clang-format off
+        template <typename Sender,
+            HPX_CONCEPT_REQUIRES_(
+                is_sender_v<Sender>
+            )>
+        // clang-format on
+        friend constexpr HPX_FORCEINLINE auto tag_fallback_invoke(
+            when_all_vector_t, std::vector<Sender> const& senders)
+        {
+            return detail::when_all_vector_sender<Sender>{senders};
+        }
+    } when_all_vector{};
+}    // namespace hpx::execution::experimental
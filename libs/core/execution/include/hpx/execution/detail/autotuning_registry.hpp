@@ -0,0 +1,146 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        ///////////////////////////////////////////////////////////////////////
+        // The tuning state of a single call site. The chunk size and the
+        // number of cores are tuned one after the other by doubling or halving
+        // them as long as the measured time per iteration improves.
+        class HPX_CORE_EXPORT autotuning_site
+        {
+        public:
+            autotuning_site() = default;
+
+            autotuning_site(autotuning_site const&) = delete;
+            autotuning_site(autotuning_site&&) = delete;
+            autotuning_site& operator=(autotuning_site const&) = delete;
+            autotuning_site& operator=(autotuning_site&&) = delete;
+
+            // Return the number of cores to use for the next invocation
+            std::size_t processing_units_count(std::size_t available_cores);
+
+            // Return the chunk size to use for the next invocation
+            std::size_t get_chunk_size(std::size_t cores, std::size_t count);
+
+            // Report the measured execution time of an invocation which was
+            // run using the given number of cores and chunk size.
+            void report(std::size_t cores, std::size_t chunk_size,
+                std::size_t count, std::uint64_t elapsed);
+
+            std::size_t best_chunk_size() const;
+            std::size_t best_cores() const;
+            bool converged() const;
+
+            // (re-)store the persistent part of the tuning state
+            void save(std::ostream& os) const;
+            void load(std::size_t chunk_size, std::size_t cores,
+                bool converged, double cost);
+
+        private:
+            enum class phase : std::uint8_t
+            {
+                initial,
+                chunk_size_up,
+                chunk_size_down,
+                cores_down,
+                converged
+            };
+
+            void next_trial();
+            void start_trial(std::size_t chunk_size, std::size_t cores);
+
+            mutable hpx::util::detail::spinlock mtx_;
+
+            phase phase_ = phase::initial;
+            std::size_t best_chunk_size_ = 0;
+            std::size_t best_cores_ = 0;
+            double best_cost_ = 0.0;
+
+            bool improved_ = false;
+
+            std::size_t trial_chunk_size_ = 0;
+            std::size_t trial_cores_ = 0;
+            std::size_t trial_samples_ = 0;
+            double trial_cost_ = 0.0;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Process-wide registry of all call sites using autotuned_chunk_size.
+        // The tuning results can be stored in and reloaded from a profile
+        // which allows later runs to start off with the tuned values.
+        class HPX_CORE_EXPORT autotuning_registry
+        {
+        public:
+            static autotuning_registry& instance();
+
+            autotuning_site& get_site(std::string const& key);
+
+            // load/save the tuning results of all (converged) call sites
+            void load(std::string const& filename);
+            void save(std::string const& filename) const;
+
+            // counter values
+            std::int64_t get_num_sites(bool reset);
+            std::int64_t get_num_converged_sites(bool reset);
+            std::int64_t get_num_profile_sites(bool reset);
+            std::int64_t get_num_trials(bool reset);
+            std::int64_t get_chunk_size(std::string const& key, bool reset);
+            std::int64_t get_cores(std::string const& key, bool reset);
+            std::vector<std::string> get_site_keys() const;
+
+            void count_trial() noexcept
+            {
+                ++num_trials_;
+            }
+
+        private:
+            autotuning_registry() = default;
+
+            mutable std::mutex mtx_;
+            std::map<std::string, autotuning_site, std::less<>> sites_;
+            std::int64_t num_profile_sites_ = 0;
+            std::atomic<std::int64_t> num_trials_{0};
+        };
+
+        // Return the name of the profile used by the given locality, the
+        // locality id is inserted in front of the extension of the file
+        // name configured by hpx.parallel.autotuning_profile.
+        HPX_CORE_EXPORT std::string get_autotuning_profile_name(
+            std::string const& filename, std::uint32_t locality_id);
+        /// \endcond
+    }    // namespace detail
+
+    /// Load the chunk sizes and core counts previously stored for the call
+    /// sites using \a autotuned_chunk_size from the given file. A profile is
+    /// loaded automatically at startup if the configuration setting
+    /// hpx.parallel.autotuning_profile is given, every locality uses its own
+    /// file (e.g. tuning.0.profile for tuning.profile on locality 0).
+    HPX_CORE_EXPORT void load_autotuning_profile(std::string const& filename);
+
+    /// Store the chunk sizes and core counts determined for the call sites
+    /// using \a autotuned_chunk_size in the given file. A profile is written
+    /// automatically at shutdown if the configuration setting
+    /// hpx.parallel.autotuning_profile is given, every locality uses its own
+    /// file.
+    HPX_CORE_EXPORT void save_autotuning_profile(std::string const& filename);
+}}}    // namespace hpx::execution::experimental
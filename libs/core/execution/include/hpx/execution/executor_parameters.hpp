@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 
 #include <hpx/execution/executors/auto_chunk_size.hpp>
+#include <hpx/execution/executors/autotuned_chunk_size.hpp>
 #include <hpx/execution/executors/dynamic_chunk_size.hpp>
 #include <hpx/execution/executors/guided_chunk_size.hpp>
 #include <hpx/execution/executors/persistent_auto_chunk_size.hpp>
@@ -0,0 +1,137 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/autotuned_chunk_size.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assertion/source_location.hpp>
+#include <hpx/execution/detail/autotuning_registry.hpp>
+#include <hpx/execution/detail/execution_parameter_callbacks.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace hpx { namespace execution { namespace experimental {
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of loop iterations combined and the number of cores used
+    /// are tuned at runtime based on the measured execution time of previous
+    /// invocations of the same call site. The call site is identified by a
+    /// user supplied name (or the source location of the call).
+    ///
+    /// The results of the tuning are kept for the lifetime of the process and
+    /// can be stored to (and reloaded from) a profile using the configuration
+    /// setting hpx.parallel.autotuning_profile (or the functions
+    /// \a save_autotuning_profile and \a load_autotuning_profile) which allows
+    /// later runs to start off with the tuned values.
+    ///
+    /// \note An instance of this parameters object must not be used by
+    ///       concurrently running algorithms. Separate instances referring to
+    ///       the same call site share the tuning results, however.
+    ///
+    struct autotuned_chunk_size
+    {
+        /// Construct an \a autotuned_chunk_size executor parameters object
+        ///
+        /// \param name     [in] The name identifying the call site this
+        ///                 parameters object is used for.
+        ///
+        explicit autotuned_chunk_size(std::string const& name)
+          : site_(&detail::autotuning_registry::instance().get_site(name))
+          , data_(std::make_shared<invocation_data>())
+        {
+        }
+
+        /// Construct an \a autotuned_chunk_size executor parameters object
+        ///
+        /// \param loc      [in] The source location identifying the call
+        ///                 site this parameters object is used for.
+        ///
+        explicit autotuned_chunk_size(
+            hpx::assertion::source_location const& loc)
+          : autotuned_chunk_size(std::string(loc.file_name) + ":" +
+                std::to_string(loc.line_number))
+        {
+        }
+
+        /// \cond NOINTERNAL
+        // discover the number of cores to use for parallelization
+        template <typename Executor>
+        std::size_t processing_units_count(Executor&&)
+        {
+            data_->cores = site_->processing_units_count(
+                hpx::parallel::execution::detail::get_os_thread_count());
+            return data_->cores;
+        }
+
+        // return the chunk size to use for the current invocation
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(
+            Executor&&, F&&, std::size_t cores, std::size_t count)
+        {
+            if (data_->cores == 0)
+                data_->cores = cores;
+
+            data_->count = count;
+            data_->chunk_size = site_->get_chunk_size(data_->cores, count);
+            return data_->chunk_size;
+        }
+
+        template <typename Executor>
+        void mark_begin_execution(Executor&&)
+        {
+            data_->start = hpx::chrono::high_resolution_clock::now();
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&&)
+        {
+            std::uint64_t const elapsed =
+                hpx::chrono::high_resolution_clock::now() - data_->start;
+
+            if (data_->chunk_size != 0)
+            {
+                site_->report(
+                    data_->cores, data_->chunk_size, data_->count, elapsed);
+            }
+            *data_ = invocation_data();
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        // The algorithms may operate on copies of the parameters object, the
+        // data describing the current invocation is shared between those.
+        struct invocation_data
+        {
+            std::uint64_t start = 0;
+            std::size_t cores = 0;
+            std::size_t chunk_size = 0;
+            std::size_t count = 0;
+        };
+
+        detail::autotuning_site* site_;
+        std::shared_ptr<invocation_data> data_;
+        /// \endcond
+    };
+}}}    // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<
+        hpx::execution::experimental::autotuned_chunk_size> : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
@@ -0,0 +1,439 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/detail/autotuning_registry.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+
+        // number of measurements taken for each configuration, the minimal
+        // measured cost is used to compare configurations
+        static constexpr std::size_t autotuning_samples = 3;
+
+        // a configuration has to be at least this much better than the best
+        // known one to be accepted
+        static constexpr double autotuning_threshold = 0.95;
+
+        ///////////////////////////////////////////////////////////////////////
+        std::size_t autotuning_site::processing_units_count(
+            std::size_t available_cores)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+            if (available_cores == 0)
+                available_cores = 1;
+
+            if (phase_ == phase::initial)
+            {
+                start_trial(0, available_cores);
+                phase_ = phase::chunk_size_up;
+            }
+            else if (phase_ != phase::converged &&
+                trial_cores_ > available_cores)
+            {
+                // a profile may have been recorded on a larger machine
+                start_trial(trial_chunk_size_, available_cores);
+            }
+
+            std::size_t const cores =
+                phase_ == phase::converged ? best_cores_ : trial_cores_;
+            return (std::min)(cores, available_cores);
+        }
+
+        std::size_t autotuning_site::get_chunk_size(
+            std::size_t cores, std::size_t count)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+            if (best_chunk_size_ == 0)
+            {
+                // first invocation: start off with giving each core four
+                // chunks of work
+                best_chunk_size_ =
+                    (std::max)(count / (4 * (std::max)(cores, std::size_t(1))),
+                        std::size_t(1));
+                if (phase_ != phase::converged)
+                    start_trial(best_chunk_size_, trial_cores_);
+            }
+
+            std::size_t const chunk_size = phase_ == phase::converged ?
+                best_chunk_size_ :
+                trial_chunk_size_;
+            return (std::max)(chunk_size, std::size_t(1));
+        }
+
+        void autotuning_site::report(std::size_t cores, std::size_t chunk_size,
+            std::size_t count, std::uint64_t elapsed)
+        {
+            if (count == 0)
+                return;
+
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+            // ignore measurements of configurations we're not (or no longer)
+            // interested in
+            if (phase_ == phase::converged || phase_ == phase::initial ||
+                chunk_size != trial_chunk_size_ || cores != trial_cores_)
+            {
+                return;
+            }
+
+            double const cost =
+                static_cast<double>(elapsed) / static_cast<double>(count);
+            if (trial_samples_ == 0 || cost < trial_cost_)
+                trial_cost_ = cost;
+
+            if (++trial_samples_ < autotuning_samples)
+                return;
+
+            autotuning_registry::instance().count_trial();
+
+            if (best_cost_ == 0.0 ||
+                trial_cost_ < best_cost_ * autotuning_threshold)
+            {
+                bool const baseline = best_cost_ == 0.0;
+
+                best_cost_ = trial_cost_;
+                best_chunk_size_ = trial_chunk_size_;
+                best_cores_ = trial_cores_;
+
+                // keep going in the same direction as long as this improves
+                // things
+                switch (phase_)
+                {
+                case phase::chunk_size_up:
+                    improved_ = !baseline;
+                    if (trial_chunk_size_ * 2 <= count)
+                    {
+                        start_trial(trial_chunk_size_ * 2, trial_cores_);
+                        return;
+                    }
+                    break;
+
+                case phase::chunk_size_down:
+                    if (trial_chunk_size_ > 1)
+                    {
+                        start_trial(trial_chunk_size_ / 2, trial_cores_);
+                        return;
+                    }
+                    break;
+
+                case phase::cores_down:
+                    if (trial_cores_ > 1)
+                    {
+                        start_trial(trial_chunk_size_, trial_cores_ / 2);
+                        return;
+                    }
+                    break;
+
+                default:
+                    break;
+                }
+            }
+
+            next_trial();
+        }
+
+        // advance to the next tuning phase
+        void autotuning_site::next_trial()
+        {
+            switch (phase_)
+            {
+            case phase::chunk_size_up:
+                // decreasing the chunk size is worth a try only if increasing
+                // it did not help
+                phase_ = phase::chunk_size_down;
+                if (!improved_ && best_chunk_size_ > 1)
+                {
+                    start_trial(best_chunk_size_ / 2, best_cores_);
+                    return;
+                }
+                HPX_FALLTHROUGH;
+
+            case phase::chunk_size_down:
+                phase_ = phase::cores_down;
+                if (best_cores_ > 1)
+                {
+                    start_trial(best_chunk_size_, best_cores_ / 2);
+                    return;
+                }
+                HPX_FALLTHROUGH;
+
+            default:
+                phase_ = phase::converged;
+                break;
+            }
+        }
+
+        void autotuning_site::start_trial(
+            std::size_t chunk_size, std::size_t cores)
+        {
+            trial_chunk_size_ = chunk_size;
+            trial_cores_ = cores;
+            trial_samples_ = 0;
+            trial_cost_ = 0.0;
+        }
+
+        std::size_t autotuning_site::best_chunk_size() const
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            return best_chunk_size_;
+        }
+
+        std::size_t autotuning_site::best_cores() const
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            return best_cores_;
+        }
+
+        bool autotuning_site::converged() const
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            return phase_ == phase::converged;
+        }
+
+        void autotuning_site::save(std::ostream& os) const
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+            os << best_chunk_size_ << ' ' << best_cores_ << ' '
+               << (phase_ == phase::converged ? 1 : 0) << ' ' << best_cost_;
+        }
+
+        void autotuning_site::load(std::size_t chunk_size, std::size_t cores,
+            bool converged, double cost)
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+            best_chunk_size_ = chunk_size;
+            best_cores_ = cores;
+            best_cost_ = cost;
+
+            // continue tuning if the previous run did not converge, the
+            // stored cost is used as the baseline
+            if (converged)
+            {
+                phase_ = phase::converged;
+            }
+            else
+            {
+                phase_ = phase::chunk_size_up;
+                improved_ = false;
+                start_trial(best_chunk_size_ * 2, best_cores_);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        autotuning_registry& autotuning_registry::instance()
+        {
+            static autotuning_registry registry;
+            return registry;
+        }
+
+        autotuning_site& autotuning_registry::get_site(std::string const& key)
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            auto it = sites_.find(key);
+            if (it == sites_.end())
+            {
+                it = sites_
+                         .emplace(std::piecewise_construct,
+                             std::forward_as_tuple(key), std::forward_as_tuple())
+                         .first;
+            }
+            return it->second;
+        }
+
+        // The profile is a simple text file, one line per call site:
+        //
+        //      <chunk-size> <cores> <converged> <cost> <key>
+        //
+        void autotuning_registry::load(std::string const& filename)
+        {
+            std::ifstream in(filename.c_str());
+            if (!in.is_open())
+            {
+                // a missing profile is not an error, it will be created at
+                // shutdown
+                return;
+            }
+
+            std::string line;
+            if (!std::getline(in, line) || line != "# HPX autotuning profile v1")
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "autotuning_registry::load",
+                    "unrecognized autotuning profile format in file: {}",
+                    filename);
+            }
+
+            std::lock_guard<std::mutex> l(mtx_);
+            while (std::getline(in, line))
+            {
+                if (line.empty() || line[0] == '#')
+                    continue;
+
+                std::istringstream is(line);
+
+                std::size_t chunk_size = 0;
+                std::size_t cores = 0;
+                int converged = 0;
+                double cost = 0.0;
+                std::string key;
+                if (!(is >> chunk_size >> cores >> converged >> cost) ||
+                    !std::getline(is >> std::ws, key) || key.empty() ||
+                    chunk_size == 0 || cores == 0)
+                {
+                    continue;
+                }
+
+                auto it = sites_.find(key);
+                if (it == sites_.end())
+                {
+                    it = sites_
+                             .emplace(std::piecewise_construct,
+                                 std::forward_as_tuple(key),
+                                 std::forward_as_tuple())
+                             .first;
+                }
+
+                it->second.load(chunk_size, cores, converged != 0, cost);
+                ++num_profile_sites_;
+            }
+        }
+
+        void autotuning_registry::save(std::string const& filename) const
+        {
+            std::ofstream out(filename.c_str());
+            if (!out.is_open())
+            {
+                HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                    "autotuning_registry::save",
+                    "unable to open autotuning profile for writing: {}",
+                    filename);
+            }
+
+            out << "# HPX autotuning profile v1\n";
+
+            std::lock_guard<std::mutex> l(mtx_);
+            for (auto const& site : sites_)
+            {
+                if (site.second.best_chunk_size() == 0)
+                    continue;
+
+                site.second.save(out);
+                out << ' ' << site.first << '\n';
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::int64_t autotuning_registry::get_num_sites(bool)
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            return static_cast<std::int64_t>(sites_.size());
+        }
+
+        std::int64_t autotuning_registry::get_num_converged_sites(bool)
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            return static_cast<std::int64_t>(
+                std::count_if(sites_.begin(), sites_.end(),
+                    [](auto const& site) { return site.second.converged(); }));
+        }
+
+        std::int64_t autotuning_registry::get_num_profile_sites(bool reset)
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            std::int64_t const result = num_profile_sites_;
+            if (reset)
+                num_profile_sites_ = 0;
+            return result;
+        }
+
+        std::int64_t autotuning_registry::get_num_trials(bool reset)
+        {
+            return reset ? num_trials_.exchange(0) : num_trials_.load();
+        }
+
+        std::int64_t autotuning_registry::get_chunk_size(
+            std::string const& key, bool)
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            auto it = sites_.find(key);
+            if (it == sites_.end())
+                return 0;
+            return static_cast<std::int64_t>(it->second.best_chunk_size());
+        }
+
+        std::int64_t autotuning_registry::get_cores(
+            std::string const& key, bool)
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            auto it = sites_.find(key);
+            if (it == sites_.end())
+                return 0;
+            return static_cast<std::int64_t>(it->second.best_cores());
+        }
+
+        std::vector<std::string> autotuning_registry::get_site_keys() const
+        {
+            std::vector<std::string> keys;
+
+            std::lock_guard<std::mutex> l(mtx_);
+            keys.reserve(sites_.size());
+            for (auto const& site : sites_)
+            {
+                keys.push_back(site.first);
+            }
+            return keys;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::string get_autotuning_profile_name(
+            std::string const& filename, std::uint32_t locality_id)
+        {
+            // insert the locality id in front of the extension (if any) of
+            // the file name
+            std::string::size_type const sep = filename.find_last_of("/\\");
+            std::string::size_type const start =
+                sep == std::string::npos ? 0 : sep + 1;
+
+            // a leading dot does not start an extension
+            std::string::size_type dot = filename.find_last_of('.');
+            if (dot == std::string::npos || dot <= start)
+            {
+                dot = filename.size();
+            }
+
+            return filename.substr(0, dot) + "." +
+                std::to_string(locality_id) + filename.substr(dot);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void load_autotuning_profile(std::string const& filename)
+    {
+        detail::autotuning_registry::instance().load(filename);
+    }
+
+    void save_autotuning_profile(std::string const& filename)
+    {
+        detail::autotuning_registry::instance().save(filename);
+    }
+}}}    // namespace hpx::execution::experimental
@@ -0,0 +1,149 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include "algorithm_test_utils.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+int main()
+{
+    // Success path
+    {
+        std::atomic<bool> set_value_called{false};
+        std::vector<decltype(ex::just(42))> senders;
+        for (int i = 0; i != 100; ++i)
+        {
+            senders.push_back(ex::just(int(i)));
+        }
+        auto s = ex::when_all_vector(std::move(senders));
+        auto f = [](std::vector<int> v) {
+            HPX_TEST_EQ(v.size(), std::size_t(100));
+            for (int i = 0; i != 100; ++i)
+            {
+                HPX_TEST_EQ(v[i], i);
+            }
+        };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    {
+        // senders held by an lvalue sender are not consumed by connect
+        std::atomic<bool> set_value_called{false};
+        std::vector<decltype(ex::just(std::string()))> senders(
+            10, ex::just(std::string("hello")));
+        auto s = ex::when_all_vector(senders);
+        auto f = [](std::vector<std::string> v) {
+            HPX_TEST_EQ(v.size(), std::size_t(10));
+            for (auto const& str : v)
+            {
+                HPX_TEST_EQ(str, std::string("hello"));
+            }
+        };
+        for (int i = 0; i != 2; ++i)
+        {
+            set_value_called = false;
+            auto r = callback_receiver<decltype(f)>{f, set_value_called};
+            auto os = ex::connect(s, std::move(r));
+            ex::start(os);
+            HPX_TEST(set_value_called);
+        }
+    }
+
+    {
+        std::atomic<bool> set_value_called{false};
+        std::vector<void_sender> senders(10);
+        auto s = ex::when_all_vector(std::move(senders));
+        auto f = [] {};
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    {
+        // an empty range completes immediately
+        std::atomic<bool> set_value_called{false};
+        auto s = ex::when_all_vector(std::vector<decltype(ex::just(42))>());
+        auto f = [](std::vector<int> v) { HPX_TEST(v.empty()); };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    {
+        std::atomic<bool> set_value_called{false};
+        using sender_type =
+            decltype(ex::just(custom_type_non_default_constructible(0)));
+        std::vector<sender_type> senders;
+        senders.push_back(ex::just(custom_type_non_default_constructible(42)));
+        senders.push_back(ex::just(custom_type_non_default_constructible(43)));
+        auto s = ex::when_all_vector(std::move(senders));
+        auto f = [](auto v) {
+            HPX_TEST_EQ(v.size(), std::size_t(2));
+            HPX_TEST_EQ(v[0].x, 42);
+            HPX_TEST_EQ(v[1].x, 43);
+        };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    {
+        // the result can be passed on to other algorithms
+        std::vector<decltype(ex::just(42))> senders;
+        for (int i = 0; i != 10; ++i)
+        {
+            senders.push_back(ex::just(int(i)));
+        }
+        std::atomic<bool> set_value_called{false};
+        auto s = ex::when_all_vector(std::move(senders)) |
+            ex::then([](std::vector<int> v) {
+                int sum = 0;
+                for (int i : v)
+                {
+                    sum += i;
+                }
+                return sum;
+            });
+        auto f = [](int sum) { HPX_TEST_EQ(sum, 45); };
+        auto r = callback_receiver<decltype(f)>{f, set_value_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_value_called);
+    }
+
+    // Failure path
+    {
+        std::atomic<bool> set_error_called{false};
+        std::vector<error_typed_sender<double>> senders(10);
+        auto s = ex::when_all_vector(std::move(senders));
+        auto r = error_callback_receiver<decltype(check_exception_ptr)>{
+            check_exception_ptr, set_error_called};
+        auto os = ex::connect(std::move(s), std::move(r));
+        ex::start(os);
+        HPX_TEST(set_error_called);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,186 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "foreach_tests.hpp"
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_autotuned_chunk_size()
+{
+    typedef std::random_access_iterator_tag iterator_tag;
+    {
+        ex::autotuned_chunk_size p("test_autotuned_chunk_size");
+        auto policy = hpx::execution::par.with(p);
+        test_for_each(policy, iterator_tag());
+    }
+
+    {
+        ex::autotuned_chunk_size p("test_autotuned_chunk_size");
+        auto policy = hpx::execution::par(hpx::execution::task).with(p);
+        test_for_each_async(policy, iterator_tag());
+    }
+
+    hpx::execution::parallel_executor par_exec;
+
+    {
+        ex::autotuned_chunk_size p(
+            hpx::assertion::source_location{__FILE__, __LINE__, ""});
+        test_for_each(
+            hpx::execution::par.on(par_exec).with(std::ref(p)), iterator_tag());
+    }
+
+    {
+        ex::autotuned_chunk_size p(
+            hpx::assertion::source_location{__FILE__, __LINE__, ""});
+        test_for_each_async(hpx::execution::par(hpx::execution::task)
+                                .on(par_exec)
+                                .with(std::ref(p)),
+            iterator_tag());
+    }
+}
+
+// repeated invocations of the same call site have to converge eventually
+void test_autotuned_chunk_size_converges()
+{
+    auto& registry = ex::detail::autotuning_registry::instance();
+
+    std::vector<std::size_t> c(10007);
+    ex::autotuned_chunk_size p("test_autotuned_chunk_size_converges");
+
+    for (int i = 0; i != 1000 &&
+         !registry.get_site("test_autotuned_chunk_size_converges").converged();
+         ++i)
+    {
+        std::fill(c.begin(), c.end(), std::size_t(0));
+        hpx::for_each(hpx::execution::par.with(p), c.begin(), c.end(),
+            [](std::size_t& v) { ++v; });
+
+        HPX_TEST(std::all_of(
+            c.begin(), c.end(), [](std::size_t v) { return v == 1; }));
+    }
+
+    auto& site = registry.get_site("test_autotuned_chunk_size_converges");
+    HPX_TEST(site.converged());
+    HPX_TEST_NEQ(site.best_chunk_size(), std::size_t(0));
+    HPX_TEST_NEQ(site.best_cores(), std::size_t(0));
+    HPX_TEST_LTE(site.best_cores(), hpx::get_num_worker_threads());
+
+    HPX_TEST_NEQ(
+        registry.get_chunk_size("test_autotuned_chunk_size_converges", false),
+        std::int64_t(0));
+    HPX_TEST_NEQ(registry.get_num_trials(false), std::int64_t(0));
+}
+
+// the tuning results have to survive a round trip through the profile
+void test_autotuning_profile()
+{
+    auto& registry = ex::detail::autotuning_registry::instance();
+
+    std::string const filename = "autotuned_chunk_size_test.profile";
+    ex::save_autotuning_profile(filename);
+
+    std::int64_t const chunk_size =
+        registry.get_chunk_size("test_autotuned_chunk_size_converges", false);
+    std::int64_t const cores =
+        registry.get_cores("test_autotuned_chunk_size_converges", false);
+
+    std::int64_t const sites = registry.get_num_sites(false);
+    registry.get_num_profile_sites(true);
+
+    ex::load_autotuning_profile(filename);
+    std::remove(filename.c_str());
+
+    HPX_TEST_EQ(registry.get_num_sites(false), sites);
+    HPX_TEST_NEQ(registry.get_num_profile_sites(false), std::int64_t(0));
+    HPX_TEST_EQ(
+        registry.get_chunk_size("test_autotuned_chunk_size_converges", false),
+        chunk_size);
+    HPX_TEST_EQ(
+        registry.get_cores("test_autotuned_chunk_size_converges", false),
+        cores);
+    HPX_TEST(
+        registry.get_site("test_autotuned_chunk_size_converges").converged());
+
+    // loading a non-existing profile is not an error
+    ex::load_autotuning_profile("non_existing_autotuning.profile");
+}
+
+// every locality uses its own profile
+void test_autotuning_profile_name()
+{
+    using ex::detail::get_autotuning_profile_name;
+
+    HPX_TEST_EQ(get_autotuning_profile_name("tuning.profile", 0),
+        std::string("tuning.0.profile"));
+    HPX_TEST_EQ(get_autotuning_profile_name("tuning", 3),
+        std::string("tuning.3"));
+    HPX_TEST_EQ(get_autotuning_profile_name("a.b/tuning", 1),
+        std::string("a.b/tuning.1"));
+    HPX_TEST_EQ(get_autotuning_profile_name("dir/.tuning", 2),
+        std::string("dir/.tuning.2"));
+    HPX_TEST_EQ(get_autotuning_profile_name("dir/run.tuning.txt", 12),
+        std::string("dir/run.tuning.12.txt"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    test_autotuned_chunk_size();
+    test_autotuned_chunk_size_converges();
+    test_autotuning_profile();
+    test_autotuning_profile_name();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/concurrency/detail/contiguous_index_queue.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
 #include <hpx/datastructures/tuple.hpp>
@@ -17,6 +18,8 @@
 #include <hpx/execution_base/completion_scheduler.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/executors/sequenced_executor.hpp>
 #include <hpx/executors/thread_pool_scheduler.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/tag_invoke.hpp>
@@ -25,34 +28,81 @@
 #include <hpx/iterator_support/traits/is_range.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/register_thread.hpp>
+#include <hpx/type_support/decay.hpp>
+#include <hpx/type_support/unused.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
+#include <iterator>
+#include <limits>
 #include <optional>
 #include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+namespace hpx { namespace execution { namespace experimental {
+    namespace detail {
+        /// The executor parameters used by the thread_pool_scheduler bulk
+        /// customization if no other parameters are given. Returns a
+        /// power-of-2 chunk size that produces at most 8 and at least 4
+        /// chunks per worker thread.
+        struct thread_pool_bulk_default_parameters
+        {
+            template <typename Executor, typename F>
+            constexpr std::size_t get_chunk_size(Executor&&, F&&,
+                std::size_t cores, std::size_t num_tasks) const noexcept
+            {
+                std::size_t chunk_size = 1;
+                while (chunk_size * cores * 8 < num_tasks)
+                {
+                    chunk_size *= 2;
+                }
+                return chunk_size;
+            }
+        };
+    }    // namespace detail
+}}}      // namespace hpx::execution::experimental
+
+namespace hpx { namespace parallel { namespace execution {
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<hpx::execution::experimental::detail::
+            thread_pool_bulk_default_parameters> : std::true_type
+    {
+    };
+    /// \endcond
+}}}    // namespace hpx::parallel::execution
+
 namespace hpx { namespace execution { namespace experimental {
     namespace detail {
         /// This sender represents bulk work that will be performed using the
         /// thread_pool_scheduler.
         ///
-        /// The work is chunked into a number of chunks larger than the number
-        /// of worker threads available on the underlying thread pool. The
-        /// chunks are then assigned to worker thread-specific thread-safe index
-        /// queues. One HPX thread is spawned for each underlying worker (OS)
-        /// thread. The HPX thread is responsible for work in one queue. If the
-        /// queue is empty, no HPX thread will be spawned. Once the HPX thread
-        /// has finished working on its own queue, it will attempt to steal work
-        /// from other queues. Since predecessor sender must complete on an HPX
-        /// thread (the completion scheduler is a thread_pool_scheduler;
-        /// otherwise the customization defined in this file is not chosen) it
-        /// will be reused as one of the worker threads.
-        template <typename Sender, typename Shape, typename F>
+        /// The index space of the shape is split evenly into worker
+        /// thread-specific thread-safe index queues. One HPX thread is spawned
+        /// for each underlying worker (OS) thread. The HPX thread is
+        /// responsible for work in one queue, which it processes in chunks
+        /// whose size is determined by the given executor parameters object
+        /// (see for example hpx::execution::static_chunk_size,
+        /// hpx::execution::auto_chunk_size, or
+        /// hpx::execution::guided_chunk_size). If the queue is empty, no HPX
+        /// thread will be spawned. Once the HPX thread has finished working on
+        /// its own queue, it will attempt to steal half of the remaining work
+        /// of other queues into its own queue, so that the stolen range can in
+        /// turn be split by other idle worker threads. Since predecessor sender
+        /// must complete on an HPX thread (the completion scheduler is a
+        /// thread_pool_scheduler; otherwise the customization defined in this
+        /// file is not chosen) it will be reused as one of the worker threads.
+        ///
+        /// Completion of the worker threads is tracked hierarchically: worker
+        /// threads are grouped and only the last worker of each group
+        /// decrements the counter shared between all groups.
+        template <typename Sender, typename Shape, typename F,
+            typename Parameters = thread_pool_bulk_default_parameters>
         class thread_pool_bulk_sender
         {
         private:
@@ -60,17 +110,21 @@ namespace hpx { namespace execution { namespace experimental {
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Sender> sender;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
             HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Parameters> params;
 
             using size_type = decltype(hpx::util::size(shape));
 
         public:
-            template <typename Sender_, typename Shape_, typename F_>
+            template <typename Sender_, typename Shape_, typename F_,
+                typename Parameters_ = Parameters>
             thread_pool_bulk_sender(thread_pool_scheduler&& scheduler,
-                Sender_&& sender, Shape_&& shape, F_&& f)
+                Sender_&& sender, Shape_&& shape, F_&& f,
+                Parameters_&& params = Parameters_{})
               : scheduler(HPX_MOVE(scheduler))
               , sender(HPX_FORWARD(Sender_, sender))
               , shape(HPX_FORWARD(Shape_, shape))
               , f(HPX_FORWARD(F_, f))
+              , params(HPX_FORWARD(Parameters_, params))
             {
             }
             thread_pool_bulk_sender(thread_pool_bulk_sender&&) = default;
@@ -128,6 +182,16 @@ namespace hpx { namespace execution { namespace experimental {
             template <typename Receiver>
             struct operation_state
             {
+                // The number of worker threads sharing one completion counter.
+                static constexpr std::size_t completion_group_size = 8;
+
+                // Executor parameters objects may have a variable chunk size
+                // (e.g. guided_chunk_size), in which case a new chunk size is
+                // computed for every chunk taken from a queue.
+                static constexpr bool has_variable_chunk_size =
+                    hpx::parallel::execution::extract_has_variable_chunk_size<
+                        hpx::util::decay_unwrap_t<Parameters>>::type::value;
+
                 struct bulk_receiver
                 {
                     operation_state* op_state;
@@ -159,34 +223,54 @@ namespace hpx { namespace execution { namespace experimental {
                             HPX_UNREACHABLE;
                         }
 
-                        // Perform the work in one chunk indexed by index.  The
-                        // index represents a range of indices (iterators) in
-                        // the given shape.
-                        template <typename Ts>
-                        void do_work_chunk(
-                            Ts& ts, std::uint32_t const index) const
+                        // Attempt to steal half of the remaining work of one of
+                        // the neighboring queues into the (empty) local queue.
+                        // Returns false if there was no work left to steal.
+                        bool steal_work(hpx::concurrency::detail::
+                                contiguous_index_queue<>& local_queue) const
                         {
-                            auto const i_begin = static_cast<size_type>(index) *
-                                task_f->chunk_size;
-                            auto const i_end =
-                                (std::min)(static_cast<size_type>(index + 1) *
-                                        task_f->chunk_size,
-                                    task_f->n);
-                            auto it = hpx::util::begin(op_state->shape);
-                            std::advance(it, i_begin);
-                            for (std::uint32_t i = i_begin; i < i_end; ++i)
+                            for (std::uint32_t offset = 1;
+                                 offset < op_state->num_worker_threads;
+                                 ++offset)
                             {
-                                hpx::util::invoke_fused(
-                                    hpx::util::bind_front(op_state->f, *it),
-                                    ts);
-                                ++it;
+                                std::size_t neighbor_worker_thread =
+                                    (task_f->worker_thread + offset) %
+                                    op_state->num_worker_threads;
+                                auto& neighbor_queue =
+                                    op_state->queues[neighbor_worker_thread]
+                                        .data_;
+
+                                std::uint32_t const remaining =
+                                    neighbor_queue.size();
+                                if (remaining == 0)
+                                {
+                                    continue;
+                                }
+
+                                auto stolen = neighbor_queue.pop_range_right(
+                                    (remaining + 1) / 2);
+                                if (stolen)
+                                {
+                                    // Other threads may be stealing from the
+                                    // local queue concurrently. It is empty
+                                    // at this point and only this thread
+                                    // adds work to it, so refilling it
+                                    // always succeeds.
+                                    bool const refilled = local_queue.refill(
+                                        stolen->first, stolen->second);
+                                    HPX_ASSERT(refilled);
+                                    HPX_UNUSED(refilled);
+                                    return true;
+                                }
                             }
+                            return false;
                         }
 
                         // Visit the values sent from the predecessor sender.
                         // This function first tries to handle all chunks in the
                         // queue owned by worker_thread. It then tries to steal
-                        // chunks from neighboring threads.
+                        // ranges from neighboring threads, which are processed
+                        // the same way.
                         template <typename Ts,
                             typename = std::enable_if_t<!std::is_same_v<
                                 std::decay_t<Ts>, hpx::monostate>>>
@@ -195,30 +279,19 @@ namespace hpx { namespace execution { namespace experimental {
                             auto& local_queue =
                                 op_state->queues[task_f->worker_thread].data_;
 
-                            // Handle local queue first
-                            hpx::util::optional<std::uint32_t> index;
-                            while ((index = local_queue.pop_left()))
-                            {
-                                do_work_chunk(ts, index.value());
-                            }
-
-                            // Then steal from neighboring queues
-                            for (std::uint32_t offset = 1;
-                                 offset < op_state->num_worker_threads;
-                                 ++offset)
+                            do
                             {
-                                std::size_t neighbor_worker_thread =
-                                    (task_f->worker_thread + offset) %
-                                    op_state->num_worker_threads;
-                                auto& neighbor_queue =
-                                    op_state->queues[neighbor_worker_thread]
-                                        .data_;
-
-                                while ((index = neighbor_queue.pop_right()))
+                                hpx::util::optional<
+                                    std::pair<std::uint32_t, std::uint32_t>>
+                                    range;
+                                while ((range = local_queue.pop_range_left(
+                                            op_state->get_chunk_size(
+                                                local_queue))))
                                 {
-                                    do_work_chunk(ts, index.value());
+                                    op_state->do_work_chunk(
+                                        ts, range->first, range->second);
                                 }
-                            }
+                            } while (steal_work(local_queue));
                         }
                     };
 
@@ -252,8 +325,6 @@ namespace hpx { namespace execution { namespace experimental {
                     struct task_function
                     {
                         operation_state* const op_state;
-                        size_type const n;
-                        std::uint32_t const chunk_size;
                         std::uint32_t const worker_thread;
 
                         // Visit the values sent by the predecessor sender.
@@ -263,41 +334,37 @@ namespace hpx { namespace execution { namespace experimental {
                                 op_state->ts);
                         }
 
-                        // Store an exception and mark that an exception was
-                        // thrown in the operation state. This function assumes
-                        // that there is a current exception.
-                        void store_exception() const
-                        {
-                            if (!op_state->exception_thrown.exchange(true))
-                            {
-                                // NOLINTNEXTLINE(bugprone-throw-keyword-missing)
-                                op_state->exception = std::current_exception();
-                            }
-                        }
-
                         // Finish the work for one worker thread. If this is not
                         // the last worker thread to finish, it will only
-                        // decrement the counter. If it is the last thread it
-                        // will call set_error if there is an exception.
-                        // Otherwise it will call set_value on the connected
-                        // receiver.
+                        // decrement the counter of its group (and the shared
+                        // counter if it is the last of its group). If it is the
+                        // last thread it will call set_error if there is an
+                        // exception. Otherwise it will call set_value on the
+                        // connected receiver.
                         void finish() const
                         {
-                            if (--(op_state->tasks_remaining) == 0)
+                            auto& group_tasks_remaining =
+                                op_state
+                                    ->group_tasks_remaining
+                                        [worker_thread / completion_group_size]
+                                    .data_;
+                            if (--group_tasks_remaining != 0 ||
+                                --(op_state->tasks_remaining) != 0)
                             {
-                                if (op_state->exception_thrown)
-                                {
-                                    HPX_ASSERT(op_state->exception.has_value());
-                                    hpx::execution::experimental::set_error(
-                                        HPX_MOVE(op_state->receiver),
-                                        HPX_MOVE(op_state->exception.value()));
-                                }
-                                else
-                                {
-                                    hpx::visit(
-                                        set_value_end_loop_visitor{op_state},
-                                        HPX_MOVE(op_state->ts));
-                                }
+                                return;
+                            }
+
+                            if (op_state->exception_thrown)
+                            {
+                                HPX_ASSERT(op_state->exception.has_value());
+                                hpx::execution::experimental::set_error(
+                                    HPX_MOVE(op_state->receiver),
+                                    HPX_MOVE(op_state->exception.value()));
+                            }
+                            else
+                            {
+                                hpx::visit(set_value_end_loop_visitor{op_state},
+                                    HPX_MOVE(op_state->ts));
                             }
                         }
 
@@ -313,50 +380,36 @@ namespace hpx { namespace execution { namespace experimental {
                             }
                             catch (...)
                             {
-                                store_exception();
+                                op_state->store_exception();
                             }
 
                             finish();
                         };
                     };
 
-                    // Compute a chunk size given a number of worker threads and
-                    // a total number of items n. Returns a power-of-2 chunk
-                    // size that produces at most 8 and at least 4 chunks per
-                    // worker thread.
-                    static constexpr std::uint32_t get_chunk_size(
-                        std::uint32_t const num_threads, size_type const n)
-                    {
-                        std::uint32_t chunk_size = 1;
-                        while (chunk_size * num_threads * 8 < n)
-                        {
-                            chunk_size *= 2;
-                        }
-                        return chunk_size;
-                    }
-
                     // Initialize a queue for a worker thread.
                     void init_queue(std::uint32_t const worker_thread,
-                        std::uint32_t const num_chunks)
+                        std::uint32_t const first, std::uint32_t const last)
                     {
                         auto& queue = op_state->queues[worker_thread].data_;
+                        auto const num_items = static_cast<std::uint64_t>(
+                            last - first);
                         auto const part_begin = static_cast<std::uint32_t>(
-                            (worker_thread * num_chunks) /
-                            op_state->num_worker_threads);
+                            first +
+                            (worker_thread * num_items) /
+                                op_state->num_worker_threads);
                         auto const part_end = static_cast<std::uint32_t>(
-                            ((worker_thread + 1) * num_chunks) /
-                            op_state->num_worker_threads);
+                            first +
+                            ((worker_thread + 1) * num_items) /
+                                op_state->num_worker_threads);
                         queue.reset(part_begin, part_end);
                     }
 
                     // Spawn a task which will process a number of chunks. If
                     // the queue contains no chunks no task will be spawned.
-                    void do_work_task(size_type const n,
-                        std::uint32_t const chunk_size,
-                        std::uint32_t const worker_thread) const
+                    void do_work_task(std::uint32_t const worker_thread) const
                     {
-                        task_function task_f{
-                            this->op_state, n, chunk_size, worker_thread};
+                        task_function task_f{this->op_state, worker_thread};
 
                         auto& queue = op_state->queues[worker_thread].data_;
                         if (queue.empty())
@@ -398,16 +451,14 @@ namespace hpx { namespace execution { namespace experimental {
                     // from the predecessor sender. This thread participates in
                     // the work and does not need a new task since it already
                     // runs on a task.
-                    void do_work_local(size_type n, std::uint32_t chunk_size,
-                        std::uint32_t worker_thread) const
+                    void do_work_local(std::uint32_t worker_thread) const
                     {
                         char const* scheduler_annotation =
                             get_annotation(op_state->scheduler);
                         auto af = scheduler_annotation ?
                             hpx::scoped_annotation(scheduler_annotation) :
                             hpx::scoped_annotation(op_state->f);
-                        task_function{
-                            this->op_state, n, chunk_size, worker_thread}();
+                        task_function{this->op_state, worker_thread}();
                     }
 
                     using range_value_type = hpx::traits::iter_value_t<
@@ -430,30 +481,34 @@ namespace hpx { namespace execution { namespace experimental {
                             return;
                         }
 
-                        // Calculate chunk size and number of chunks
-                        auto const chunk_size =
-                            get_chunk_size(r.op_state->num_worker_threads, n);
-                        auto const num_chunks =
-                            (n + chunk_size - 1) / chunk_size;
-
                         // Store sent values in the operation state
-                        r.op_state->ts.template emplace<hpx::tuple<Ts...>>(
-                            HPX_FORWARD(Ts, ts)...);
+                        auto& stored_ts =
+                            r.op_state->ts.template emplace<hpx::tuple<Ts...>>(
+                                HPX_FORWARD(Ts, ts)...);
+
+                        // Determine how the shape maps onto the queue indices
+                        // and how large the chunks taken from the queues are.
+                        // This may already execute a number of iterations
+                        // (e.g. for measurements done by auto_chunk_size).
+                        std::uint32_t const first_index =
+                            r.op_state->init_chunking(stored_ts, n);
 
                         // Initialize the queues for all worker threads so that
                         // worker threads can start stealing immediately when
                         // they start.
-                        for (std::size_t worker_thread = 0;
+                        for (std::uint32_t worker_thread = 0;
                              worker_thread < r.op_state->num_worker_threads;
                              ++worker_thread)
                         {
-                            r.init_queue(worker_thread, num_chunks);
+                            r.init_queue(worker_thread, first_index,
+                                r.op_state->num_indices);
                         }
 
                         // Spawn the worker threads for all except the local queue.
                         auto const local_worker_thread =
-                            hpx::get_local_worker_thread_num();
-                        for (std::size_t worker_thread = 0;
+                            static_cast<std::uint32_t>(
+                                hpx::get_local_worker_thread_num());
+                        for (std::uint32_t worker_thread = 0;
                              worker_thread < r.op_state->num_worker_threads;
                              ++worker_thread)
                         {
@@ -464,17 +519,19 @@ namespace hpx { namespace execution { namespace experimental {
                                 continue;
                             }
 
-                            r.do_work_task(n, chunk_size, worker_thread);
+                            r.do_work_task(worker_thread);
                         }
 
                         // Handle the queue for the local thread.
-                        r.do_work_local(n, chunk_size, local_worker_thread);
+                        r.do_work_local(local_worker_thread);
                     }
                 };
 
                 using operation_state_type =
                     hpx::execution::experimental::connect_result_t<Sender,
                         bulk_receiver>;
+                using size_type = decltype(hpx::util::size(
+                    std::declval<std::decay_t<Shape>&>()));
 
                 thread_pool_scheduler scheduler;
                 operation_state_type op_state;
@@ -485,9 +542,27 @@ namespace hpx { namespace execution { namespace experimental {
                     queues{num_worker_threads};
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Shape> shape;
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<F> f;
+                HPX_NO_UNIQUE_ADDRESS std::decay_t<Parameters> params;
                 HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
-                std::atomic<decltype(hpx::util::size(shape))> tasks_remaining{
-                    num_worker_threads};
+
+                // The queues hold indices of blocks of grain_size consecutive
+                // elements of the shape. The grain size is only larger than
+                // one if the shape does not fit into 32 bit indices.
+                size_type num_elements = 0;
+                size_type grain_size = 1;
+                std::uint32_t num_indices = 0;
+
+                // The number of queue indices processed at once if the
+                // executor parameters don't have a variable chunk size.
+                std::uint32_t chunk_size = 1;
+
+                std::size_t num_completion_groups =
+                    (num_worker_threads + completion_group_size - 1) /
+                    completion_group_size;
+                std::vector<
+                    hpx::util::cache_aligned_data<std::atomic<std::size_t>>>
+                    group_tasks_remaining{num_completion_groups};
+                std::atomic<std::size_t> tasks_remaining{num_completion_groups};
                 hpx::util::detail::prepend_t<
                     value_types<hpx::tuple, hpx::variant>, hpx::monostate>
                     ts;
@@ -495,17 +570,148 @@ namespace hpx { namespace execution { namespace experimental {
                 std::optional<std::exception_ptr> exception;
 
                 template <typename Sender_, typename Shape_, typename F_,
-                    typename Receiver_>
+                    typename Parameters_, typename Receiver_>
                 operation_state(thread_pool_scheduler&& scheduler,
                     Sender_&& sender, Shape_&& shape, F_&& f,
-                    Receiver_&& receiver)
+                    Parameters_&& params, Receiver_&& receiver)
                   : scheduler(HPX_MOVE(scheduler))
                   , op_state(hpx::execution::experimental::connect(
                         HPX_FORWARD(Sender_, sender), bulk_receiver{this}))
                   , shape(HPX_FORWARD(Shape_, shape))
                   , f(HPX_FORWARD(F_, f))
+                  , params(HPX_FORWARD(Parameters_, params))
                   , receiver(HPX_FORWARD(Receiver_, receiver))
                 {
+                    for (std::size_t group = 0; group != num_completion_groups;
+                         ++group)
+                    {
+                        group_tasks_remaining[group].data_.store(
+                            (std::min)(completion_group_size,
+                                num_worker_threads -
+                                    group * completion_group_size),
+                            std::memory_order_relaxed);
+                    }
+                }
+
+                // Store an exception and mark that an exception was thrown in
+                // the operation state. This function assumes that there is a
+                // current exception.
+                void store_exception()
+                {
+                    if (!exception_thrown.exchange(true))
+                    {
+                        // NOLINTNEXTLINE(bugprone-throw-keyword-missing)
+                        exception = std::current_exception();
+                    }
+                }
+
+                // Perform the work for the queue indices [first, last). The
+                // indices represent a range of elements (iterators) in the
+                // given shape.
+                template <typename Ts>
+                void do_work_chunk(Ts& ts, std::uint32_t const first,
+                    std::uint32_t const last)
+                {
+                    auto const i_begin =
+                        static_cast<size_type>(first) * grain_size;
+                    auto const i_end = (std::min)(
+                        static_cast<size_type>(last) * grain_size,
+                        num_elements);
+                    auto it = hpx::util::begin(shape);
+                    std::advance(it, i_begin);
+                    for (size_type i = i_begin; i < i_end; ++i)
+                    {
+                        hpx::util::invoke_fused(
+                            hpx::util::bind_front(f, *it), ts);
+                        ++it;
+                    }
+                }
+
+                // Return the number of queue indices to take from the given
+                // queue at once.
+                std::uint32_t get_chunk_size(
+                    hpx::concurrency::detail::contiguous_index_queue<>& queue)
+                {
+                    if constexpr (has_variable_chunk_size)
+                    {
+                        // The remaining work of the queue is distributed
+                        // between all worker threads as they might end up
+                        // stealing from it.
+                        hpx::execution::sequenced_executor exec;
+                        std::size_t const chunk =
+                            hpx::parallel::execution::get_chunk_size(params,
+                                exec, [](std::size_t) { return 0; },
+                                num_worker_threads, queue.size());
+                        return (std::max)(static_cast<std::uint32_t>(chunk),
+                            std::uint32_t(1));
+                    }
+                    else
+                    {
+                        HPX_UNUSED(queue);
+                        return chunk_size;
+                    }
+                }
+
+                // Compute the grain and chunk sizes for the given number of
+                // elements. Returns the first queue index which still has to
+                // be processed, as the executor parameters may execute
+                // iterations for measuring their duration.
+                template <typename Ts>
+                std::uint32_t init_chunking(Ts& ts, size_type const n)
+                {
+                    constexpr size_type max_indices =
+                        (std::numeric_limits<std::uint32_t>::max)() / 2;
+
+                    num_elements = n;
+                    grain_size = (n + max_indices - 1) / max_indices;
+                    num_indices =
+                        static_cast<std::uint32_t>((n + grain_size - 1) /
+                            grain_size);
+
+                    if constexpr (has_variable_chunk_size)
+                    {
+                        return 0;
+                    }
+                    else
+                    {
+                        std::uint32_t first_index = 0;
+                        try
+                        {
+                            // Runs the given number of iterations from the
+                            // beginning of the shape. Executor parameters use
+                            // this to measure the cost of one iteration.
+                            auto test_function =
+                                [&](std::size_t test_chunk_size) {
+                                    auto const last_index = static_cast<
+                                        std::uint32_t>((std::min)(
+                                        static_cast<size_type>(first_index) +
+                                            test_chunk_size,
+                                        static_cast<size_type>(num_indices)));
+                                    do_work_chunk(ts, first_index, last_index);
+                                    auto const num_done =
+                                        last_index - first_index;
+                                    first_index = last_index;
+                                    return static_cast<std::size_t>(num_done);
+                                };
+
+                            // The measurements are run on the calling thread.
+                            hpx::execution::sequenced_executor exec;
+                            std::size_t const chunk =
+                                hpx::parallel::execution::get_chunk_size(params,
+                                    exec, test_function, num_worker_threads,
+                                    static_cast<std::size_t>(num_indices));
+                            chunk_size = static_cast<std::uint32_t>(
+                                (std::max)(std::size_t(1),
+                                    (std::min)(chunk,
+                                        static_cast<std::size_t>(
+                                            num_indices))));
+                        }
+                        catch (...)
+                        {
+                            store_exception();
+                        }
+                        return first_index;
+                    }
                 }
 
                 friend void tag_invoke(start_t, operation_state& os) noexcept
@@ -521,7 +727,7 @@ namespace hpx { namespace execution { namespace experimental {
             {
                 return operation_state<std::decay_t<Receiver>>{
                     HPX_MOVE(s.scheduler), HPX_MOVE(s.sender),
-                    HPX_MOVE(s.shape), HPX_MOVE(s.f),
+                    HPX_MOVE(s.shape), HPX_MOVE(s.f), HPX_MOVE(s.params),
                     HPX_FORWARD(Receiver, receiver)};
             }
 
@@ -530,7 +736,8 @@ namespace hpx { namespace execution { namespace experimental {
                 connect_t, thread_pool_bulk_sender& s, Receiver&& receiver)
             {
                 return operation_state<std::decay_t<Receiver>>{s.scheduler,
-                    s.sender, s.shape, s.f, HPX_FORWARD(Receiver, receiver)};
+                    s.sender, s.shape, s.f, s.params,
+                    HPX_FORWARD(Receiver, receiver)};
             }
         };
     }    // namespace detail
@@ -556,4 +763,41 @@ namespace hpx { namespace execution { namespace experimental {
             HPX_FORWARD(Sender, sender), HPX_FORWARD(Shape, shape),
             HPX_FORWARD(F, f)};
     }
+
+    // The executor parameters object is used to determine the chunk sizes the
+    // bulk work is split into.
+    // clang-format off
+    template <typename Sender, typename Shape, typename F, typename Parameters,
+        HPX_CONCEPT_REQUIRES_(
+            std::is_integral_v<std::decay_t<Shape>> &&
+            hpx::traits::is_executor_parameters_v<Parameters>
+        )>
+    // clang-format on
+    constexpr auto tag_invoke(bulk_t, thread_pool_scheduler scheduler,
+        Sender&& sender, Shape&& shape, F&& f, Parameters&& params)
+    {
+        return detail::thread_pool_bulk_sender<std::decay_t<Sender>,
+            hpx::util::detail::counting_shape_type<std::decay_t<Shape>>,
+            std::decay_t<F>, std::decay_t<Parameters>>{HPX_MOVE(scheduler),
+            HPX_FORWARD(Sender, sender),
+            hpx::util::detail::make_counting_shape(shape), HPX_FORWARD(F, f),
+            HPX_FORWARD(Parameters, params)};
+    }
+
+    // clang-format off
+    template <typename Sender, typename Shape, typename F, typename Parameters,
+        HPX_CONCEPT_REQUIRES_(
+            !std::is_integral_v<std::decay_t<Shape>> &&
+            hpx::traits::is_executor_parameters_v<Parameters>
+        )>
+    // clang-format on
+    constexpr auto tag_invoke(bulk_t, thread_pool_scheduler scheduler,
+        Sender&& sender, Shape&& shape, F&& f, Parameters&& params)
+    {
+        return detail::thread_pool_bulk_sender<std::decay_t<Sender>,
+            std::decay_t<Shape>, std::decay_t<F>, std::decay_t<Parameters>>{
+            HPX_MOVE(scheduler), HPX_FORWARD(Sender, sender),
+            HPX_FORWARD(Shape, shape), HPX_FORWARD(F, f),
+            HPX_FORWARD(Parameters, params)};
+    }
 }}}    // namespace hpx::execution::experimental
@@ -1686,6 +1686,95 @@ void test_bulk()
     }
 }
 
+template <typename Parameters>
+void test_bulk_parameters(Parameters&& params)
+{
+    std::vector<int> const ns = {0, 1, 10, 43, 10007};
+
+    for (int n : ns)
+    {
+        std::vector<std::atomic<int>> v(n);
+        hpx::thread::id parent_id = hpx::this_thread::get_id();
+
+        ex::bulk(
+            ex::schedule(ex::thread_pool_scheduler{}), n,
+            [&](int i) {
+                // make the amount of work per iteration irregular
+                if (i % 97 == 0)
+                {
+                    hpx::this_thread::yield();
+                }
+                ++v[i];
+                HPX_TEST_NEQ(parent_id, hpx::this_thread::get_id());
+            },
+            params) |
+            ex::sync_wait();
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v[i].load(), 1);
+        }
+    }
+
+    for (auto n : ns)
+    {
+        std::vector<int> v(n, -1);
+
+        auto v_out = ex::bulk(
+                         ex::transfer_just(
+                             ex::thread_pool_scheduler{}, std::move(v)),
+                         n, [](int i, std::vector<int>& v) { v[i] = i; },
+                         params) |
+            ex::sync_wait();
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v_out[i], i);
+        }
+    }
+
+    {
+        int const n = 43;
+        int const i_fail = 3;
+
+        try
+        {
+            ex::bulk(
+                ex::transfer_just(ex::thread_pool_scheduler{}), n,
+                [](int i) {
+                    if (i == i_fail)
+                    {
+                        throw std::runtime_error("error");
+                    }
+                },
+                params) |
+                ex::sync_wait();
+
+            HPX_TEST(false);
+        }
+        catch (std::runtime_error const& e)
+        {
+            HPX_TEST_EQ(std::string(e.what()), std::string("error"));
+        }
+    }
+
+    {
+        // The parameters are ignored if the predecessor does not complete on
+        // a scheduler which supports them.
+        int const n = 43;
+        std::vector<int> v(n, 0);
+
+        ex::bulk(
+            ex::just(), n, [&](int i) { ++v[i]; }, params) |
+            ex::sync_wait();
+
+        for (int i = 0; i < n; ++i)
+        {
+            HPX_TEST_EQ(v[i], 1);
+        }
+    }
+}
+
 void test_completion_scheduler()
 {
     {
@@ -1787,6 +1876,9 @@ int hpx_main()
     test_let_error();
     test_detach();
     test_bulk();
+    test_bulk_parameters(hpx::execution::static_chunk_size(7));
+    test_bulk_parameters(hpx::execution::guided_chunk_size());
+    test_bulk_parameters(hpx::execution::auto_chunk_size());
     test_completion_scheduler();
 
     return hpx::local::finalize();
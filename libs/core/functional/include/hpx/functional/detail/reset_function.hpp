@@ -7,8 +7,11 @@
 #pragma once
 
 #include <hpx/functional/function.hpp>
+#include <hpx/functional/task_function.hpp>
 #include <hpx/functional/unique_function.hpp>
 
+#include <cstddef>
+
 namespace hpx { namespace util { namespace detail {
     template <typename Sig, bool Serializable>
     inline void reset_function(hpx::util::function<Sig, Serializable>& f)
@@ -34,6 +37,12 @@ namespace hpx { namespace util { namespace detail {
         f.reset();
     }
 
+    template <typename Sig, std::size_t StorageSize>
+    inline void reset_function(hpx::util::task_function<Sig, StorageSize>& f)
+    {
+        f.reset();
+    }
+
     template <typename Function>
     inline void reset_function(Function& f)
     {
@@ -0,0 +1,279 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/detail/basic_function.hpp>
+#include <hpx/functional/detail/empty_function.hpp>
+#include <hpx/functional/detail/vtable/function_vtable.hpp>
+#include <hpx/functional/detail/vtable/vtable.hpp>
+#include <hpx/functional/traits/get_function_address.hpp>
+#include <hpx/functional/traits/get_function_annotation.hpp>
+#include <hpx/functional/traits/is_invocable.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace util {
+    ///////////////////////////////////////////////////////////////////////////
+    /// A move-only, non-serializable type erased callable similar to
+    /// \a unique_function_nonser. It differs in the size of the embedded
+    /// storage, which is given by \a StorageSize (in bytes) and defaults to
+    /// HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE. This is used for the functions
+    /// executed by HPX threads, which are stored in the (recycled) thread
+    /// objects, such that creating a thread does not have to allocate memory
+    /// for capturing lambdas of typical sizes.
+    template <typename Sig,
+        std::size_t StorageSize = HPX_HAVE_THREAD_FUNCTION_STORAGE_SIZE>
+    class task_function;
+
+    template <typename R, typename... Ts, std::size_t StorageSize>
+    class task_function<R(Ts...), StorageSize>
+    {
+        using vtable = detail::function_vtable<R(Ts...), false>;
+
+        static_assert(StorageSize >= detail::function_storage_size,
+            "the storage of a task_function should be at least as large as "
+            "the one of a unique_function");
+
+    public:
+        using result_type = R;
+
+        static constexpr std::size_t storage_size = StorageSize;
+
+        constexpr task_function(std::nullptr_t = nullptr) noexcept
+          : vptr(get_empty_vtable())
+          , object(nullptr)
+          , storage_init()
+        {
+        }
+
+        task_function(task_function&& other) noexcept
+          : vptr(other.vptr)
+          , object(other.object)
+        {
+            if (object == &other.storage)
+            {
+                std::memcpy(storage, other.storage, storage_size);
+                object = &storage;
+            }
+            other.vptr = get_empty_vtable();
+            other.object = nullptr;
+        }
+
+        task_function& operator=(task_function&& other) noexcept
+        {
+            if (this != &other)
+            {
+                swap(other);
+                other.reset();
+            }
+            return *this;
+        }
+
+        // the split SFINAE prevents MSVC from eagerly instantiating things
+        template <typename F, typename FD = typename std::decay<F>::type,
+            typename Enable1 = typename std::enable_if<
+                !std::is_same<FD, task_function>::value>::type,
+            typename Enable2 =
+                typename std::enable_if<is_invocable_r_v<R, FD&, Ts...>>::type>
+        task_function(F&& f)
+          : task_function()
+        {
+            assign(HPX_FORWARD(F, f));
+        }
+
+        // the split SFINAE prevents MSVC from eagerly instantiating things
+        template <typename F, typename FD = typename std::decay<F>::type,
+            typename Enable1 = typename std::enable_if<
+                !std::is_same<FD, task_function>::value>::type,
+            typename Enable2 =
+                typename std::enable_if<is_invocable_r_v<R, FD&, Ts...>>::type>
+        task_function& operator=(F&& f)
+        {
+            assign(HPX_FORWARD(F, f));
+            return *this;
+        }
+
+        ~task_function()
+        {
+            destroy();
+        }
+
+        void assign(std::nullptr_t) noexcept
+        {
+            reset();
+        }
+
+        template <typename F>
+        void assign(F&& f)
+        {
+            using T = typename std::decay<F>::type;
+
+            if (!detail::is_empty_function(f))
+            {
+                vtable const* f_vptr = get_vtable<T>();
+                void* buffer = nullptr;
+                if (vptr == f_vptr)
+                {
+                    HPX_ASSERT(object != nullptr);
+                    // reuse object storage
+                    buffer = object;
+                    vtable::template get<T>(object).~T();
+                }
+                else
+                {
+                    destroy();
+                    vptr = f_vptr;
+                    buffer =
+                        vtable::template allocate<T>(storage, storage_size);
+                }
+                object = ::new (buffer) T(HPX_FORWARD(F, f));
+            }
+            else
+            {
+                reset();
+            }
+        }
+
+        void reset() noexcept
+        {
+            destroy();
+            vptr = get_empty_vtable();
+            object = nullptr;
+        }
+
+        void swap(task_function& f) noexcept
+        {
+            std::swap(vptr, f.vptr);
+            std::swap(object, f.object);
+            std::swap(storage, f.storage);
+            if (object == &f.storage)
+                object = &storage;
+            if (f.object == &storage)
+                f.object = &f.storage;
+        }
+
+        bool empty() const noexcept
+        {
+            return object == nullptr;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return !empty();
+        }
+
+        // returns whether the wrapped callable is held in the embedded
+        // storage (i.e. no memory was allocated for it)
+        bool is_inline() const noexcept
+        {
+            return object == &storage;
+        }
+
+        HPX_FORCEINLINE R operator()(Ts... vs) const
+        {
+            return vptr->invoke(object, HPX_FORWARD(Ts, vs)...);
+        }
+
+        std::size_t get_function_address() const
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            return vptr->get_function_address(object);
+#else
+            return 0;
+#endif
+        }
+
+        char const* get_function_annotation() const
+        {
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+            return vptr->get_function_annotation(object);
+#else
+            return nullptr;
+#endif
+        }
+
+        util::itt::string_handle get_function_annotation_itt() const
+        {
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+            return vptr->get_function_annotation_itt(object);
+#else
+            return util::itt::string_handle{};
+#endif
+        }
+
+    private:
+        void destroy() noexcept
+        {
+            if (object != nullptr)
+            {
+                vptr->deallocate(object, storage_size, /*destroy*/ true);
+            }
+        }
+
+        static constexpr vtable const* get_empty_vtable() noexcept
+        {
+            return detail::get_empty_function_vtable<R(Ts...)>();
+        }
+
+        template <typename T>
+        static vtable const* get_vtable() noexcept
+        {
+            return detail::get_vtable<vtable, T>();
+        }
+
+        vtable const* vptr;
+        void* object;
+        union
+        {
+            char storage_init;
+            mutable unsigned char storage[storage_size];
+        };
+    };
+}}    // namespace hpx::util
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace traits {
+    template <typename Sig, std::size_t StorageSize>
+    struct get_function_address<util::task_function<Sig, StorageSize>>
+    {
+        static constexpr std::size_t call(
+            util::task_function<Sig, StorageSize> const& f) noexcept
+        {
+            return f.get_function_address();
+        }
+    };
+
+    template <typename Sig, std::size_t StorageSize>
+    struct get_function_annotation<util::task_function<Sig, StorageSize>>
+    {
+        static constexpr char const* call(
+            util::task_function<Sig, StorageSize> const& f) noexcept
+        {
+            return f.get_function_annotation();
+        }
+    };
+
+#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
+    template <typename Sig, std::size_t StorageSize>
+    struct get_function_annotation_itt<util::task_function<Sig, StorageSize>>
+    {
+        static util::itt::string_handle call(
+            util::task_function<Sig, StorageSize> const& f) noexcept
+        {
+            return f.get_function_annotation_itt();
+        }
+    };
+#endif
+}}    // namespace hpx::traits
+#endif
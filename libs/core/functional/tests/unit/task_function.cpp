@@ -0,0 +1,109 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/functional/task_function.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+int instances = 0;
+
+template <std::size_t N>
+struct payload
+{
+    payload()
+    {
+        ++instances;
+    }
+    payload(payload const&)
+    {
+        ++instances;
+    }
+    payload(payload&&)
+    {
+        ++instances;
+    }
+    ~payload()
+    {
+        --instances;
+    }
+
+    int operator()(int i) const
+    {
+        return i + static_cast<int>(N);
+    }
+
+    unsigned char data[N] = {};
+};
+
+using task_function = hpx::util::task_function<int(int)>;
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    // callables which fit into the embedded storage are held inline
+    {
+        task_function f = payload<64>();
+        HPX_TEST(!f.empty());
+        HPX_TEST(f.is_inline());
+        HPX_TEST_EQ(f(1), 65);
+        HPX_TEST_EQ(instances, 1);
+
+        // moving an inline callable relocates it
+        task_function g(std::move(f));
+        HPX_TEST(f.empty());
+        HPX_TEST(g.is_inline());
+        HPX_TEST_EQ(g(2), 66);
+        HPX_TEST_EQ(instances, 1);
+    }
+    HPX_TEST_EQ(instances, 0);
+
+    // larger callables are allocated
+    {
+        task_function f =
+            payload<hpx::util::task_function<int(int)>::storage_size + 1>();
+        HPX_TEST(!f.empty());
+        HPX_TEST(!f.is_inline());
+        HPX_TEST_EQ(f(0), static_cast<int>(task_function::storage_size + 1));
+
+        task_function g;
+        HPX_TEST(g.empty());
+        g = std::move(f);
+        HPX_TEST(f.empty());
+        HPX_TEST(!g.is_inline());
+        HPX_TEST_EQ(instances, 1);
+
+        g.reset();
+        HPX_TEST(g.empty());
+        HPX_TEST_EQ(instances, 0);
+    }
+
+    // the storage size can be customized
+    {
+        hpx::util::task_function<int(int), 128> f = payload<120>();
+        HPX_TEST(f.is_inline());
+        HPX_TEST_EQ(f(0), 120);
+    }
+    HPX_TEST_EQ(instances, 0);
+
+    // move-only callables are supported
+    {
+        std::unique_ptr<int> p(new int(42));
+        task_function f = [p = std::move(p)](int i) { return *p + i; };
+        HPX_TEST(f.is_inline());
+        HPX_TEST_EQ(f(1), 43);
+
+        task_function g;
+        g.swap(f);
+        HPX_TEST(f.empty());
+        HPX_TEST_EQ(g(2), 44);
+    }
+
+    return hpx::util::report_errors();
+}
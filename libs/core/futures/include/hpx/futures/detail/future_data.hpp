@@ -13,6 +13,7 @@
 #include <hpx/datastructures/detail/small_vector.hpp>
 #include <hpx/errors/try_catch_exception_ptr.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
 #include <hpx/futures/future_fwd.hpp>
 #include <hpx/futures/traits/future_access.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
@@ -32,6 +33,7 @@
 #include <exception>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <string>
 #include <type_traits>
 #include <utility>
@@ -110,6 +112,36 @@ namespace hpx { namespace lcos { namespace detail {
             delete this;
         }
 
+#if defined(HPX_HAVE_FUTURE_SHARED_STATE_POOL)
+        // shared states created using new are recycled through per-thread
+        // pools, shared states using an allocator are not affected
+        static void* operator new(std::size_t size)
+        {
+            return shared_state_pool::allocate(size);
+        }
+        static void operator delete(void* p, std::size_t size) noexcept
+        {
+            shared_state_pool::deallocate(p, size);
+        }
+
+        // over-aligned shared states bypass the pool
+        static void* operator new(std::size_t size, std::align_val_t al)
+        {
+            return ::operator new(size, al);
+        }
+        static void operator delete(
+            void* p, std::size_t, std::align_val_t al) noexcept
+        {
+            ::operator delete(p, al);
+        }
+
+        static void* operator new(std::size_t, void* p) noexcept
+        {
+            return p;
+        }
+        static void operator delete(void*, void*) noexcept {}
+#endif
+
         // This is a tag type used to convey the information that the caller is
         // _not_ going to addref the future_data instance
         struct init_no_addref
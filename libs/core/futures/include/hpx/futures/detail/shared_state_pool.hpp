@@ -0,0 +1,33 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::lcos::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Memory for the shared states of futures (and for everything derived
+    // from those, like continuations and dataflow frames) is taken from
+    // per-thread free lists of fixed size classes. Released blocks are kept
+    // by the thread that releases them, the lists are bounded in size. The
+    // memory of blocks not fitting any size class is directly returned to
+    // the system.
+    struct HPX_CORE_EXPORT shared_state_pool
+    {
+        [[nodiscard]] static void* allocate(std::size_t size);
+        static void deallocate(void* p, std::size_t size) noexcept;
+
+        // statistics, accumulated over all threads
+        static std::int64_t get_allocation_count(bool reset);
+        static std::int64_t get_pool_hit_count(bool reset);
+        static std::int64_t get_recycled_count(bool reset);
+    };
+}    // namespace hpx::lcos::detail
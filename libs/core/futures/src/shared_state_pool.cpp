@@ -0,0 +1,219 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace hpx::lcos::detail {
+
+    namespace {
+
+        // size classes are multiples of this granularity
+        constexpr std::size_t granularity = 32;
+
+        // shared states of up to 512 bytes are pooled
+        constexpr std::size_t num_size_classes = 16;
+
+        // maximal number of blocks cached per size class and thread
+        constexpr std::size_t max_cached_blocks = 256;
+
+        struct free_block
+        {
+            free_block* next_;
+        };
+
+        // the counters are uncontended, they are modified by the owning
+        // thread and reset only while the statistics are being queried
+        inline void increment(std::atomic<std::int64_t>& counter) noexcept
+        {
+            counter.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        struct thread_cache;
+
+        struct cache_registry
+        {
+            std::mutex mtx_;
+            std::vector<thread_cache*> caches_;
+
+            // statistics of threads that have exited already
+            std::int64_t allocations_ = 0;
+            std::int64_t pool_hits_ = 0;
+            std::int64_t recycled_ = 0;
+        };
+
+        cache_registry& get_registry()
+        {
+            static cache_registry registry;
+            return registry;
+        }
+
+        // set once the cache of the current thread has been destroyed, this
+        // is needed as shared states may be released by other thread_local
+        // objects during thread exit
+        thread_local bool cache_destroyed = false;
+
+        struct thread_cache
+        {
+            thread_cache()
+            {
+                cache_registry& registry = get_registry();
+
+                std::lock_guard<std::mutex> l(registry.mtx_);
+                registry.caches_.push_back(this);
+            }
+
+            ~thread_cache()
+            {
+                {
+                    cache_registry& registry = get_registry();
+
+                    std::lock_guard<std::mutex> l(registry.mtx_);
+                    registry.caches_.erase(std::find(registry.caches_.begin(),
+                        registry.caches_.end(), this));
+
+                    registry.allocations_ += allocations_.load();
+                    registry.pool_hits_ += pool_hits_.load();
+                    registry.recycled_ += recycled_.load();
+                }
+
+                for (free_block* head : heads_)
+                {
+                    while (head != nullptr)
+                    {
+                        free_block* next = head->next_;
+                        ::operator delete(head);
+                        head = next;
+                    }
+                }
+
+                cache_destroyed = true;
+            }
+
+            free_block* heads_[num_size_classes] = {};
+            std::size_t counts_[num_size_classes] = {};
+
+            std::atomic<std::int64_t> allocations_{0};
+            std::atomic<std::int64_t> pool_hits_{0};
+            std::atomic<std::int64_t> recycled_{0};
+        };
+
+        thread_cache* get_thread_cache()
+        {
+            if (cache_destroyed)
+                return nullptr;
+
+            static thread_local thread_cache cache;
+            return &cache;
+        }
+
+        std::int64_t accumulate(std::atomic<std::int64_t> thread_cache::*value,
+            std::int64_t cache_registry::*retired, bool reset)
+        {
+            cache_registry& registry = get_registry();
+
+            std::lock_guard<std::mutex> l(registry.mtx_);
+
+            std::int64_t result = registry.*retired;
+            if (reset)
+                registry.*retired = 0;
+
+            for (thread_cache* cache : registry.caches_)
+            {
+                result += reset ? (cache->*value).exchange(0) :
+                                  (cache->*value).load();
+            }
+            return result;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void* shared_state_pool::allocate(std::size_t size)
+    {
+        std::size_t const size_class = (size - 1) / granularity;
+        if (size_class >= num_size_classes)
+        {
+            thread_cache* cache = get_thread_cache();
+            if (cache != nullptr)
+            {
+                increment(cache->allocations_);
+            }
+            return ::operator new(size);
+        }
+
+        // Blocks are always allocated with the full size of their size class
+        // as they might be recycled by another thread which has a cache.
+        thread_cache* cache = get_thread_cache();
+        if (cache == nullptr)
+        {
+            return ::operator new((size_class + 1) * granularity);
+        }
+
+        increment(cache->allocations_);
+
+        free_block* block = cache->heads_[size_class];
+        if (block != nullptr)
+        {
+            cache->heads_[size_class] = block->next_;
+            --cache->counts_[size_class];
+            increment(cache->pool_hits_);
+            return block;
+        }
+
+        return ::operator new((size_class + 1) * granularity);
+    }
+
+    void shared_state_pool::deallocate(void* p, std::size_t size) noexcept
+    {
+        std::size_t const size_class = (size - 1) / granularity;
+
+        thread_cache* cache = nullptr;
+        if (size_class < num_size_classes)
+        {
+            cache = get_thread_cache();
+        }
+
+        if (cache == nullptr ||
+            cache->counts_[size_class] == max_cached_blocks)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        free_block* block = static_cast<free_block*>(p);
+        block->next_ = cache->heads_[size_class];
+        cache->heads_[size_class] = block;
+        ++cache->counts_[size_class];
+        increment(cache->recycled_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::int64_t shared_state_pool::get_allocation_count(bool reset)
+    {
+        return accumulate(&thread_cache::allocations_,
+            &cache_registry::allocations_, reset);
+    }
+
+    std::int64_t shared_state_pool::get_pool_hit_count(bool reset)
+    {
+        return accumulate(
+            &thread_cache::pool_hits_, &cache_registry::pool_hits_, reset);
+    }
+
+    std::int64_t shared_state_pool::get_recycled_count(bool reset)
+    {
+        return accumulate(
+            &thread_cache::recycled_, &cache_registry::recycled_, reset);
+    }
+}    // namespace hpx::lcos::detail
@@ -0,0 +1,90 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+using hpx::lcos::detail::shared_state_pool;
+
+///////////////////////////////////////////////////////////////////////////////
+struct alignas(128) overaligned
+{
+    int value = 42;
+};
+
+void test_recycling()
+{
+    constexpr std::int64_t count = 100;
+
+    shared_state_pool::get_allocation_count(true);
+    shared_state_pool::get_pool_hit_count(true);
+    shared_state_pool::get_recycled_count(true);
+
+    for (std::int64_t i = 0; i != count; ++i)
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::future<int> f = p.get_future();
+        p.set_value(static_cast<int>(i));
+        HPX_TEST_EQ(f.get(), static_cast<int>(i));
+    }
+
+    HPX_TEST_LTE(count, shared_state_pool::get_allocation_count(false));
+    HPX_TEST_LTE(count - 1, shared_state_pool::get_pool_hit_count(false));
+    HPX_TEST_LTE(count, shared_state_pool::get_recycled_count(false));
+
+    // continuations are pooled as well
+    for (std::int64_t i = 0; i != count; ++i)
+    {
+        hpx::future<int> f = hpx::make_ready_future(static_cast<int>(i))
+                                 .then(hpx::launch::sync,
+                                     [](hpx::future<int>&& f) {
+                                         return f.get() + 1;
+                                     });
+        HPX_TEST_EQ(f.get(), static_cast<int>(i + 1));
+    }
+
+    HPX_TEST_LTE(3 * count, shared_state_pool::get_allocation_count(false));
+}
+
+void test_unpooled()
+{
+    // over-aligned shared states bypass the pool
+    {
+        hpx::future<overaligned> f = hpx::make_ready_future(overaligned{});
+        HPX_TEST_EQ(f.get().value, 42);
+    }
+
+    // shared states larger than the largest size class are not recycled
+    {
+        std::array<char, 4096> data{};
+        data[0] = 'x';
+        hpx::future<std::array<char, 4096>> f = hpx::make_ready_future(data);
+        HPX_TEST_EQ(f.get()[0], 'x');
+    }
+}
+
+int hpx_main()
+{
+#if defined(HPX_HAVE_FUTURE_SHARED_STATE_POOL)
+    test_recycling();
+#endif
+    test_unpooled();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
@@ -13,6 +13,7 @@
 #include <hpx/runtime_local/get_locality_id.hpp>
 #include <hpx/runtime_local/get_worker_thread_num.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/util/get_entry_as.hpp>
 
 #include <cstddef>
 #include <cstdint>
@@ -914,6 +915,36 @@ namespace hpx { namespace util {
                 lvl, HPX_MOVE(settings.dest_), HPX_MOVE(settings.format_));
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Let a background thread write the messages of the normal logs if
+        // requested. Error logs are always written synchronously to make sure
+        // those are not lost.
+        void init_async_logging(runtime_configuration& ini)
+        {
+            bool const async =
+                get_entry_as<int>(ini, "hpx.logging.async", 0) != 0;
+
+            agas_logger()->writer().set_async(async);
+            parcel_logger()->writer().set_async(async);
+            timing_logger()->writer().set_async(async);
+            hpx_logger()->writer().set_async(async);
+            app_logger()->writer().set_async(async);
+            debuglog_logger()->writer().set_async(async);
+
+            if (async)
+            {
+                logging::start_async_logging(
+                    get_entry_as<std::size_t>(
+                        ini, "hpx.logging.async_buffer_size", 4096),
+                    logging::get_overflow_policy(
+                        ini.get_entry("hpx.logging.async_overflow", "block")));
+            }
+            else
+            {
+                logging::stop_async_logging();
+            }
+        }
+
         ///////////////////////////////////////////////////////////////////////
         static void (*default_set_console_dest)(logger_writer_type&,
             char const*, logging::level,
@@ -951,6 +982,8 @@ namespace hpx { namespace util {
             init_hpx_console_log(ini);
             init_app_console_log(ini);
             init_debuglog_console_log(ini);
+
+            init_async_logging(ini);
         }
 
         void init_logging_local(runtime_configuration& ini)
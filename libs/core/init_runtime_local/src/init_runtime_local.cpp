@@ -18,6 +18,7 @@
 #include <hpx/init_runtime_local/detail/init_logging.hpp>
 #include <hpx/init_runtime_local/init_runtime_local.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/logging/detail/async_writer.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/filesystem.hpp>
 #include <hpx/modules/format.hpp>
@@ -284,6 +285,11 @@ namespace hpx {
                 if (!!shutdown)
                     rt.add_shutdown_function(HPX_MOVE(shutdown));
 
+                // write the log messages still queued for the background thread and
+                // stop it, the runtime writes its remaining messages synchronously
+                if (util::logging::is_async_logging_enabled())
+                    rt.add_shutdown_function(&util::logging::stop_async_logging);
+
                 if (vm.count("hpx:dump-config-initial"))
                 {
                     std::cout << "Configuration after runtime construction:\n";
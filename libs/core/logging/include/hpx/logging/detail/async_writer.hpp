@@ -0,0 +1,59 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx { namespace util { namespace logging {
+
+    class message;
+
+    namespace writer {
+        struct named_write;
+    }
+
+    /// Specifies what happens to a log message if the buffer of the calling
+    /// thread is full while asynchronous logging is enabled.
+    enum class overflow_policy
+    {
+        block,    ///< wait for the background thread to make room
+        drop      ///< drop the message (and count it as dropped)
+    };
+
+    /// Convert the given string ("block" or "drop") into an overflow policy,
+    /// anything else is interpreted as \a overflow_policy::block.
+    HPX_CORE_EXPORT overflow_policy get_overflow_policy(std::string const& s);
+
+    /// Start the background thread that writes log messages to their
+    /// destinations. Each OS thread that logs gets its own buffer able to
+    /// hold \a buffer_size messages.
+    HPX_CORE_EXPORT void start_async_logging(
+        std::size_t buffer_size, overflow_policy policy);
+
+    /// Write all pending log messages and stop the background thread. Further
+    /// log messages are written synchronously again.
+    HPX_CORE_EXPORT void stop_async_logging();
+
+    /// Return whether the background thread is currently running.
+    HPX_CORE_EXPORT bool is_async_logging_enabled() noexcept;
+
+    /// Return the number of log messages dropped so far because of a full
+    /// buffer.
+    HPX_CORE_EXPORT std::uint64_t get_async_logging_dropped_count() noexcept;
+
+    namespace detail {
+
+        // Hand the formatted message over to the background thread. Returns
+        // false if the message has to be written synchronously by the caller.
+        HPX_CORE_EXPORT bool async_write(
+            writer::named_write const& writer, message const& formatted);
+    }    // namespace detail
+}}}      // namespace hpx::util::logging
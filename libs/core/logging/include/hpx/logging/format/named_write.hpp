@@ -17,9 +17,11 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/logging/detail/async_writer.hpp>
 #include <hpx/logging/format/destinations.hpp>
 #include <hpx/logging/format/formatters.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <sstream>
@@ -393,6 +395,15 @@ This will just configure "file" twice, ending up with writing only to "two.txt"
             destination(destination_str);
         }
 
+        /** @brief Enables handing the formatted messages over to the
+    background thread (if running) instead of writing them to the destinations
+    directly. The message is always formatted on the calling thread.
+    */
+        void set_async(bool async) noexcept
+        {
+            m_async.store(async, std::memory_order_relaxed);
+        }
+
         void operator()(message const& msg) const
         {
             std::stringstream out;
@@ -400,10 +411,19 @@ This will just configure "file" twice, ending up with writing only to "two.txt"
 
 #if defined(HPX_COMPUTE_HOST_CODE)
             message formatted(HPX_MOVE(out));
-            m_destination(formatted);
+            if (!m_async.load(std::memory_order_relaxed) ||
+                !detail::async_write(*this, formatted))
+                m_destination(formatted);
 #endif
         }
 
+        /** @brief Writes an already formatted message to the destinations
+    */
+        void write_destinations(message const& formatted) const
+        {
+            m_destination(formatted);
+        }
+
         /** @brief Replaces a formatter from the named formatter.
 
     You can use this, for instance, when you want to share
@@ -451,6 +471,8 @@ This will just configure "file" twice, ending up with writing only to "two.txt"
 
         std::string m_format_str;
         std::string m_destination_str;
+
+        std::atomic<bool> m_async{false};
     };
 
 }}}}    // namespace hpx::util::logging::writer
@@ -0,0 +1,374 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/logging/detail/async_writer.hpp>
+#include <hpx/logging/format/named_write.hpp>
+#include <hpx/logging/message.hpp>
+#include <hpx/thread_support/set_thread_name.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util { namespace logging {
+
+    namespace {
+
+        // this module can't depend on the concurrency module
+        constexpr std::size_t cache_line_size = 64;
+
+        struct log_record
+        {
+            writer::named_write const* writer = nullptr;
+            std::string text;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Single-producer/single-consumer ring buffer holding the already
+        // formatted messages of one OS thread.
+        class ring_buffer
+        {
+            static std::size_t round_up_to_power_of_two(std::size_t n)
+            {
+                std::size_t result = 1;
+                while (result < n)
+                    result <<= 1;
+                return result;
+            }
+
+        public:
+            explicit ring_buffer(std::size_t capacity)
+              : records_(
+                    round_up_to_power_of_two(capacity < 2 ? 2 : capacity))
+              , mask_(records_.size() - 1)
+            {
+            }
+
+            // called by the owning thread only
+            bool push(writer::named_write const* writer, std::string&& text)
+            {
+                std::size_t const tail = tail_.load(std::memory_order_relaxed);
+                if (tail - head_.load(std::memory_order_acquire) ==
+                    records_.size())
+                {
+                    return false;    // full
+                }
+
+                log_record& r = records_[tail & mask_];
+                r.writer = writer;
+                r.text = HPX_MOVE(text);
+
+                tail_.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+
+            // called by the background thread only
+            template <typename F>
+            std::size_t consume(F&& f)
+            {
+                std::size_t const head = head_.load(std::memory_order_relaxed);
+                std::size_t const tail = tail_.load(std::memory_order_acquire);
+
+                for (std::size_t i = head; i != tail; ++i)
+                {
+                    log_record& r = records_[i & mask_];
+                    f(r);
+                    r.writer = nullptr;
+                    std::string().swap(r.text);
+                }
+
+                head_.store(tail, std::memory_order_release);
+                return tail - head;
+            }
+
+            bool empty() const noexcept
+            {
+                return head_.load(std::memory_order_acquire) ==
+                    tail_.load(std::memory_order_acquire);
+            }
+
+            // set once the owning thread has exited
+            std::atomic<bool> orphaned{false};
+
+        private:
+            std::vector<log_record> records_;
+            std::size_t mask_;
+
+            alignas(cache_line_size) std::atomic<std::size_t> head_{0};
+            alignas(cache_line_size) std::atomic<std::size_t> tail_{0};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // The buffer of the current thread, it is handed over to the
+        // background thread once this thread exits.
+        struct thread_buffer
+        {
+            ~thread_buffer()
+            {
+                if (buffer)
+                    buffer->orphaned.store(true, std::memory_order_release);
+            }
+
+            std::shared_ptr<ring_buffer> buffer;
+            std::size_t generation = 0;
+        };
+
+        thread_local thread_buffer this_thread_buffer;
+
+        ///////////////////////////////////////////////////////////////////////
+        class async_logger
+        {
+        public:
+            static async_logger& instance()
+            {
+                static async_logger logger;
+                return logger;
+            }
+
+            ~async_logger()
+            {
+                stop();
+            }
+
+            void start(std::size_t buffer_size, overflow_policy policy)
+            {
+                stop();
+
+                std::lock_guard<std::mutex> l(mtx_);
+
+                // writers read the configuration without holding the lock,
+                // the new generation publishes it
+                buffer_size_.store(buffer_size, std::memory_order_relaxed);
+                policy_.store(policy, std::memory_order_relaxed);
+                generation_.fetch_add(1, std::memory_order_release);
+                stop_requested_ = false;
+
+                thread_ = std::thread(&async_logger::run, this);
+                running_.store(true, std::memory_order_release);
+            }
+
+            void stop()
+            {
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    if (!thread_.joinable())
+                        return;
+
+                    running_.store(false, std::memory_order_release);
+                    stop_requested_ = true;
+                }
+                cond_.notify_all();
+                thread_.join();
+
+                // wait for writers which have seen the background thread
+                // running, write everything that is left
+                while (active_writers_.load(std::memory_order_acquire) != 0)
+                {
+                    std::this_thread::yield();
+                }
+                drain();
+            }
+
+            bool running() const noexcept
+            {
+                return running_.load(std::memory_order_acquire);
+            }
+
+            std::uint64_t dropped() const noexcept
+            {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            bool write(
+                writer::named_write const& writer, message const& formatted)
+            {
+                active_writers_.fetch_add(1, std::memory_order_acq_rel);
+                if (!running())
+                {
+                    active_writers_.fetch_sub(1, std::memory_order_release);
+                    return false;
+                }
+
+                bool const result = push(writer, formatted);
+                active_writers_.fetch_sub(1, std::memory_order_release);
+                return result;
+            }
+
+        private:
+            async_logger() = default;
+
+            bool push(
+                writer::named_write const& writer, message const& formatted)
+            {
+                ring_buffer& buffer = get_thread_buffer();
+
+                std::string text = formatted.full_string();
+                while (!buffer.push(&writer, HPX_MOVE(text)))
+                {
+                    if (policy_.load(std::memory_order_relaxed) ==
+                        overflow_policy::drop)
+                    {
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                        return true;
+                    }
+
+                    // let the background thread make room
+                    cond_.notify_one();
+                    std::this_thread::yield();
+
+                    if (!running())
+                        return false;
+                }
+                return true;
+            }
+
+            ring_buffer& get_thread_buffer()
+            {
+                thread_buffer& tb = this_thread_buffer;
+                std::size_t const generation =
+                    generation_.load(std::memory_order_acquire);
+                if (!tb.buffer || tb.generation != generation)
+                {
+                    if (tb.buffer)
+                    {
+                        tb.buffer->orphaned.store(
+                            true, std::memory_order_release);
+                    }
+
+                    tb.buffer = std::make_shared<ring_buffer>(
+                        buffer_size_.load(std::memory_order_relaxed));
+                    tb.generation = generation;
+
+                    std::lock_guard<std::mutex> l(buffers_mtx_);
+                    buffers_.push_back(tb.buffer);
+                }
+                return *tb.buffer;
+            }
+
+            // write all pending messages, returns whether there were any
+            bool drain()
+            {
+                std::vector<std::shared_ptr<ring_buffer>> buffers;
+                {
+                    std::lock_guard<std::mutex> l(buffers_mtx_);
+                    buffers = buffers_;
+                }
+
+                std::size_t count = 0;
+                bool has_orphans = false;
+                for (auto const& buffer : buffers)
+                {
+                    count += buffer->consume([](log_record& r) {
+                        std::stringstream text(HPX_MOVE(r.text));
+                        r.writer->write_destinations(message(HPX_MOVE(text)));
+                    });
+                    has_orphans = has_orphans ||
+                        buffer->orphaned.load(std::memory_order_acquire);
+                }
+
+                // release the buffers of exited threads
+                if (has_orphans)
+                {
+                    std::lock_guard<std::mutex> l(buffers_mtx_);
+                    for (auto it = buffers_.begin(); it != buffers_.end();)
+                    {
+                        if ((*it)->orphaned.load(std::memory_order_acquire) &&
+                            (*it)->empty())
+                        {
+                            it = buffers_.erase(it);
+                        }
+                        else
+                        {
+                            ++it;
+                        }
+                    }
+                }
+
+                return count != 0;
+            }
+
+            void run()
+            {
+                hpx::util::set_thread_name("hpx/logging");
+
+                std::unique_lock<std::mutex> l(mtx_);
+                while (!stop_requested_)
+                {
+                    l.unlock();
+                    bool const written = drain();
+                    l.lock();
+
+                    if (!written)
+                    {
+                        cond_.wait_for(l, std::chrono::milliseconds(1));
+                    }
+                }
+            }
+
+        private:
+            std::mutex mtx_;
+            std::condition_variable cond_;
+            std::thread thread_;
+            bool stop_requested_ = false;
+
+            std::atomic<bool> running_{false};
+            std::atomic<std::size_t> active_writers_{0};
+            std::atomic<std::uint64_t> dropped_{0};
+
+            std::atomic<std::size_t> buffer_size_{0};
+            std::atomic<overflow_policy> policy_{overflow_policy::block};
+            std::atomic<std::size_t> generation_{0};
+
+            std::mutex buffers_mtx_;
+            std::vector<std::shared_ptr<ring_buffer>> buffers_;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    overflow_policy get_overflow_policy(std::string const& s)
+    {
+        return s == "drop" ? overflow_policy::drop : overflow_policy::block;
+    }
+
+    void start_async_logging(std::size_t buffer_size, overflow_policy policy)
+    {
+        async_logger::instance().start(buffer_size, policy);
+    }
+
+    void stop_async_logging()
+    {
+        async_logger::instance().stop();
+    }
+
+    bool is_async_logging_enabled() noexcept
+    {
+        return async_logger::instance().running();
+    }
+
+    std::uint64_t get_async_logging_dropped_count() noexcept
+    {
+        return async_logger::instance().dropped();
+    }
+
+    namespace detail {
+
+        bool async_write(
+            writer::named_write const& writer, message const& formatted)
+        {
+            return async_logger::instance().write(writer, formatted);
+        }
+    }    // namespace detail
+}}}    // namespace hpx::util::logging
@@ -0,0 +1,241 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/logging/detail/async_writer.hpp>
+#include <hpx/logging/format/named_write.hpp>
+#include <hpx/logging/manipulator.hpp>
+#include <hpx/logging/message.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace logging = hpx::util::logging;
+
+///////////////////////////////////////////////////////////////////////////////
+// Destination collecting all messages written to it, optionally blocking
+// until it is released.
+struct captured_messages
+{
+    std::mutex mtx;
+    std::vector<std::string> messages;
+    std::vector<std::thread::id> writers;
+
+    std::atomic<bool> block{false};
+    std::atomic<bool> blocked{false};
+};
+
+struct capture : logging::destination::manipulator
+{
+    explicit capture(captured_messages& captured)
+      : captured(captured)
+    {
+    }
+
+    void operator()(logging::message const& msg) override
+    {
+        while (captured.block.load())
+        {
+            captured.blocked = true;
+            std::this_thread::yield();
+        }
+
+        std::lock_guard<std::mutex> l(captured.mtx);
+        captured.messages.push_back(msg.full_string());
+        captured.writers.push_back(std::this_thread::get_id());
+    }
+
+    captured_messages& captured;
+};
+
+void make_writer(logging::writer::named_write& writer, captured_messages& c)
+{
+    writer.set_destination("capture", capture(c));
+    writer.write("|", "capture");
+    writer.set_async(true);
+}
+
+void log(logging::writer::named_write const& writer, std::string const& text)
+{
+    logging::message msg;
+    msg << text;
+    writer(msg);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// messages are written in order by the background thread, all pending
+// messages are written when logging is stopped
+void test_ordering()
+{
+    captured_messages captured;
+    logging::writer::named_write writer;
+    make_writer(writer, captured);
+
+    logging::start_async_logging(64, logging::overflow_policy::block);
+    HPX_TEST(logging::is_async_logging_enabled());
+
+    std::size_t const num_threads = 4;
+    std::size_t const num_messages = 1000;
+
+    std::vector<std::thread::id> logging_ids(num_threads);
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&, t] {
+            logging_ids[t] = std::this_thread::get_id();
+            for (std::size_t i = 0; i != num_messages; ++i)
+            {
+                log(writer, std::to_string(t) + ":" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    logging::stop_async_logging();
+    HPX_TEST(!logging::is_async_logging_enabled());
+
+    // all messages were written, the messages of each thread in order
+    HPX_TEST_EQ(captured.messages.size(), num_threads * num_messages);
+
+    std::vector<std::size_t> next(num_threads, 0);
+    for (std::string const& m : captured.messages)
+    {
+        std::size_t const pos = m.find(':');
+        HPX_TEST_NEQ(pos, std::string::npos);
+
+        std::size_t const t = std::stoul(m.substr(0, pos));
+        std::size_t const i = std::stoul(m.substr(pos + 1));
+        HPX_TEST_LT(t, num_threads);
+        HPX_TEST_EQ(i, next[t]);
+        ++next[t];
+    }
+
+    // nothing was written by the logging threads themselves (the messages
+    // left when stopping are written by the stopping thread)
+    for (std::thread::id const& id : captured.writers)
+    {
+        for (std::thread::id const& logging_id : logging_ids)
+        {
+            HPX_TEST_NEQ(id, logging_id);
+        }
+    }
+}
+
+// messages are written synchronously if asynchronous logging is not enabled
+void test_synchronous()
+{
+    captured_messages captured;
+    logging::writer::named_write writer;
+    make_writer(writer, captured);
+
+    HPX_TEST(!logging::is_async_logging_enabled());
+    log(writer, "sync");
+
+    HPX_TEST_EQ(captured.messages.size(), std::size_t(1));
+    HPX_TEST_EQ(captured.messages[0], std::string("sync"));
+    HPX_TEST_EQ(captured.writers[0], std::this_thread::get_id());
+}
+
+// messages not fitting into the buffer are dropped (and counted) with the
+// drop policy
+void test_drop_policy()
+{
+    captured_messages captured;
+    logging::writer::named_write writer;
+    make_writer(writer, captured);
+
+    std::uint64_t const dropped = logging::get_async_logging_dropped_count();
+
+    logging::start_async_logging(4, logging::overflow_policy::drop);
+
+    // keep the background thread busy writing the first message
+    captured.block = true;
+    log(writer, "first");
+    while (!captured.blocked)
+    {
+        std::this_thread::yield();
+    }
+
+    // the message being written still occupies its slot, at most 3 more
+    // messages fit into the buffer
+    std::size_t const num_messages = 100;
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        log(writer, std::to_string(i));
+    }
+
+    std::uint64_t const newly_dropped =
+        logging::get_async_logging_dropped_count() - dropped;
+    HPX_TEST_EQ(newly_dropped, std::uint64_t(num_messages - 3));
+
+    captured.block = false;
+    logging::stop_async_logging();
+
+    // the first message and the ones which fit into the buffer are written
+    HPX_TEST_EQ(captured.messages.size(), std::size_t(4));
+    HPX_TEST_EQ(captured.messages[0], std::string("first"));
+    for (std::size_t i = 1; i != captured.messages.size(); ++i)
+    {
+        HPX_TEST_EQ(captured.messages[i], std::to_string(i - 1));
+    }
+}
+
+// nothing is dropped with the block policy, the writers wait instead
+void test_block_policy()
+{
+    captured_messages captured;
+    logging::writer::named_write writer;
+    make_writer(writer, captured);
+
+    std::uint64_t const dropped = logging::get_async_logging_dropped_count();
+
+    logging::start_async_logging(4, logging::overflow_policy::block);
+
+    captured.block = true;
+    log(writer, "first");
+    while (!captured.blocked)
+    {
+        std::this_thread::yield();
+    }
+
+    std::thread releaser([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        captured.block = false;
+    });
+
+    std::size_t const num_messages = 100;
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        log(writer, std::to_string(i));
+    }
+
+    releaser.join();
+    logging::stop_async_logging();
+
+    HPX_TEST_EQ(logging::get_async_logging_dropped_count(), dropped);
+    HPX_TEST_EQ(captured.messages.size(), num_messages + 1);
+}
+
+int main()
+{
+    test_synchronous();
+    test_ordering();
+    test_drop_policy();
+    test_block_policy();
+    test_synchronous();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hpx::resource {
+
+    /// The elastic_policy moves processing units between thread pools based
+    /// on their current load.
+    ///
+    /// Processing units can be moved between two pools only if both pools
+    /// have a worker thread bound to them (i.e. the resource partitioner was
+    /// created using \a mode_allow_oversubscription), and if both pools were
+    /// created with \a scheduler_mode::enable_elasticity. Out of the worker
+    /// threads sharing a processing unit only one should be active at any
+    /// time, the others should be suspended (see
+    /// \a thread_pool_base::suspend_processing_unit_direct).
+    ///
+    /// A pool is considered to be overloaded if the number of pending
+    /// threads per active worker thread exceeds the high watermark, and to
+    /// be underloaded if it is below the low watermark while at least one of
+    /// its worker threads is idle. In each step the policy resumes a
+    /// suspended worker thread of the most loaded overloaded pool. It prefers
+    /// worker threads bound to a processing unit no other pool is running
+    /// on, otherwise it picks the processing unit of the least loaded
+    /// underloaded pool and suspends that pool's worker thread. The number
+    /// of active worker threads of each pool is kept within the bounds given
+    /// to \a add_pool.
+    class HPX_CORE_EXPORT elastic_policy
+    {
+    public:
+        /// Construct the policy.
+        ///
+        /// \param high_watermark [in] The number of pending threads per
+        ///             active worker thread above which a pool is considered
+        ///             to be overloaded.
+        /// \param low_watermark [in] The number of pending threads per
+        ///             active worker thread below which a pool is considered
+        ///             to be underloaded.
+        /// \param patience [in] The number of consecutive steps a pool has
+        ///             to be overloaded before processing units are moved to
+        ///             it.
+        explicit elastic_policy(double high_watermark = 4.0,
+            double low_watermark = 0.5, std::size_t patience = 2);
+
+        elastic_policy(elastic_policy const&) = delete;
+        elastic_policy& operator=(elastic_policy const&) = delete;
+
+        ~elastic_policy();
+
+        /// Make the given pool take part in the rebalancing. The number of
+        /// active worker threads of the pool will be kept in the range
+        /// [min_threads, max_threads]. Pools can be added while the policy
+        /// is running.
+        void add_pool(threads::thread_pool_base& pool,
+            std::size_t min_threads = 1,
+            std::size_t max_threads = std::size_t(-1));
+
+        /// Perform one rebalancing step. Returns whether a processing unit
+        /// was moved.
+        ///
+        /// \note This function suspends worker threads, it must not be
+        ///       called from an HPX thread running on any of the managed
+        ///       pools.
+        bool rebalance(error_code& ec = throws);
+
+        /// Start a dedicated OS thread invoking \a rebalance in the given
+        /// interval. Errors reported by \a rebalance stop the rebalancing.
+        void start(std::chrono::milliseconds interval);
+
+        /// Stop the OS thread started by \a start. This has to be called
+        /// before the runtime is stopped.
+        void stop();
+
+        /// Return the number of processing units moved so far.
+        std::size_t get_num_moves() const noexcept
+        {
+            return num_moves_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct pool_data
+        {
+            threads::thread_pool_base* pool_;
+            std::size_t min_threads_;
+            std::size_t max_threads_;
+            std::size_t overloaded_steps_;
+        };
+
+        void run(std::chrono::milliseconds interval);
+
+        double const high_watermark_;
+        double const low_watermark_;
+        std::size_t const patience_;
+
+        std::vector<pool_data> pools_;
+        std::atomic<std::size_t> num_moves_;
+
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        bool stop_;
+        std::thread thread_;
+    };
+}    // namespace hpx::resource
@@ -0,0 +1,295 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/resource_partitioner/detail/partitioner.hpp>
+#include <hpx/resource_partitioner/elastic_policy.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hpx::resource {
+
+    namespace {
+
+        struct pool_load
+        {
+            double load_;
+            std::size_t active_;
+            bool idle_;
+        };
+
+        pool_load get_pool_load(threads::thread_pool_base& pool)
+        {
+            std::size_t const active = pool.get_active_os_thread_count();
+            std::int64_t const pending =
+                pool.get_queue_length(std::size_t(-1), false);
+
+            pool_load result;
+            result.active_ = active;
+            result.load_ = active == 0 ?
+                (std::numeric_limits<double>::max)() :
+                double(pending) / double(active);
+            result.idle_ = pool.get_idle_core_count() > 0;
+            return result;
+        }
+
+        bool is_running(
+            threads::thread_pool_base const& pool, std::size_t virt_core)
+        {
+            return pool.get_scheduler()->get_state(virt_core).load() ==
+                hpx::state_running;
+        }
+
+        bool is_sleeping(
+            threads::thread_pool_base const& pool, std::size_t virt_core)
+        {
+            return pool.get_scheduler()->get_state(virt_core).load() ==
+                hpx::state_sleeping;
+        }
+
+        threads::mask_cref_type get_pu_mask(
+            threads::thread_pool_base const& pool, std::size_t virt_core)
+        {
+            return get_partitioner().get_pu_mask(
+                pool.get_thread_offset() + virt_core);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    elastic_policy::elastic_policy(
+        double high_watermark, double low_watermark, std::size_t patience)
+      : high_watermark_(high_watermark)
+      , low_watermark_(low_watermark)
+      , patience_(patience)
+      , num_moves_(0)
+      , stop_(false)
+    {
+        HPX_ASSERT(low_watermark_ <= high_watermark_);
+    }
+
+    elastic_policy::~elastic_policy()
+    {
+        stop();
+    }
+
+    void elastic_policy::add_pool(threads::thread_pool_base& pool,
+        std::size_t min_threads, std::size_t max_threads)
+    {
+        threads::policies::scheduler_base* sched = pool.get_scheduler();
+        if (sched == nullptr ||
+            !sched->has_scheduler_mode(
+                threads::policies::scheduler_mode::enable_elasticity))
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "elastic_policy::add_pool",
+                "the thread pool {} does not support elasticity",
+                pool.get_pool_name());
+        }
+
+        if (min_threads == 0 || min_threads > max_threads)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter, "elastic_policy::add_pool",
+                "invalid bounds for the number of threads of pool {}: [{}, {}]",
+                pool.get_pool_name(), min_threads, max_threads);
+        }
+
+        std::lock_guard<std::mutex> l(mtx_);
+        pools_.push_back(pool_data{&pool, min_threads, max_threads, 0});
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool elastic_policy::rebalance(error_code& ec)
+    {
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        // the OS thread started by start() releases the lock while invoking
+        // this function
+        std::lock_guard<std::mutex> l(mtx_);
+
+        std::vector<pool_load> loads;
+        loads.reserve(pools_.size());
+
+        // find the most loaded pool that has been overloaded for long enough
+        std::size_t receiver = std::size_t(-1);
+        for (std::size_t i = 0; i != pools_.size(); ++i)
+        {
+            pool_data& data = pools_[i];
+            loads.push_back(get_pool_load(*data.pool_));
+
+            pool_load const& load = loads.back();
+            if (load.load_ > high_watermark_ &&
+                load.active_ < data.max_threads_)
+            {
+                ++data.overloaded_steps_;
+            }
+            else
+            {
+                data.overloaded_steps_ = 0;
+            }
+
+            if (data.overloaded_steps_ >= patience_ &&
+                (receiver == std::size_t(-1) ||
+                    load.load_ > loads[receiver].load_))
+            {
+                receiver = i;
+            }
+        }
+
+        if (receiver == std::size_t(-1))
+            return false;
+
+        threads::thread_pool_base& receiving_pool = *pools_[receiver].pool_;
+
+        // look for a suspended worker thread of the receiving pool whose
+        // processing unit is either unused or used by an underloaded pool,
+        // preferring unused processing units and the least loaded donor
+        std::size_t receiver_core = std::size_t(-1);
+        std::size_t donor = std::size_t(-1);
+        std::size_t donor_core = std::size_t(-1);
+
+        std::size_t const num_threads = receiving_pool.get_os_thread_count();
+        for (std::size_t r = 0; r != num_threads; ++r)
+        {
+            if (!is_sleeping(receiving_pool, r))
+                continue;
+
+            threads::mask_cref_type mask = get_pu_mask(receiving_pool, r);
+
+            bool occupied = false;
+            std::size_t candidate = std::size_t(-1);
+            std::size_t candidate_core = std::size_t(-1);
+
+            for (std::size_t d = 0; d != pools_.size() && !occupied; ++d)
+            {
+                if (d == receiver)
+                    continue;
+
+                threads::thread_pool_base& pool = *pools_[d].pool_;
+                pool_load const& load = loads[d];
+
+                bool const can_donate = load.load_ < low_watermark_ &&
+                    load.idle_ && load.active_ > pools_[d].min_threads_;
+
+                for (std::size_t c = 0; c != pool.get_os_thread_count(); ++c)
+                {
+                    if (!is_running(pool, c) ||
+                        !threads::bit_and(mask, get_pu_mask(pool, c)))
+                    {
+                        continue;
+                    }
+
+                    if (can_donate && candidate == std::size_t(-1))
+                    {
+                        candidate = d;
+                        candidate_core = c;
+                    }
+                    else
+                    {
+                        // the processing unit is needed by a busy pool (or
+                        // is oversubscribed already)
+                        occupied = true;
+                    }
+                    break;
+                }
+            }
+
+            if (occupied)
+                continue;
+
+            if (candidate == std::size_t(-1))
+            {
+                // the processing unit is unused, no need to look further
+                receiver_core = r;
+                donor = std::size_t(-1);
+                break;
+            }
+
+            if (receiver_core == std::size_t(-1) ||
+                loads[candidate].load_ < loads[donor].load_)
+            {
+                receiver_core = r;
+                donor = candidate;
+                donor_core = candidate_core;
+            }
+        }
+
+        if (receiver_core == std::size_t(-1))
+            return false;
+
+        if (donor != std::size_t(-1))
+        {
+            pools_[donor].pool_->suspend_processing_unit_direct(
+                donor_core, ec);
+            if (ec)
+                return false;
+        }
+
+        receiving_pool.resume_processing_unit_direct(receiver_core, ec);
+        if (ec)
+            return false;
+
+        pools_[receiver].overloaded_steps_ = 0;
+        ++num_moves_;
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void elastic_policy::start(std::chrono::milliseconds interval)
+    {
+        std::lock_guard<std::mutex> l(mtx_);
+        if (thread_.joinable())
+        {
+            HPX_THROW_EXCEPTION(invalid_status, "elastic_policy::start",
+                "the elastic policy has already been started");
+        }
+
+        stop_ = false;
+        thread_ = std::thread(&elastic_policy::run, this, interval);
+    }
+
+    void elastic_policy::stop()
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            if (!thread_.joinable())
+                return;
+
+            stop_ = true;
+        }
+
+        cond_.notify_all();
+        thread_.join();
+    }
+
+    void elastic_policy::run(std::chrono::milliseconds interval)
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        while (!cond_.wait_for(l, interval, [this]() { return stop_; }))
+        {
+            l.unlock();
+
+            error_code ec(throwmode::lightweight);
+            rebalance(ec);
+
+            l.lock();
+            if (ec)
+                break;
+        }
+    }
+}    // namespace hpx::resource
@@ -0,0 +1,135 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the elastic policy moves processing units from an idle pool to
+// an overloaded pool sharing the same processing units.
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/resource_partitioner/elastic_policy.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+std::size_t const max_threads = (std::min)(
+    std::size_t(4), std::size_t(hpx::threads::hardware_concurrency()));
+
+void test_scheduler(
+    int argc, char* argv[], hpx::resource::scheduling_policy scheduler)
+{
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=" + std::to_string(max_threads)};
+    init_args.rp_mode = hpx::resource::mode_allow_oversubscription;
+    init_args.rp_callback = [scheduler](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        auto const mode = hpx::threads::policies::scheduler_mode(
+            hpx::threads::policies::default_mode |
+            hpx::threads::policies::enable_elasticity);
+
+        rp.create_thread_pool("default", scheduler, mode);
+        rp.create_thread_pool("batch", scheduler, mode);
+
+        // both pools get a worker thread on each of the processing units
+        std::size_t count = 0;
+        for (hpx::resource::numa_domain const& d : rp.numa_domains())
+        {
+            for (hpx::resource::core const& c : d.cores())
+            {
+                for (hpx::resource::pu const& p : c.pus())
+                {
+                    if (count++ < max_threads)
+                    {
+                        rp.add_resource(p, "default");
+                        rp.add_resource(p, "batch");
+                    }
+                }
+            }
+        }
+    };
+
+    hpx::local::start(nullptr, argc, argv, init_args);
+
+    hpx::threads::thread_pool_base& default_pool =
+        hpx::resource::get_thread_pool("default");
+    hpx::threads::thread_pool_base& batch_pool =
+        hpx::resource::get_thread_pool("batch");
+
+    // the batch pool runs on the first processing unit, the default pool on
+    // all others
+    default_pool.suspend_processing_unit_direct(0);
+    for (std::size_t i = 1; i != max_threads; ++i)
+    {
+        batch_pool.suspend_processing_unit_direct(i);
+    }
+
+    HPX_TEST_EQ(batch_pool.get_active_os_thread_count(), std::size_t(1));
+    HPX_TEST_EQ(default_pool.get_active_os_thread_count(), max_threads - 1);
+
+    hpx::resource::elastic_policy policy(4.0, 0.5, 1);
+    policy.add_pool(default_pool, 1);
+    policy.add_pool(batch_pool, 1);
+
+    // overload the batch pool
+    hpx::execution::parallel_executor exec(&batch_pool);
+
+    std::vector<hpx::future<void>> results;
+    for (std::size_t i = 0; i != 100 * max_threads; ++i)
+    {
+        results.push_back(hpx::async(exec, []() {
+            hpx::chrono::high_resolution_timer t;
+            while (t.elapsed() < 0.001)
+            {
+            }
+        }));
+    }
+
+    // the default pool can give up all but one of its processing units
+    hpx::chrono::high_resolution_timer t;
+    while (batch_pool.get_active_os_thread_count() != max_threads - 1 &&
+        t.elapsed() < 10)
+    {
+        policy.rebalance();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    HPX_TEST_EQ(batch_pool.get_active_os_thread_count(), max_threads - 1);
+    HPX_TEST_EQ(default_pool.get_active_os_thread_count(), std::size_t(1));
+    HPX_TEST_EQ(policy.get_num_moves(), max_threads - 2);
+
+    hpx::wait_all(results);
+
+    hpx::apply([]() { hpx::local::finalize(); });
+
+    HPX_TEST_EQ(hpx::local::stop(), 0);
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_ASSERT(max_threads >= 2);
+
+    std::vector<hpx::resource::scheduling_policy> schedulers = {
+        hpx::resource::scheduling_policy::local,
+        hpx::resource::scheduling_policy::local_priority_fifo,
+    };
+
+    for (auto const scheduler : schedulers)
+    {
+        test_scheduler(argc, argv, scheduler);
+    }
+
+    return hpx::util::report_errors();
+}
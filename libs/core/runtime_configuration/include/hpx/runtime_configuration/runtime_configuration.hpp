@@ -90,6 +90,10 @@ namespace hpx { namespace util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Get the number of localities each locality forwards the bootstrap
+        // notifications to (0 means all are notified by the root locality)
+        std::size_t get_agas_bootstrap_fanout() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
@@ -0,0 +1,28 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <iosfwd>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The startup profile splits the time spent while starting the runtime
+    // into consecutive phases. Each call to startup_phase_completed() assigns
+    // the time elapsed since the previous call (or since the profile was
+    // reset) to the given phase. The times of phases which are completed more
+    // than once are accumulated.
+    HPX_CORE_EXPORT void reset_startup_profile();
+    HPX_CORE_EXPORT void startup_phase_completed(char const* phase);
+
+    // Print the time spent in all recorded startup phases (in the order the
+    // phases were completed first), this is enabled using the command line
+    // option --hpx:print-startup-profile.
+    HPX_CORE_EXPORT void print_startup_profile(std::ostream& os);
+}}    // namespace hpx::util
@@ -21,12 +21,17 @@
 #include <boost/tokenizer.hpp>
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <random>
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -291,18 +296,17 @@ namespace hpx { namespace util {
         std::string const& curr,
         std::vector<std::shared_ptr<components::component_registry_base>>&
             component_registries,
-        std::string name, error_code& ec)
+        std::string name, std::vector<std::string>& ini_data,
+        std::vector<std::string>& names, error_code& ec)
     {
         hpx::util::plugin::plugin_factory<components::component_registry_base>
             pf(d, "registry");
 
         // retrieve the names of all known registries
-        std::vector<std::string> names;
         pf.get_names(names, ec);
         if (ec)
             return;
 
-        std::vector<std::string> ini_data;
         if (names.empty())
         {
             // This HPX module does not export any factories, but
@@ -344,6 +348,7 @@ namespace hpx { namespace util {
     std::vector<std::shared_ptr<plugins::plugin_registry_base>>
     load_plugin_factory(hpx::util::plugin::dll& d, util::section& ini,
         std::string const& /* curr */, std::string const& /* name */,
+        std::vector<std::string>& ini_data, std::vector<std::string>& names,
         error_code& ec)
     {
         typedef std::vector<std::shared_ptr<plugins::plugin_registry_base>>
@@ -354,12 +359,10 @@ namespace hpx { namespace util {
             d, "plugin");
 
         // retrieve the names of all known registries
-        std::vector<std::string> names;
         pf.get_names(names, ec);    // throws on error
         if (ec)
             return plugin_registries;
 
-        std::vector<std::string> ini_data;
         if (!names.empty())
         {
             // ask all registries
@@ -396,6 +399,256 @@ namespace hpx { namespace util {
         {
             return lhs.first == rhs.first;
         }
+
+        template <typename Time>
+        std::int64_t time_as_integer(Time const& t)
+        {
+            if constexpr (std::is_arithmetic_v<Time>)
+            {
+                return static_cast<std::int64_t>(t);
+            }
+            else
+            {
+                return static_cast<std::int64_t>(t.time_since_epoch().count());
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The module index remembers for every shared library found in a
+        // component directory whether it is an HPX module and, if it is, the
+        // ini sections generated by its component and plugin registries and
+        // the names of those registries. As long as the size and the
+        // modification time of a library don't change it doesn't have to be
+        // loaded during module discovery, the runtime_support loads it once
+        // one of its components is requested. The index is enabled by setting
+        // hpx.module_cache to a writable directory.
+        class module_index
+        {
+        public:
+            struct entry
+            {
+                std::uint64_t size = 0;
+                std::int64_t mtime = 0;
+                bool is_module = false;
+                std::vector<std::string> component_ini;
+                std::vector<std::string> component_registries;
+                std::vector<std::string> plugin_ini;
+                std::vector<std::string> plugin_registries;
+            };
+
+        private:
+            // bump this whenever the layout of the index changes
+            static constexpr std::uint64_t format_version = 1;
+
+            // refuse to read unreasonably long strings from a corrupt index
+            static constexpr std::uint64_t max_string_length = 1 << 20;
+
+            static bool get_file_data(filesystem::path const& lib, entry& e)
+            {
+                std::error_code ec;
+                e.size = static_cast<std::uint64_t>(
+                    filesystem::file_size(lib, ec));
+                if (ec)
+                    return false;
+
+                e.mtime = time_as_integer(filesystem::last_write_time(lib, ec));
+                return !ec;
+            }
+
+            template <typename T>
+            static void write(std::ostream& out, T value)
+            {
+                out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+            }
+
+            static void write(std::ostream& out, std::string const& value)
+            {
+                write(out, static_cast<std::uint64_t>(value.size()));
+                out.write(value.data(), value.size());
+            }
+
+            static void write(
+                std::ostream& out, std::vector<std::string> const& values)
+            {
+                write(out, static_cast<std::uint64_t>(values.size()));
+                for (std::string const& value : values)
+                    write(out, value);
+            }
+
+            template <typename T>
+            static bool read(std::istream& in, T& value)
+            {
+                return static_cast<bool>(
+                    in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+            }
+
+            static bool read(std::istream& in, std::string& value)
+            {
+                std::uint64_t size = 0;
+                if (!read(in, size) || size > max_string_length)
+                    return false;
+
+                value.resize(static_cast<std::size_t>(size));
+                return static_cast<bool>(in.read(&value[0], value.size()));
+            }
+
+            static bool read(std::istream& in, std::vector<std::string>& values)
+            {
+                std::uint64_t size = 0;
+                if (!read(in, size) || size > max_string_length)
+                    return false;
+
+                values.resize(static_cast<std::size_t>(size));
+                for (std::string& value : values)
+                {
+                    if (!read(in, value))
+                        return false;
+                }
+                return true;
+            }
+
+            static bool read(std::istream& in, entry& e)
+            {
+                std::uint8_t is_module = 0;
+                if (!read(in, e.size) || !read(in, e.mtime) ||
+                    !read(in, is_module) || !read(in, e.component_ini) ||
+                    !read(in, e.component_registries) ||
+                    !read(in, e.plugin_ini) || !read(in, e.plugin_registries))
+                {
+                    return false;
+                }
+                e.is_module = is_module != 0;
+                return true;
+            }
+
+            static void write(std::ostream& out, entry const& e)
+            {
+                write(out, e.size);
+                write(out, e.mtime);
+                write(out, static_cast<std::uint8_t>(e.is_module ? 1 : 0));
+                write(out, e.component_ini);
+                write(out, e.component_registries);
+                write(out, e.plugin_ini);
+                write(out, e.plugin_registries);
+            }
+
+            // the index is invalidated whenever HPX itself changes as this
+            // might change the generated ini sections
+            static std::string signature()
+            {
+                return "hpx module index " + std::to_string(format_version) +
+                    " " + hpx::full_version_as_string();
+            }
+
+        public:
+            module_index(std::string const& cache_dir, std::string const& libs)
+            {
+                if (cache_dir.empty())
+                    return;    // the index is disabled
+
+                index_file_ = filesystem::path(cache_dir) /
+                    ("hpx_modules." +
+                        std::to_string(std::hash<std::string>()(libs)) +
+                        ".index");
+
+                std::ifstream in(index_file_.string(), std::ios::binary);
+                std::string sig;
+                std::uint64_t count = 0;
+                if (!in || !read(in, sig) || sig != signature() ||
+                    !read(in, count))
+                {
+                    return;
+                }
+
+                std::map<std::string, entry> entries;
+                for (std::uint64_t i = 0; i != count; ++i)
+                {
+                    std::string lib;
+                    entry e;
+                    if (!read(in, lib) || !read(in, e))
+                    {
+                        LRT_(info).format("ignoring corrupt module index: {}",
+                            index_file_.string());
+                        return;
+                    }
+                    entries.emplace(HPX_MOVE(lib), HPX_MOVE(e));
+                }
+                entries_ = HPX_MOVE(entries);
+            }
+
+            // return the cached data for the given library, if it is still
+            // up to date
+            entry const* find(filesystem::path const& lib)
+            {
+                if (index_file_.empty())
+                    return nullptr;
+
+                auto it = entries_.find(lib.string());
+                entry e;
+                if (it == entries_.end() || !get_file_data(lib, e) ||
+                    it->second.size != e.size || it->second.mtime != e.mtime)
+                {
+                    return nullptr;
+                }
+
+                return &current_.insert(*it).first->second;
+            }
+
+            void add(filesystem::path const& lib, entry e)
+            {
+                if (!index_file_.empty() && get_file_data(lib, e))
+                {
+                    current_[lib.string()] = HPX_MOVE(e);
+                    modified_ = true;
+                }
+            }
+
+            // write the index back if anything has changed, the file is
+            // replaced atomically as several processes might use it
+            // concurrently
+            void save() const
+            {
+                if (index_file_.empty() ||
+                    (!modified_ && current_.size() == entries_.size()))
+                {
+                    return;
+                }
+
+                filesystem::path tmp(index_file_);
+                tmp += "." + std::to_string(std::random_device()());
+                {
+                    std::ofstream out(tmp.string(), std::ios::binary);
+                    write(out, signature());
+                    write(out, static_cast<std::uint64_t>(current_.size()));
+                    for (auto const& e : current_)
+                    {
+                        write(out, e.first);
+                        write(out, e.second);
+                    }
+                    if (!out)
+                    {
+                        LRT_(info).format(
+                            "could not write module index: {}", tmp.string());
+                        return;
+                    }
+                }
+
+                std::error_code ec;
+                filesystem::rename(tmp, index_file_, ec);
+                if (ec)
+                {
+                    filesystem::remove(tmp, ec);
+                    LRT_(info).format("could not write module index: {}",
+                        index_file_.string());
+                }
+            }
+
+        private:
+            filesystem::path index_file_;
+            std::map<std::string, entry> entries_;
+            std::map<std::string, entry> current_;
+            bool modified_ = false;
+        };
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -497,9 +750,35 @@ namespace hpx { namespace util {
         std::mt19937 generator(random_device());
         std::shuffle(libdata.begin(), libdata.end(), HPX_MOVE(generator));
 
+        detail::module_index index(ini.get_entry("hpx.module_cache", ""), libs);
+
         typedef std::pair<fs::path, std::string> libdata_type;
         for (libdata_type const& p : libdata)
         {
+            std::string curr_fullname(p.first.parent_path().string());
+
+            detail::module_index::entry const* cached = index.find(p.first);
+            if (cached != nullptr)
+            {
+                if (!cached->is_module)
+                {
+                    LRT_(info).format("skipping (cached, not a module): {}",
+                        p.first.string());
+                    continue;
+                }
+
+                // plugin registries have to be initialized while the command
+                // line is handled, modules exporting plugins are always loaded
+                if (cached->plugin_registries.empty())
+                {
+                    LRT_(info).format("deferring load of cached module: {}",
+                        p.first.string());
+                    ini.parse("<component registry>", cached->component_ini,
+                        false, false);
+                    continue;
+                }
+            }
+
             LRT_(info).format("attempting to load: {}", p.first.string());
 
             // get the handle of the library
@@ -513,35 +792,41 @@ namespace hpx { namespace util {
                 continue;
             }
 
-            bool must_keep_loaded = false;
+            detail::module_index::entry e;
 
             // get the component factory
-            std::string curr_fullname(p.first.parent_path().string());
-            load_component_factory(
-                d, ini, curr_fullname, component_registries, p.second, ec);
+            load_component_factory(d, ini, curr_fullname, component_registries,
+                p.second, e.component_ini, e.component_registries, ec);
             if (ec)
             {
                 LRT_(info).format(
                     "skipping (load_component_factory failed): {}: {}",
                     p.first.string(), get_error_what(ec));
                 ec = error_code(lightweight);    // reinit ec
+
+                // don't remember anything about a partially loaded module
+                e.component_ini.clear();
+                e.component_registries.clear();
             }
             else
             {
                 LRT_(debug).format(
                     "load_component_factory succeeded: {}", p.first.string());
-                must_keep_loaded = true;
+                e.is_module = true;
             }
 
             // get the plugin factory
-            plugin_list_type tmp_regs =
-                load_plugin_factory(d, ini, curr_fullname, p.second, ec);
+            plugin_list_type tmp_regs = load_plugin_factory(d, ini,
+                curr_fullname, p.second, e.plugin_ini, e.plugin_registries, ec);
 
             if (ec)
             {
                 LRT_(info).format(
                     "skipping (load_plugin_factory failed): {}: {}",
                     p.first.string(), get_error_what(ec));
+
+                e.plugin_ini.clear();
+                e.plugin_registries.clear();
             }
             else
             {
@@ -550,15 +835,22 @@ namespace hpx { namespace util {
 
                 std::copy(tmp_regs.begin(), tmp_regs.end(),
                     std::back_inserter(plugin_registries));
-                must_keep_loaded = true;
+                e.is_module = true;
             }
 
             // store loaded library for future use
-            if (must_keep_loaded)
+            if (e.is_module)
             {
                 modules.insert(std::make_pair(p.second, HPX_MOVE(d)));
             }
+
+            if (cached == nullptr)
+            {
+                index.add(p.first, HPX_MOVE(e));
+            }
         }
+
+        index.save();
         return plugin_registries;
     }
 }}    // namespace hpx::util
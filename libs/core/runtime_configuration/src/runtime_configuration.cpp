@@ -18,6 +18,7 @@
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_configuration/runtime_mode.hpp>
+#include <hpx/runtime_configuration/startup_profile.hpp>
 #include <hpx/util/from_string.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/version.hpp>
@@ -106,6 +107,7 @@ namespace hpx { namespace util {
             "[hpx]",
             "location = ${HPX_LOCATION:$[system.prefix]}",
             "component_paths = ${HPX_COMPONENT_PATHS}",
+            "module_cache = ${HPX_MODULE_CACHE}",
             "component_base_paths = $[hpx.location]"    // NOLINT
                 HPX_INI_PATH_DELIMITER "$[system.executable_prefix]",
             "component_path_suffixes = " +
@@ -194,6 +196,44 @@ namespace hpx { namespace util {
             "[hpx.on_startup]",
             "wait_on_latch = ${HPX_ON_STARTUP_WAIT_ON_LATCH}",
 
+            // chunk sizes tuned by autotuned_chunk_size are loaded from and
+            // stored to this file if specified, the locality id is inserted
+            // in front of the file extension
+            "[hpx.parallel]",
+            "autotuning_profile = ${HPX_AUTOTUNING_PROFILE}",
+
+            // record task lifecycle events and write them in the Chrome
+            // trace event format at shutdown
+            "[hpx.trace]",
+            "enabled = ${HPX_TRACE:0}",
+            "buffer_size = ${HPX_TRACE_BUFFER_SIZE:65536}",
+            "filename = ${HPX_TRACE_FILENAME:hpx.$[system.pid].trace.json}",
+
+            // sample the invocations of components supporting migration and
+            // move them towards the locality they are mostly invoked from
+            "[hpx.automatic_migration]",
+            "enabled = ${HPX_AUTOMATIC_MIGRATION:0}",
+            "interval = ${HPX_AUTOMATIC_MIGRATION_INTERVAL:1000}",
+            "sample_rate = ${HPX_AUTOMATIC_MIGRATION_SAMPLE_RATE:16}",
+            "min_samples = ${HPX_AUTOMATIC_MIGRATION_MIN_SAMPLES:64}",
+            "dominance = ${HPX_AUTOMATIC_MIGRATION_DOMINANCE:0.5}",
+            "max_batch = ${HPX_AUTOMATIC_MIGRATION_MAX_BATCH:16}",
+
+            // aggregate the output sent by hpx::cout et.al. from remote
+            // localities to the console
+            "[hpx.iostreams]",
+            "aggregate = ${HPX_IOSTREAMS_AGGREGATE:0}",
+            "aggregate_size = ${HPX_IOSTREAMS_AGGREGATE_SIZE:65536}",
+            "aggregate_interval = ${HPX_IOSTREAMS_AGGREGATE_INTERVAL:100}",
+
+            // exchange the load of all localities in the background, used by
+            // the binpacking and least-loaded distribution policies
+            "[hpx.load_information]",
+            "enabled = ${HPX_LOAD_INFORMATION:0}",
+            "interval = ${HPX_LOAD_INFORMATION_INTERVAL:500}",
+            "fanout = ${HPX_LOAD_INFORMATION_FANOUT:2}",
+            "max_staleness = ${HPX_LOAD_INFORMATION_MAX_STALENESS:2000}",
+
 #if defined(HPX_HAVE_NETWORKING)
             // by default, enable networking
             "[hpx.parcel]",
@@ -307,6 +347,9 @@ namespace hpx { namespace util {
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
             "use_range_caching = ${HPX_AGAS_USE_RANGE_CACHING:1}",
             "use_caching = ${HPX_AGAS_USE_CACHING:1}",
+            "bootstrap_fanout = ${HPX_AGAS_BOOTSTRAP_FANOUT:8}",
+            "credit_replenish_threshold = "
+            "${HPX_AGAS_CREDIT_REPLENISH_THRESHOLD:0}",
 
             "[hpx.components]",
             "load_external = ${HPX_LOAD_EXTERNAL_COMPONENTS:1}",
@@ -379,6 +422,12 @@ namespace hpx { namespace util {
                 "P%parentloc%/%hpxparent%.%hpxparentphase% %time%("
                 HPX_TIMEFORMAT ") [%idx%]|\\n}",
 
+            // write log messages from a background thread, the overflow
+            // policy can be 'block' or 'drop'
+            "async = ${HPX_LOGGING_ASYNC:0}",
+            "async_buffer_size = ${HPX_LOGGING_ASYNC_BUFFER_SIZE:4096}",
+            "async_overflow = ${HPX_LOGGING_ASYNC_OVERFLOW:block}",
+
             // general console logging
             "[hpx.logging.console]",
             "level = ${HPX_LOGLEVEL:$[hpx.logging.level]}",
@@ -635,6 +684,8 @@ namespace hpx { namespace util {
         typedef std::vector<std::shared_ptr<plugins::plugin_registry_base>>
             plugin_list_type;
 
+        util::startup_phase_completed("command line handling");
+
         // protect against duplicate paths
         std::set<std::string> component_paths;
 
@@ -670,6 +721,8 @@ namespace hpx { namespace util {
         // merge all found ini files of all components
         util::merge_component_inis(*this);
 
+        util::startup_phase_completed("module discovery");
+
         need_to_call_pre_initialize = true;
 
         // invoke reconfigure
@@ -917,6 +970,16 @@ namespace hpx { namespace util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t runtime_configuration::get_agas_bootstrap_fanout() const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "bootstrap_fanout", 8);
+        }
+        return 8;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
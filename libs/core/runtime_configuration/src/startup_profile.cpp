@@ -0,0 +1,106 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime_configuration/startup_profile.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        struct startup_profile
+        {
+            using clock_type = std::chrono::steady_clock;
+            using phase_type = std::pair<char const*, clock_type::duration>;
+
+            hpx::lcos::local::spinlock mtx_;
+            clock_type::time_point last_ = clock_type::now();
+            std::vector<phase_type> phases_;
+        };
+
+        startup_profile& get_startup_profile()
+        {
+            static startup_profile profile;
+            return profile;
+        }
+    }    // namespace detail
+
+    void reset_startup_profile()
+    {
+        detail::startup_profile& profile = detail::get_startup_profile();
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(profile.mtx_);
+        profile.last_ = detail::startup_profile::clock_type::now();
+        profile.phases_.clear();
+    }
+
+    void startup_phase_completed(char const* phase)
+    {
+        detail::startup_profile& profile = detail::get_startup_profile();
+        auto const now = detail::startup_profile::clock_type::now();
+
+        std::lock_guard<hpx::lcos::local::spinlock> l(profile.mtx_);
+        auto const elapsed = now - profile.last_;
+        profile.last_ = now;
+
+        auto it = std::find_if(profile.phases_.begin(), profile.phases_.end(),
+            [&](detail::startup_profile::phase_type const& p) {
+                return std::strcmp(p.first, phase) == 0;
+            });
+
+        if (it != profile.phases_.end())
+        {
+            it->second += elapsed;
+        }
+        else
+        {
+            profile.phases_.emplace_back(phase, elapsed);
+        }
+    }
+
+    void print_startup_profile(std::ostream& os)
+    {
+        detail::startup_profile& profile = detail::get_startup_profile();
+
+        std::vector<detail::startup_profile::phase_type> phases;
+        {
+            std::lock_guard<hpx::lcos::local::spinlock> l(profile.mtx_);
+            phases = profile.phases_;
+        }
+
+        std::size_t width = std::strlen("total");
+        for (auto const& p : phases)
+        {
+            width = (std::max)(width, std::strlen(p.first));
+        }
+
+        std::chrono::duration<double> total(0);
+        for (auto const& p : phases)
+        {
+            std::chrono::duration<double> const elapsed = p.second;
+            os << "  " << std::left << std::setw(static_cast<int>(width))
+               << p.first << " : " << std::right << std::fixed
+               << std::setprecision(6) << elapsed.count() << " [s]\n";
+            total += elapsed;
+        }
+        os << "  " << std::left << std::setw(static_cast<int>(width))
+           << "total"
+           << " : " << std::right << std::fixed << std::setprecision(6)
+           << total.count() << " [s]\n";
+        os.flush();
+    }
+}}    // namespace hpx::util
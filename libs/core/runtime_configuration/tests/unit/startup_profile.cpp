@@ -0,0 +1,117 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_configuration/startup_profile.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct profile_line
+{
+    std::string phase;
+    std::size_t separator = 0;
+    double seconds = 0;
+};
+
+// every line of the profile looks like "  <phase> : <seconds> [s]"
+std::vector<profile_line> parse_profile(std::string const& profile)
+{
+    std::vector<profile_line> lines;
+
+    std::istringstream in(profile);
+    std::string line;
+    while (std::getline(in, line))
+    {
+        HPX_TEST_EQ(line.substr(0, 2), std::string("  "));
+        HPX_TEST_EQ(line.substr(line.size() - 4), std::string(" [s]"));
+
+        profile_line l;
+        l.separator = line.find(" : ");
+        HPX_TEST_NEQ(l.separator, std::string::npos);
+
+        l.phase = line.substr(2, line.find_last_not_of(' ', l.separator) - 1);
+
+        // the times are printed with a fixed number of digits
+        std::string const seconds =
+            line.substr(l.separator + 3, line.size() - l.separator - 7);
+        HPX_TEST_EQ(seconds.size() - seconds.find('.'), std::size_t(7));
+        l.seconds = std::stod(seconds);
+
+        lines.push_back(l);
+    }
+    return lines;
+}
+
+std::string print_profile()
+{
+    std::ostringstream os;
+    hpx::util::print_startup_profile(os);
+    return os.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty_profile()
+{
+    hpx::util::reset_startup_profile();
+
+    std::vector<profile_line> lines = parse_profile(print_profile());
+    HPX_TEST_EQ(lines.size(), std::size_t(1));
+    HPX_TEST_EQ(lines[0].phase, std::string("total"));
+    HPX_TEST_EQ(lines[0].seconds, 0.0);
+}
+
+void test_profile()
+{
+    using namespace std::chrono_literals;
+
+    hpx::util::reset_startup_profile();
+
+    std::this_thread::sleep_for(10ms);
+    hpx::util::startup_phase_completed("first");
+
+    std::this_thread::sleep_for(10ms);
+    hpx::util::startup_phase_completed("a longer phase name");
+
+    // the time of repeated phases is accumulated
+    std::this_thread::sleep_for(10ms);
+    hpx::util::startup_phase_completed("first");
+
+    std::vector<profile_line> lines = parse_profile(print_profile());
+    HPX_TEST_EQ(lines.size(), std::size_t(3));
+
+    // phases are listed in the order they were first completed
+    HPX_TEST_EQ(lines[0].phase, std::string("first"));
+    HPX_TEST_EQ(lines[1].phase, std::string("a longer phase name"));
+    HPX_TEST_EQ(lines[2].phase, std::string("total"));
+
+    // the times are aligned
+    HPX_TEST_EQ(lines[0].separator, lines[1].separator);
+    HPX_TEST_EQ(lines[0].separator, lines[2].separator);
+
+    HPX_TEST_LTE(0.02, lines[0].seconds);
+    HPX_TEST_LTE(0.01, lines[1].seconds);
+
+    // the total is the sum of all phases (up to rounding)
+    double const sum = lines[0].seconds + lines[1].seconds;
+    HPX_TEST_LTE(sum - 2e-6, lines[2].seconds);
+    HPX_TEST_LTE(lines[2].seconds, sum + 2e-6);
+}
+
+int main()
+{
+    test_empty_profile();
+    test_profile();
+    test_empty_profile();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,107 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file async_file_io.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/algorithms/just.hpp>
+#include <hpx/execution/algorithms/keep_future.hpp>
+#include <hpx/execution/algorithms/let_value.hpp>
+#include <hpx/execution/algorithms/then.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace hpx::io {
+
+    /// The type of the native file handles the functions below operate on
+    /// (a file descriptor on POSIX systems, a HANDLE on Windows).
+#if defined(HPX_WINDOWS)
+    using native_handle_type = void*;
+#else
+    using native_handle_type = int;
+#endif
+
+    /// Read up to \a count bytes from the file \a fd starting at the given
+    /// \a offset into \a buffer. The returned future becomes ready with the
+    /// number of bytes read once the operation has completed.
+    ///
+    /// The (blocking) system call is executed on the I/O thread pool of the
+    /// runtime, the calling HPX thread is suspended while waiting for the
+    /// result instead of blocking its worker thread. If called outside of an
+    /// HPX thread, the operation is performed synchronously.
+    ///
+    /// \note The buffer has to stay valid until the operation has completed.
+    HPX_CORE_EXPORT hpx::future<std::size_t> async_read_at(
+        native_handle_type fd, void* buffer, std::size_t count,
+        std::uint64_t offset);
+
+    /// Write \a count bytes from \a buffer to the file \a fd starting at the
+    /// given \a offset. The returned future becomes ready with the number of
+    /// bytes written once the operation has completed.
+    ///
+    /// \note The buffer has to stay valid until the operation has completed.
+    HPX_CORE_EXPORT hpx::future<std::size_t> async_write_at(
+        native_handle_type fd, void const* buffer, std::size_t count,
+        std::uint64_t offset);
+
+    /// Flush all modified data of the file \a fd to the storage device.
+    HPX_CORE_EXPORT hpx::future<void> async_fsync(native_handle_type fd);
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        struct get_future_value
+        {
+            template <typename T>
+            T operator()(hpx::future<T>&& f) const
+            {
+                return f.get();
+            }
+        };
+
+        // Issue the operation produced by the given function only once the
+        // returned sender has been started.
+        template <typename F>
+        auto lazy_io_sender(F&& f)
+        {
+            namespace ex = hpx::execution::experimental;
+            return ex::let_value(
+                ex::just(), [f = HPX_FORWARD(F, f)]() mutable {
+                    return ex::then(ex::keep_future(f()), get_future_value{});
+                });
+        }
+    }    // namespace detail
+
+    /// Sender versions of the functions above. The operation is issued when
+    /// the returned sender is started (not when it is created), the sender
+    /// then sends the result of the operation (or the error that occurred)
+    /// to the connected receiver.
+    inline auto read_at(native_handle_type fd, void* buffer,
+        std::size_t count, std::uint64_t offset)
+    {
+        return detail::lazy_io_sender([=]() {
+            return async_read_at(fd, buffer, count, offset);
+        });
+    }
+
+    inline auto write_at(native_handle_type fd, void const* buffer,
+        std::size_t count, std::uint64_t offset)
+    {
+        return detail::lazy_io_sender([=]() {
+            return async_write_at(fd, buffer, count, offset);
+        });
+    }
+
+    inline auto fsync(native_handle_type fd)
+    {
+        return detail::lazy_io_sender([=]() { return async_fsync(fd); });
+    }
+}    // namespace hpx::io
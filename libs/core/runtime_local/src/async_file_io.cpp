@@ -0,0 +1,193 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/async_file_io.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/runtime_local/service_executors.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::io {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        [[noreturn]] void throw_last_error(char const* function)
+        {
+#if defined(HPX_WINDOWS)
+            std::error_code const ec(
+                static_cast<int>(GetLastError()), std::system_category());
+#else
+            std::error_code const ec(errno, std::system_category());
+#endif
+            HPX_THROW_EXCEPTION(filesystem_error, function,
+                "the file operation failed: {}", ec.message());
+        }
+
+        std::size_t read_at_impl(native_handle_type fd, void* buffer,
+            std::size_t count, std::uint64_t offset)
+        {
+            char* data = static_cast<char*>(buffer);
+            std::size_t total = 0;
+            while (total != count)
+            {
+#if defined(HPX_WINDOWS)
+                OVERLAPPED overlapped = {};
+                overlapped.Offset = static_cast<DWORD>(offset + total);
+                overlapped.OffsetHigh =
+                    static_cast<DWORD>((offset + total) >> 32);
+
+                DWORD read = 0;
+                if (!ReadFile(fd, data + total,
+                        static_cast<DWORD>((std::min)(count - total,
+                            std::size_t(0x7fffffff))),
+                        &read, &overlapped))
+                {
+                    if (GetLastError() == ERROR_HANDLE_EOF)
+                        break;
+                    throw_last_error("hpx::io::async_read_at");
+                }
+#else
+                ssize_t const read = ::pread(fd, data + total, count - total,
+                    static_cast<off_t>(offset + total));
+                if (read < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    throw_last_error("hpx::io::async_read_at");
+                }
+#endif
+                if (read == 0)
+                    break;    // end of file
+                total += static_cast<std::size_t>(read);
+            }
+            return total;
+        }
+
+        std::size_t write_at_impl(native_handle_type fd, void const* buffer,
+            std::size_t count, std::uint64_t offset)
+        {
+            char const* data = static_cast<char const*>(buffer);
+            std::size_t total = 0;
+            while (total != count)
+            {
+#if defined(HPX_WINDOWS)
+                OVERLAPPED overlapped = {};
+                overlapped.Offset = static_cast<DWORD>(offset + total);
+                overlapped.OffsetHigh =
+                    static_cast<DWORD>((offset + total) >> 32);
+
+                DWORD written = 0;
+                if (!WriteFile(fd, data + total,
+                        static_cast<DWORD>((std::min)(count - total,
+                            std::size_t(0x7fffffff))),
+                        &written, &overlapped))
+                {
+                    throw_last_error("hpx::io::async_write_at");
+                }
+#else
+                ssize_t const written = ::pwrite(fd, data + total,
+                    count - total, static_cast<off_t>(offset + total));
+                if (written < 0)
+                {
+                    if (errno == EINTR)
+                        continue;
+                    throw_last_error("hpx::io::async_write_at");
+                }
+#endif
+                total += static_cast<std::size_t>(written);
+            }
+            return total;
+        }
+
+        void fsync_impl(native_handle_type fd)
+        {
+#if defined(HPX_WINDOWS)
+            if (!FlushFileBuffers(fd))
+#else
+            if (::fsync(fd) != 0)
+#endif
+            {
+                throw_last_error("hpx::io::async_fsync");
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Run the given (blocking) operation on the I/O thread pool. Outside
+        // of HPX threads there is nothing to gain from this, the operation
+        // is executed directly instead.
+        template <typename F>
+        hpx::future<std::invoke_result_t<F>> execute(F&& f)
+        {
+            using result_type = std::invoke_result_t<F>;
+
+            if (threads::get_self_ptr() != nullptr &&
+                get_runtime_ptr() != nullptr)
+            {
+                parallel::execution::io_pool_executor exec;
+                return parallel::execution::async_execute(
+                    exec, HPX_FORWARD(F, f));
+            }
+
+            try
+            {
+                if constexpr (std::is_void_v<result_type>)
+                {
+                    f();
+                    return hpx::make_ready_future();
+                }
+                else
+                {
+                    return hpx::make_ready_future(f());
+                }
+            }
+            catch (...)
+            {
+                return hpx::make_exceptional_future<result_type>(
+                    std::current_exception());
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<std::size_t> async_read_at(native_handle_type fd,
+        void* buffer, std::size_t count, std::uint64_t offset)
+    {
+        return execute(
+            [=]() { return read_at_impl(fd, buffer, count, offset); });
+    }
+
+    hpx::future<std::size_t> async_write_at(native_handle_type fd,
+        void const* buffer, std::size_t count, std::uint64_t offset)
+    {
+        return execute(
+            [=]() { return write_at_impl(fd, buffer, count, offset); });
+    }
+
+    hpx::future<void> async_fsync(native_handle_type fd)
+    {
+        return execute([=]() { fsync_impl(fd); });
+    }
+}    // namespace hpx::io
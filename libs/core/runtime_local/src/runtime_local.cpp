@@ -12,6 +12,7 @@
 #include <hpx/coroutines/coroutine.hpp>
 #include <hpx/coroutines/signal_handler_debugging.hpp>
 #include <hpx/debugging/backtrace.hpp>
+#include <hpx/execution/detail/autotuning_registry.hpp>
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/function.hpp>
@@ -34,9 +35,11 @@
 #include <hpx/thread_support/set_thread_name.hpp>
 #include <hpx/threading_base/external_timer.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/trace_recorder.hpp>
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/from_string.hpp>
+#include <hpx/util/get_entry_as.hpp>
 #include <hpx/version.hpp>
 
 #include <atomic>
@@ -422,6 +425,33 @@ namespace hpx {
                 add_shutdown_function(HPX_MOVE(f));
             }
             detail::global_shutdown_functions.clear();
+
+            // reload the results of previous autotuning runs, if requested,
+            // each locality uses its own profile (the locality id is known
+            // only once the runtime has been started)
+            std::string const autotuning_profile =
+                rtcfg_.get_entry("hpx.parallel.autotuning_profile", "");
+            if (!autotuning_profile.empty())
+            {
+                namespace ex = hpx::execution::experimental;
+                add_pre_startup_function([autotuning_profile]() {
+                    ex::load_autotuning_profile(
+                        ex::detail::get_autotuning_profile_name(
+                            autotuning_profile, hpx::get_locality_id()));
+                });
+                add_shutdown_function([autotuning_profile]() {
+                    ex::save_autotuning_profile(
+                        ex::detail::get_autotuning_profile_name(
+                            autotuning_profile, hpx::get_locality_id()));
+                });
+            }
+
+            // start recording task lifecycle events, if requested
+            if (util::get_entry_as<int>(rtcfg_, "hpx.trace.enabled", 0) != 0)
+            {
+                threads::tracing::enable(util::get_entry_as<std::size_t>(
+                    rtcfg_, "hpx.trace.buffer_size", 65536));
+            }
         }
         catch (std::exception const& e)
         {
@@ -447,6 +477,24 @@ namespace hpx {
 #ifdef HPX_HAVE_IO_POOL
         io_pool_.stop();
 #endif
+
+        // write the recorded trace events, if any
+        if (threads::tracing::is_enabled())
+        {
+            threads::tracing::disable();
+            try
+            {
+                threads::tracing::export_chrome_trace(
+                    rtcfg_.get_entry("hpx.trace.filename", "hpx.trace.json"),
+                    util::get_entry_as<std::uint32_t>(
+                        rtcfg_, "hpx.locality", 0));
+            }
+            catch (std::exception const& e)
+            {
+                std::cerr << "~runtime: failed to write trace events: "
+                          << e.what() << std::endl;
+            }
+        }
         LRT_(debug).format("~runtime_local(finished)");
 
         LPROGRESS_;
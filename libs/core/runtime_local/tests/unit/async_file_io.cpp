@@ -0,0 +1,148 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_WINDOWS)
+#include <hpx/execution/algorithms/sync_wait.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_local/async_file_io.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <unistd.h>
+
+void test_file_io(int fd)
+{
+    std::vector<char> data(100000);
+    std::iota(data.begin(), data.end(), char(0));
+
+    // write the data in two chunks, the second one first
+    std::size_t const half = data.size() / 2;
+    hpx::future<std::size_t> f2 = hpx::io::async_write_at(
+        fd, data.data() + half, data.size() - half, half);
+    hpx::future<std::size_t> f1 =
+        hpx::io::async_write_at(fd, data.data(), half, 0);
+
+    HPX_TEST_EQ(f1.get(), half);
+    HPX_TEST_EQ(f2.get(), data.size() - half);
+
+    hpx::io::async_fsync(fd).get();
+
+    // read back everything
+    {
+        std::vector<char> result(data.size());
+        hpx::future<std::size_t> f =
+            hpx::io::async_read_at(fd, result.data(), result.size(), 0);
+        HPX_TEST_EQ(f.get(), data.size());
+        HPX_TEST(result == data);
+    }
+
+    // reading beyond the end of the file returns the available data only
+    {
+        std::vector<char> result(1000);
+        hpx::future<std::size_t> f = hpx::io::async_read_at(
+            fd, result.data(), result.size(), data.size() - 10);
+        HPX_TEST_EQ(f.get(), std::size_t(10));
+        HPX_TEST(std::equal(result.begin(), result.begin() + 10,
+            data.end() - 10, data.end()));
+    }
+
+    // use the sender interface
+    {
+        namespace ex = hpx::execution::experimental;
+
+        std::vector<char> result(half);
+        HPX_TEST_EQ(
+            ex::sync_wait(hpx::io::read_at(fd, result.data(), half, half)),
+            half);
+        HPX_TEST(std::equal(
+            result.begin(), result.end(), data.begin() + half, data.end()));
+
+        ex::sync_wait(hpx::io::fsync(fd));
+    }
+
+    // senders issue the operation only once they have been started
+    {
+        namespace ex = hpx::execution::experimental;
+
+        char const c = char(-1);
+        auto s = hpx::io::write_at(fd, &c, 1, 0);
+
+        char result = 0;
+        HPX_TEST_EQ(hpx::io::async_read_at(fd, &result, 1, 0).get(),
+            std::size_t(1));
+        HPX_TEST_EQ(result, data[0]);
+
+        HPX_TEST_EQ(ex::sync_wait(std::move(s)), std::size_t(1));
+        HPX_TEST_EQ(hpx::io::async_read_at(fd, &result, 1, 0).get(),
+            std::size_t(1));
+        HPX_TEST_EQ(result, c);
+
+        // restore the original contents
+        HPX_TEST_EQ(hpx::io::async_write_at(fd, data.data(), 1, 0).get(),
+            std::size_t(1));
+    }
+
+    // errors are reported through the future
+    {
+        char c = 0;
+        bool caught_exception = false;
+        try
+        {
+            hpx::io::async_read_at(-1, &c, 1, 0).get();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::filesystem_error);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+int hpx_main()
+{
+    std::FILE* file = std::tmpfile();
+    HPX_TEST(file != nullptr);
+
+    test_file_io(fileno(file));
+
+    std::fclose(file);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the functions can be used outside of HPX threads as well
+    {
+        std::FILE* file = std::tmpfile();
+        HPX_TEST(file != nullptr);
+
+        char const c = 'x';
+        HPX_TEST_EQ(hpx::io::async_write_at(fileno(file), &c, 1, 0).get(),
+            std::size_t(1));
+
+        std::fclose(file);
+    }
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -43,5 +43,6 @@ namespace hpx::serialization {
         virtual void set_filter(binary_filter* filter) = 0;
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(void* address, std::size_t count) = 0;
+        virtual void set_current_pos(std::size_t pos) = 0;
     };
 }    // namespace hpx::serialization
@@ -216,6 +216,17 @@ namespace hpx::serialization {
             return base_type::current_pos();
         }
 
+        // Continue reading at the given position (as returned by
+        // current_pos() while the data was written). This allows to
+        // independently de-serialize separate parts of the same archive,
+        // which is supported for uncompressed archives without zero-copy
+        // chunks only.
+        void seek(std::size_t pos)
+        {
+            buffer_->set_current_pos(pos);
+            size_ = pos;
+        }
+
     private:
         friend struct basic_archive<input_archive>;
 
@@ -179,6 +179,29 @@ namespace hpx::serialization {
             }
         }
 
+        // continue reading at the given position, this is supported for
+        // uncompressed archives without zero-copy chunks only
+        void set_current_pos(std::size_t pos) override
+        {
+            if (filter_ != nullptr || chunks_ != nullptr)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "input_container::set_current_pos",
+                    "archive data bstream can't be accessed randomly");
+                return;
+            }
+
+            if (pos > access_traits::size(cont_))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "input_container::set_current_pos",
+                    "archive data bstream is too short");
+                return;
+            }
+
+            current_ = pos;
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -0,0 +1,114 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace hpx::traits {
+
+    namespace detail {
+
+        template <typename T>
+        struct serialized_size_impl
+        {
+            // integral types are always serialized as 64 bit values
+            static constexpr std::size_t value = sizeof(std::int64_t);
+        };
+
+        template <>
+        struct serialized_size_impl<bool>
+        {
+            static constexpr std::size_t value = sizeof(bool);
+        };
+
+        template <>
+        struct serialized_size_impl<char>
+        {
+            static constexpr std::size_t value = sizeof(char);
+        };
+
+        template <>
+        struct serialized_size_impl<signed char>
+        {
+            static constexpr std::size_t value = sizeof(signed char);
+        };
+
+        template <>
+        struct serialized_size_impl<unsigned char>
+        {
+            static constexpr std::size_t value = sizeof(unsigned char);
+        };
+
+        // see output_archive::save
+        template <typename T>
+        inline constexpr bool is_bitwise_serialized_v =
+            !std::is_integral_v<T> && !std::is_enum_v<T> &&
+            !std::is_pointer_v<T> && !std::is_abstract_v<T> &&
+            (is_bitwise_serializable_v<T> || !is_not_bitwise_serializable_v<T>);
+    }    // namespace detail
+
+    // The trait serialized_size exposes the number of bytes an object of the
+    // given type occupies in an archive, if that number is known at compile
+    // time (i.e. for all arithmetic, enumeration, and bitwise serializable
+    // types). The trait has_constant_serialized_size can be used to detect
+    // whether this is the case.
+    //
+    // Note: bitwise serializable types are serialized member-wise if the
+    //       archive disables the array optimization or needs to convert the
+    //       endianess, the exposed size does not apply to those archives.
+    template <typename T, typename Enable = void>
+    struct has_constant_serialized_size : std::false_type
+    {
+    };
+
+    template <typename T, typename Enable = void>
+    struct serialized_size
+    {
+    };
+
+    template <typename T>
+    struct has_constant_serialized_size<T,
+        std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+      : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct serialized_size<T,
+        std::enable_if_t<std::is_integral_v<T> || std::is_enum_v<T>>>
+      : std::integral_constant<std::size_t,
+            detail::serialized_size_impl<T>::value>
+    {
+    };
+
+    template <typename T>
+    struct has_constant_serialized_size<T,
+        std::enable_if_t<detail::is_bitwise_serialized_v<T>>>
+      : std::true_type
+    {
+    };
+
+    template <typename T>
+    struct serialized_size<T,
+        std::enable_if_t<detail::is_bitwise_serialized_v<T>>>
+      : std::integral_constant<std::size_t, sizeof(T)>
+    {
+    };
+
+    template <typename T>
+    inline constexpr bool has_constant_serialized_size_v =
+        has_constant_serialized_size<T>::value;
+
+    template <typename T>
+    inline constexpr std::size_t serialized_size_v = serialized_size<T>::value;
+}    // namespace hpx::traits
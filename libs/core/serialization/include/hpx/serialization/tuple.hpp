@@ -16,6 +16,7 @@
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
 #include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/serialized_size.hpp>
 #include <hpx/type_support/pack.hpp>
 
 #include <cstddef>
@@ -38,6 +39,25 @@ namespace hpx::traits {
             !is_bitwise_serializable_v<::hpx::tuple<Ts...>>>
     {
     };
+
+    // tuples which are not bitwise serializable are serialized element-wise
+    template <typename... Ts>
+    struct has_constant_serialized_size<::hpx::tuple<Ts...>,
+        std::enable_if_t<!is_bitwise_serializable_v<::hpx::tuple<Ts...>>>>
+      : ::hpx::util::all_of<hpx::traits::has_constant_serialized_size<
+            typename std::remove_const<Ts>::type>...>
+    {
+    };
+
+    template <typename... Ts>
+    struct serialized_size<::hpx::tuple<Ts...>,
+        std::enable_if_t<!is_bitwise_serializable_v<::hpx::tuple<Ts...>> &&
+            has_constant_serialized_size_v<::hpx::tuple<Ts...>>>>
+      : std::integral_constant<std::size_t,
+            (std::size_t(0) + ... +
+                serialized_size_v<typename std::remove_const<Ts>::type>)>
+    {
+    };
 }    // namespace hpx::traits
 
 namespace hpx::util::detail {
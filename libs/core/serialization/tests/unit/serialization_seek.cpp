@@ -0,0 +1,88 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+int main()
+{
+    std::vector<char> buffer;
+    std::vector<std::uint64_t> offsets;
+
+    {
+        hpx::serialization::output_archive oarchive(
+            buffer, hpx::serialization::archive_flags::disable_data_chunking);
+
+        for (int i = 0; i != 10; ++i)
+        {
+            offsets.push_back(oarchive.current_pos());
+            oarchive << i << std::to_string(i);
+        }
+        oarchive.flush();
+    }
+
+    // read the elements in reverse order
+    {
+        hpx::serialization::input_archive iarchive(buffer, buffer.size());
+        for (int i = 9; i >= 0; --i)
+        {
+            iarchive.seek(offsets[i]);
+            HPX_TEST_EQ(iarchive.current_pos(),
+                static_cast<std::size_t>(offsets[i]));
+
+            int value = 0;
+            std::string str;
+            iarchive >> value >> str;
+            HPX_TEST_EQ(value, i);
+            HPX_TEST_EQ(str, std::to_string(i));
+        }
+    }
+
+    // several archives may read from the same buffer independently
+    {
+        hpx::serialization::input_archive iarchive1(buffer, buffer.size());
+        hpx::serialization::input_archive iarchive2(buffer, buffer.size());
+
+        iarchive2.seek(offsets[5]);
+        for (int i = 0; i != 5; ++i)
+        {
+            int value1 = 0, value2 = 0;
+            std::string str1, str2;
+            iarchive1 >> value1 >> str1;
+            iarchive2 >> value2 >> str2;
+            HPX_TEST_EQ(value1, i);
+            HPX_TEST_EQ(value2, i + 5);
+        }
+    }
+
+    // seeking beyond the end of the data fails
+    {
+        hpx::serialization::input_archive iarchive(buffer, buffer.size());
+
+        bool caught_exception = false;
+        try
+        {
+            iarchive.seek(buffer.size() + 1);
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,102 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/traits/serialized_size.hpp>
+#include <hpx/serialization/tuple.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct point
+{
+    double x, y, z;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & x & y & z;
+        // clang-format on
+    }
+};
+HPX_IS_BITWISE_SERIALIZABLE(point)
+
+struct particle
+{
+    point pos;
+    std::string name;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & pos & name;
+        // clang-format on
+    }
+};
+
+enum class color
+{
+    red,
+    green
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::size_t archive_size(T const& t)
+{
+    std::vector<char> buffer;
+    hpx::serialization::output_archive oarchive(buffer);
+    std::size_t const start = oarchive.bytes_written();
+    oarchive << t;
+    return oarchive.bytes_written() - start;
+}
+
+template <typename T>
+void test_serialized_size(T const& t)
+{
+    static_assert(hpx::traits::has_constant_serialized_size_v<T>);
+    HPX_TEST_EQ(hpx::traits::serialized_size_v<T>, archive_size(t));
+}
+
+int main()
+{
+    test_serialized_size(true);
+    test_serialized_size('c');
+    test_serialized_size(static_cast<unsigned char>(1));
+    test_serialized_size(static_cast<short>(1));
+    test_serialized_size(42);
+    test_serialized_size(std::uint64_t(42));
+    test_serialized_size(1.0f);
+    test_serialized_size(1.0);
+    test_serialized_size(color::green);
+    test_serialized_size(point{1.0, 2.0, 3.0});
+
+    // bitwise serializable tuples
+    test_serialized_size(hpx::make_tuple(1, 2.0, 'c'));
+    test_serialized_size(hpx::tuple<>());
+
+    // tuples which are serialized element-wise
+    test_serialized_size(hpx::make_tuple(1, color::red));
+    test_serialized_size(hpx::make_tuple(point{}, color::red, 'c'));
+
+    static_assert(!hpx::traits::has_constant_serialized_size_v<std::string>);
+    static_assert(
+        !hpx::traits::has_constant_serialized_size_v<std::vector<int>>);
+    static_assert(!hpx::traits::has_constant_serialized_size_v<particle>);
+    static_assert(!hpx::traits::has_constant_serialized_size_v<
+                  hpx::tuple<int, std::string>>);
+
+    return hpx::util::report_errors();
+}
@@ -16,6 +16,7 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/trace_recorder.hpp>
 
 #if defined(HPX_HAVE_BACKGROUND_THREAD_COUNTERS) &&                            \
     defined(HPX_HAVE_THREAD_IDLE_RATES)
@@ -64,6 +65,21 @@ namespace hpx { namespace threads { namespace detail {
             get_thread_state_name(state), info);
     }
 
+    // map the state returned by a thread to the trace event to record
+    inline tracing::event_type get_trace_event_type(
+        thread_schedule_state const state) noexcept
+    {
+        switch (state)
+        {
+        case thread_schedule_state::terminated:
+            return tracing::event_type::thread_terminate;
+        case thread_schedule_state::suspended:
+            return tracing::event_type::thread_suspend;
+        default:
+            return tracing::event_type::thread_yield;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////
     // helper class for switching thread state in and out during execution
     class switch_status
@@ -705,6 +721,13 @@ namespace hpx { namespace threads { namespace detail {
                                 exec_time_wrapper exec_time_collector(
                                     idle_rate);
 
+                                if (tracing::is_enabled())
+                                {
+                                    tracing::record(
+                                        tracing::event_type::thread_run,
+                                        thrdptr, thrdptr->get_description());
+                                }
+
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are resuming the
                                 // thread and have to restore any leaf timers from
@@ -731,6 +754,13 @@ namespace hpx { namespace threads { namespace detail {
 #else
                                 thrd_stat = (*thrdptr)(context_storage);
 #endif
+                                if (tracing::is_enabled())
+                                {
+                                    tracing::record(
+                                        detail::get_trace_event_type(
+                                            thrd_stat.get_previous()),
+                                        thrdptr);
+                                }
                             }
 
                             detail::write_state_log(scheduler, num_thread, thrd,
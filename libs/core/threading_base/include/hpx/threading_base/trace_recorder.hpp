@@ -0,0 +1,102 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace hpx { namespace threads { namespace tracing {
+
+    /// The kinds of events recorded by the built-in trace recorder
+    enum class event_type : std::uint8_t
+    {
+        thread_create = 0,       ///< a new HPX thread was created
+        thread_run = 1,          ///< an HPX thread started/resumed running
+        thread_suspend = 2,      ///< an HPX thread was suspended
+        thread_yield = 3,        ///< an HPX thread yielded (stays pending)
+        thread_terminate = 4,    ///< an HPX thread has finished running
+        thread_resume = 5,       ///< a suspended HPX thread was made pending
+        parcel_send = 6,         ///< a parcel was handed to the parcelhandler
+        parcel_receive = 7       ///< a message was received and decoded
+    };
+
+    namespace detail {
+        /// \cond NOINTERNAL
+        HPX_CORE_EXPORT extern std::atomic<bool> tracing_enabled;
+
+        HPX_CORE_EXPORT void record_event(event_type type, void const* thread,
+            std::uint64_t data, std::uint32_t data2) noexcept;
+        /// \endcond
+    }    // namespace detail
+
+    /// Return whether events are currently being recorded
+    inline bool is_enabled() noexcept
+    {
+        return detail::tracing_enabled.load(std::memory_order_relaxed);
+    }
+
+    /// Record an event into the buffer of the calling OS thread. The meaning
+    /// of \a data and \a data2 depends on the event type, e.g. the locality
+    /// a parcel is sent to or the number of bytes received.
+    inline void record(event_type type, void const* thread = nullptr,
+        std::uint64_t data = 0, std::uint32_t data2 = 0) noexcept
+    {
+        if (HPX_UNLIKELY(is_enabled()))
+        {
+            detail::record_event(type, thread, data, data2);
+        }
+    }
+
+    /// Record an event related to an HPX thread, including its description
+    inline void record(event_type type, void const* thread,
+        util::thread_description const& desc) noexcept
+    {
+        if (HPX_UNLIKELY(is_enabled()))
+        {
+            if (desc.kind() == util::thread_description::data_type_description)
+            {
+                detail::record_event(type, thread,
+                    reinterpret_cast<std::uint64_t>(desc.get_description()),
+                    util::thread_description::data_type_description);
+            }
+            else
+            {
+                detail::record_event(type, thread, desc.get_address(),
+                    util::thread_description::data_type_address);
+            }
+        }
+    }
+
+    /// Start recording events. Each OS thread recording events gets its own
+    /// buffer holding the last \a buffer_size events.
+    HPX_CORE_EXPORT void enable(std::size_t buffer_size);
+
+    /// Stop recording events, the recorded events are kept
+    HPX_CORE_EXPORT void disable() noexcept;
+
+    /// Discard all recorded events, recording has to be disabled. The
+    /// discarded buffers are reused once recording is enabled again.
+    HPX_CORE_EXPORT void clear();
+
+    /// Return the number of events recorded so far (including those which
+    /// were overwritten already)
+    HPX_CORE_EXPORT std::uint64_t get_event_count();
+
+    /// Write the recorded events in the Chrome trace event format (as
+    /// understood by chrome://tracing and Perfetto). Recording has to be
+    /// disabled while exporting.
+    HPX_CORE_EXPORT void export_chrome_trace(
+        std::ostream& os, std::uint32_t pid);
+    HPX_CORE_EXPORT void export_chrome_trace(
+        std::string const& filename, std::uint32_t pid);
+}}}    // namespace hpx::threads::tracing
@@ -12,6 +12,7 @@
 #include <hpx/threading_base/scheduler_base.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
+#include <hpx/threading_base/trace_recorder.hpp>
 
 #include <cstddef>
 
@@ -87,6 +88,13 @@ namespace hpx { namespace threads { namespace detail {
         // create the new thread
         scheduler->create_thread(data, &id, ec);
 
+        if (tracing::is_enabled() && id)
+        {
+            auto* thrd_data = get_thread_id_data(id);
+            tracing::record(tracing::event_type::thread_create, thrd_data,
+                thrd_data->get_description());
+        }
+
         // NOLINTNEXTLINE(bugprone-branch-clone)
         LTM_(info)
             .format("create_thread: pool({}), scheduler({}), thread({}), "
@@ -16,6 +16,7 @@
 #include <hpx/threading_base/set_thread_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
+#include <hpx/threading_base/trace_recorder.hpp>
 
 #include <cstddef>
 #include <functional>
@@ -263,6 +264,7 @@ namespace hpx { namespace threads { namespace detail {
 
             auto* thrd_data = get_thread_id_data(thrd);
             auto* scheduler = thrd_data->get_scheduler_base();
+            tracing::record(tracing::event_type::thread_resume, thrd_data);
             scheduler->schedule_thread(
                 thrd, schedulehint, false, thrd_data->get_priority());
             // NOTE: Don't care if the hint is a NUMA hint, just want to wake up
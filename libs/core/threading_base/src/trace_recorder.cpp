@@ -0,0 +1,436 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/hardware/timestamp.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/threading_base/trace_recorder.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace threads { namespace tracing {
+
+    namespace detail {
+        std::atomic<bool> tracing_enabled(false);
+    }
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A single recorded event, kept compact to make recording cheap
+        struct trace_event
+        {
+            std::uint64_t timestamp;
+            void const* thread;
+            std::uint64_t data;
+            std::uint32_t data2;
+            event_type type;
+        };
+
+        // The events recorded by one OS thread, older events are overwritten
+        // once the buffer is full.
+        struct trace_buffer
+        {
+            trace_buffer(std::size_t capacity, std::size_t global_thread_num)
+              : events(capacity)
+              , mask(capacity - 1)
+              , thread_num(global_thread_num)
+            {
+            }
+
+            std::vector<trace_event> events;
+            std::size_t mask;
+            std::size_t thread_num;
+            std::atomic<std::uint64_t> count{0};
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct trace_recorder
+        {
+            static trace_recorder& instance()
+            {
+                static trace_recorder recorder;
+                return recorder;
+            }
+
+            trace_buffer* new_buffer()
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                std::size_t const thread_num =
+                    threads::detail::get_global_thread_num_tss();
+
+                // prefer recycling a buffer discarded by clear()
+                auto it = std::find_if(retired_buffers.begin(),
+                    retired_buffers.end(),
+                    [&](std::unique_ptr<trace_buffer> const& buffer) {
+                        return buffer->events.size() == buffer_size;
+                    });
+                if (it != retired_buffers.end())
+                {
+                    buffers.push_back(HPX_MOVE(*it));
+                    retired_buffers.erase(it);
+
+                    trace_buffer& buffer = *buffers.back();
+                    buffer.thread_num = thread_num;
+                    buffer.count.store(0, std::memory_order_relaxed);
+                    return &buffer;
+                }
+
+                buffers.push_back(
+                    std::make_unique<trace_buffer>(buffer_size, thread_num));
+                return buffers.back().get();
+            }
+
+            // convert the given hardware timestamp into nanoseconds
+            double to_nanoseconds(std::uint64_t ts) const noexcept
+            {
+                return static_cast<double>(ts - start_ticks) * ns_per_tick;
+            }
+
+            std::mutex mtx;
+            std::vector<std::unique_ptr<trace_buffer>> buffers;
+
+            // Buffers discarded by clear() are never freed, as threads which
+            // have already checked the generation may still be writing to
+            // them. They are handed out again by new_buffer() instead, which
+            // bounds their number by the number of recording threads.
+            std::vector<std::unique_ptr<trace_buffer>> retired_buffers;
+            std::size_t buffer_size = 0;
+            std::atomic<std::size_t> generation{0};
+
+            // calibration of the hardware timestamps
+            std::uint64_t start_ticks = 0;
+            std::uint64_t start_ns = 0;
+            double ns_per_tick = 1.0;
+        };
+
+        struct thread_buffer
+        {
+            trace_buffer* buffer = nullptr;
+            std::size_t generation = 0;
+        };
+
+        thread_local thread_buffer this_thread_buffer;
+
+        std::size_t round_up_to_power_of_two(std::size_t n)
+        {
+            std::size_t result = 1;
+            while (result < n)
+                result <<= 1;
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void write_escaped(std::ostream& os, char const* str)
+        {
+            for (/**/; *str != '\0'; ++str)
+            {
+                char const c = *str;
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char buffer[8];
+                    std::snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+                    os << buffer;
+                }
+                else
+                {
+                    os << c;
+                }
+            }
+        }
+
+        void write_name(std::ostream& os, trace_event const& e)
+        {
+            if (e.data2 == util::thread_description::data_type_description)
+            {
+                char const* desc = reinterpret_cast<char const*>(e.data);
+                write_escaped(os, desc != nullptr ? desc : "<unknown>");
+            }
+            else
+            {
+                char buffer[32];
+                std::snprintf(buffer, sizeof(buffer), "address %#llx",
+                    static_cast<unsigned long long>(e.data));
+                os << buffer;
+            }
+        }
+
+        void write_timestamp(std::ostream& os, double ns)
+        {
+            // the trace event format expects microseconds
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%.3f", ns / 1000.0);
+            os << buffer;
+        }
+
+        char const* const end_state_names[] = {
+            "", "", "suspended", "yielded", "terminated"};
+
+        char const* const instant_event_names[] = {"thread_create", "",
+            "", "", "", "thread_resume", "parcel_send", "parcel_receive"};
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        void record_event(event_type type, void const* thread,
+            std::uint64_t data, std::uint32_t data2) noexcept
+        {
+            thread_buffer& tb = this_thread_buffer;
+
+            trace_recorder& recorder = trace_recorder::instance();
+            std::size_t const generation =
+                recorder.generation.load(std::memory_order_acquire);
+            if (HPX_UNLIKELY(
+                    tb.buffer == nullptr || tb.generation != generation))
+            {
+                try
+                {
+                    tb.buffer = recorder.new_buffer();
+                    tb.generation = generation;
+                }
+                catch (...)
+                {
+                    tb.buffer = nullptr;
+                    return;
+                }
+            }
+
+            trace_buffer& buffer = *tb.buffer;
+            std::uint64_t const count =
+                buffer.count.load(std::memory_order_relaxed);
+
+            trace_event& e = buffer.events[count & buffer.mask];
+            e.timestamp = hpx::util::hardware::timestamp();
+            e.thread = thread;
+            e.data = data;
+            e.data2 = data2;
+            e.type = type;
+
+            buffer.count.store(count + 1, std::memory_order_release);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable(std::size_t buffer_size)
+    {
+        trace_recorder& recorder = trace_recorder::instance();
+        {
+            std::lock_guard<std::mutex> l(recorder.mtx);
+
+            buffer_size = round_up_to_power_of_two(
+                buffer_size < 2 ? std::size_t(2) : buffer_size);
+            if (buffer_size != recorder.buffer_size)
+            {
+                recorder.buffer_size = buffer_size;
+                ++recorder.generation;
+            }
+
+            if (recorder.start_ns == 0)
+            {
+                recorder.start_ticks = hpx::util::hardware::timestamp();
+                recorder.start_ns = hpx::chrono::high_resolution_clock::now();
+            }
+        }
+        detail::tracing_enabled.store(true, std::memory_order_release);
+    }
+
+    void disable() noexcept
+    {
+        detail::tracing_enabled.store(false, std::memory_order_release);
+    }
+
+    void clear()
+    {
+        HPX_ASSERT(!is_enabled());
+
+        trace_recorder& recorder = trace_recorder::instance();
+
+        std::lock_guard<std::mutex> l(recorder.mtx);
+        for (auto& buffer : recorder.buffers)
+        {
+            recorder.retired_buffers.push_back(HPX_MOVE(buffer));
+        }
+        recorder.buffers.clear();
+        recorder.start_ticks = 0;
+        recorder.start_ns = 0;
+        ++recorder.generation;
+    }
+
+    std::uint64_t get_event_count()
+    {
+        trace_recorder& recorder = trace_recorder::instance();
+
+        std::uint64_t count = 0;
+
+        std::lock_guard<std::mutex> l(recorder.mtx);
+        for (auto const& buffer : recorder.buffers)
+        {
+            count += buffer->count.load(std::memory_order_acquire);
+        }
+        return count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void export_chrome_trace(std::ostream& os, std::uint32_t pid)
+    {
+        trace_recorder& recorder = trace_recorder::instance();
+
+        std::lock_guard<std::mutex> l(recorder.mtx);
+
+        // calibrate the hardware timestamps against the steady clock
+        std::uint64_t const end_ticks = hpx::util::hardware::timestamp();
+        std::uint64_t const end_ns = hpx::chrono::high_resolution_clock::now();
+        if (end_ticks > recorder.start_ticks && end_ns > recorder.start_ns)
+        {
+            recorder.ns_per_tick =
+                static_cast<double>(end_ns - recorder.start_ns) /
+                static_cast<double>(end_ticks - recorder.start_ticks);
+        }
+
+        os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+        bool first = true;
+        auto next_event = [&]() -> std::ostream& {
+            if (!first)
+                os << ",";
+            first = false;
+            return os << "\n";
+        };
+
+        std::size_t tid = 0;
+        for (auto const& buffer : recorder.buffers)
+        {
+            ++tid;
+
+            next_event() << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":"
+                         << pid << ",\"tid\":" << tid
+                         << ",\"args\":{\"name\":\"";
+            if (buffer->thread_num != std::size_t(-1))
+                os << "worker-thread#" << buffer->thread_num;
+            else
+                os << "thread#" << tid;
+            os << "\"}}";
+
+            std::uint64_t const count =
+                buffer->count.load(std::memory_order_acquire);
+            std::size_t const capacity = buffer->events.size();
+            std::uint64_t const begin =
+                count > capacity ? count - capacity : 0;
+
+            // the run events are written as complete events once the
+            // corresponding end event is seen
+            trace_event const* running = nullptr;
+
+            for (std::uint64_t i = begin; i != count; ++i)
+            {
+                trace_event const& e = buffer->events[i & buffer->mask];
+                switch (e.type)
+                {
+                case event_type::thread_run:
+                    running = &e;
+                    break;
+
+                case event_type::thread_suspend:
+                    HPX_FALLTHROUGH;
+                case event_type::thread_yield:
+                    HPX_FALLTHROUGH;
+                case event_type::thread_terminate:
+                {
+                    if (running == nullptr || running->thread != e.thread)
+                        break;
+
+                    double const start =
+                        recorder.to_nanoseconds(running->timestamp);
+                    double const end = recorder.to_nanoseconds(e.timestamp);
+
+                    next_event() << "{\"name\":\"";
+                    write_name(os, *running);
+                    os << "\",\"cat\":\"thread\",\"ph\":\"X\",\"ts\":";
+                    write_timestamp(os, start);
+                    os << ",\"dur\":";
+                    write_timestamp(os, end - start);
+                    os << ",\"pid\":" << pid << ",\"tid\":" << tid
+                       << ",\"args\":{\"thread\":\"" << e.thread
+                       << "\",\"state\":\""
+                       << end_state_names[static_cast<int>(e.type)] << "\"}}";
+
+                    running = nullptr;
+                    break;
+                }
+
+                default:
+                {
+                    next_event()
+                        << "{\"name\":\""
+                        << instant_event_names[static_cast<int>(e.type)]
+                        << "\",\"cat\":\""
+                        << (e.type == event_type::parcel_send ||
+                                       e.type == event_type::parcel_receive ?
+                                   "parcel" :
+                                   "thread")
+                        << "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":";
+                    write_timestamp(os, recorder.to_nanoseconds(e.timestamp));
+                    os << ",\"pid\":" << pid << ",\"tid\":" << tid
+                       << ",\"args\":{";
+                    if (e.type == event_type::parcel_send)
+                    {
+                        os << "\"destination\":" << e.data;
+                    }
+                    else if (e.type == event_type::parcel_receive)
+                    {
+                        os << "\"bytes\":" << e.data
+                           << ",\"parcels\":" << e.data2;
+                    }
+                    else
+                    {
+                        os << "\"thread\":\"" << e.thread << "\"";
+                        if (e.type == event_type::thread_create)
+                        {
+                            os << ",\"description\":\"";
+                            write_name(os, e);
+                            os << "\"";
+                        }
+                    }
+                    os << "}}";
+                    break;
+                }
+                }
+            }
+        }
+
+        os << "\n]}\n";
+    }
+
+    void export_chrome_trace(std::string const& filename, std::uint32_t pid)
+    {
+        std::ofstream out(filename.c_str());
+        if (!out.is_open())
+        {
+            HPX_THROW_EXCEPTION(hpx::filesystem_error,
+                "hpx::threads::tracing::export_chrome_trace",
+                "unable to open trace file for writing: {}", filename);
+        }
+        export_chrome_trace(out, pid);
+    }
+}}}    // namespace hpx::threads::tracing
@@ -0,0 +1,177 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/trace_recorder.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace tracing = hpx::threads::tracing;
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t count_occurrences(std::string const& str, std::string const& s)
+{
+    std::size_t count = 0;
+    for (std::size_t pos = str.find(s); pos != std::string::npos;
+         pos = str.find(s, pos + s.size()))
+    {
+        ++count;
+    }
+    return count;
+}
+
+// the output has to be a single well-formed object
+void check_structure(std::string const& json)
+{
+    std::string const prefix =
+        "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    HPX_TEST_EQ(json.compare(0, prefix.size(), prefix), 0);
+    HPX_TEST_EQ(json.substr(json.size() - 4), std::string("\n]}\n"));
+    HPX_TEST_EQ(count_occurrences(json, "{"), count_occurrences(json, "}"));
+    HPX_TEST_EQ(count_occurrences(json, "["), count_occurrences(json, "]"));
+}
+
+std::string export_trace()
+{
+    std::ostringstream os;
+    tracing::export_chrome_trace(os, 42);
+    return os.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_record_and_export()
+{
+    int thread = 0;
+    hpx::util::thread_description desc("test \"thread\"");
+
+    tracing::enable(16);
+    HPX_TEST(tracing::is_enabled());
+
+    tracing::record(tracing::event_type::thread_create, &thread, desc);
+    tracing::record(tracing::event_type::thread_run, &thread, desc);
+    tracing::record(tracing::event_type::thread_suspend, &thread, desc);
+    tracing::record(tracing::event_type::parcel_send, nullptr, 7);
+    tracing::record(tracing::event_type::parcel_receive, nullptr, 1024, 3);
+
+    tracing::disable();
+    HPX_TEST(!tracing::is_enabled());
+
+    // events are not recorded while tracing is disabled
+    tracing::record(tracing::event_type::thread_run, &thread, desc);
+    HPX_TEST_EQ(tracing::get_event_count(), std::uint64_t(5));
+
+    std::string const json = export_trace();
+    check_structure(json);
+
+    HPX_TEST_EQ(count_occurrences(json, "\"ph\":\"M\""), std::size_t(1));
+    HPX_TEST_EQ(count_occurrences(json, "\"pid\":42"), std::size_t(5));
+
+    // the run and suspend events are combined into a single complete event
+    HPX_TEST_EQ(count_occurrences(json, "\"ph\":\"X\""), std::size_t(1));
+    HPX_TEST_EQ(count_occurrences(json, "\"state\":\"suspended\""),
+        std::size_t(1));
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+    // quotes in descriptions are escaped
+    std::string const name = "test \\\"thread\\\"";
+#else
+    std::string const name = "<unknown>";
+#endif
+    HPX_TEST_EQ(count_occurrences(json, "\"name\":\"" + name + "\""),
+        std::size_t(1));
+
+    HPX_TEST_EQ(count_occurrences(json, "\"name\":\"thread_create\""),
+        std::size_t(1));
+    HPX_TEST_EQ(count_occurrences(json, "\"description\":\"" + name + "\""),
+        std::size_t(1));
+    HPX_TEST_EQ(count_occurrences(json, "\"destination\":7"), std::size_t(1));
+    HPX_TEST_EQ(count_occurrences(json, "\"bytes\":1024,\"parcels\":3"),
+        std::size_t(1));
+
+    tracing::clear();
+    HPX_TEST_EQ(tracing::get_event_count(), std::uint64_t(0));
+
+    std::string const empty = export_trace();
+    check_structure(empty);
+    HPX_TEST_EQ(count_occurrences(empty, "\"ph\""), std::size_t(0));
+}
+
+// only the last events fitting into the buffer are exported
+void test_wrap_around()
+{
+    tracing::enable(16);
+    for (int i = 0; i != 100; ++i)
+    {
+        tracing::record(tracing::event_type::parcel_send, nullptr, i);
+    }
+    tracing::disable();
+
+    HPX_TEST_EQ(tracing::get_event_count(), std::uint64_t(100));
+
+    std::string const json = export_trace();
+    check_structure(json);
+    HPX_TEST_EQ(count_occurrences(json, "\"name\":\"parcel_send\""),
+        std::size_t(16));
+    HPX_TEST_EQ(count_occurrences(json, "\"destination\":83}"), std::size_t(0));
+    HPX_TEST_EQ(count_occurrences(json, "\"destination\":84}"), std::size_t(1));
+    HPX_TEST_EQ(count_occurrences(json, "\"destination\":99}"), std::size_t(1));
+
+    tracing::clear();
+}
+
+// every thread records into its own buffer, threads which recorded events
+// before the trace was cleared keep working afterwards
+void test_multiple_threads()
+{
+    for (int round = 0; round != 2; ++round)
+    {
+        tracing::enable(1024);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t != 4; ++t)
+        {
+            threads.emplace_back([] {
+                for (int i = 0; i != 100; ++i)
+                {
+                    tracing::record(tracing::event_type::parcel_send);
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        // this thread has recorded events before the previous clear, it
+        // gets a new buffer as well
+        tracing::record(tracing::event_type::parcel_send);
+
+        tracing::disable();
+
+        HPX_TEST_EQ(tracing::get_event_count(), std::uint64_t(401));
+
+        std::string const json = export_trace();
+        check_structure(json);
+        HPX_TEST_EQ(count_occurrences(json, "\"ph\":\"M\""), std::size_t(5));
+
+        tracing::clear();
+    }
+}
+
+int main()
+{
+    test_record_and_export();
+    test_wrap_around();
+    test_multiple_threads();
+
+    return hpx::util::report_errors();
+}
@@ -117,6 +117,12 @@ namespace hpx { namespace actions {
         /// Return a pointer to the message handler to be used for this action.
         virtual parcelset::policies::message_handler* get_message_handler(
             parcelset::locality const& loc) const = 0;
+
+        /// Return the number of bytes this action occupies when being
+        /// serialized if that number is known at compile time, otherwise
+        /// return std::size_t(-1). Actions with a constant serialized size
+        /// don't have to be preprocessed before being serialized.
+        virtual std::size_t get_serialized_size() const = 0;
 #endif
 
         virtual void load(serialization::input_archive& ar) = 0;
@@ -165,6 +171,9 @@ namespace hpx { namespace actions {
         static std::uint32_t get_locality_id();
 
     protected:
+        // return the number of bytes written by save_base
+        static std::size_t get_serialized_base_size();
+
         // serialization support
         void load_base(hpx::serialization::input_archive& ar);
         void save_base(hpx::serialization::output_archive& ar);
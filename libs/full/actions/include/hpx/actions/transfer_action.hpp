@@ -22,6 +22,7 @@
 #include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/needs_automatic_registration.hpp>
+#include <hpx/serialization/traits/serialized_size.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -98,6 +99,10 @@ namespace hpx { namespace actions {
             naming::address::component_type comptype,
             std::size_t num_thread) override;
 
+        // the serialized size is known if all arguments have a constant
+        // serialized size
+        std::size_t get_serialized_size() const override;
+
         // serialization support
         // loading ...
         void load(hpx::serialization::input_archive& ar) override;
@@ -196,6 +201,21 @@ namespace hpx { namespace actions {
         this->increment_invocation_count();
     }
 
+    template <typename Action>
+    std::size_t transfer_action<Action>::get_serialized_size() const
+    {
+        using arguments_type = typename base_type::arguments_type;
+        if constexpr (traits::has_constant_serialized_size_v<arguments_type>)
+        {
+            return traits::serialized_size_v<arguments_type> +
+                this->get_serialized_base_size();
+        }
+        else
+        {
+            return std::size_t(-1);
+        }
+    }
+
     template <typename Action>
     void transfer_action<Action>::load(hpx::serialization::input_archive& ar)
     {
@@ -13,7 +13,9 @@
 #include <hpx/serialization/output_archive.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/serialized_size.hpp>
 
+#include <cstddef>
 #include <cstdint>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -116,6 +118,12 @@ namespace hpx { namespace actions {
         ar << data;
     }
 
+    std::size_t base_action_data::get_serialized_base_size()
+    {
+        return hpx::traits::serialized_size_v<
+            detail::action_serialization_data>;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::uint32_t base_action_data::get_locality_id()
     {
@@ -1115,6 +1115,18 @@ namespace hpx { namespace agas {
         naming::id_type resolve_name(
             std::string const& name, error_code& ec = throws);
 
+        /// \brief Register or resolve a set of global names at once.
+        ///
+        /// These functions send a single request to each of the localities
+        /// responsible for any of the given names. The results are returned
+        /// in the order of the given names.
+        hpx::future<std::vector<bool>> register_names_async(
+            std::vector<std::pair<std::string, naming::id_type>> const&
+                entries);
+
+        hpx::future<std::vector<naming::id_type>> resolve_names_async(
+            std::vector<std::string> const& names);
+
         /// \brief Install a listener for a given symbol namespace event.
         ///
         /// This function installs a listener for a given symbol namespace event.
@@ -1139,6 +1151,15 @@ namespace hpx { namespace agas {
         future<hpx::id_type> on_symbol_namespace_event(
             std::string const& name, bool call_for_past_events = false);
 
+        /// \brief Install listeners for a set of global names at once.
+        ///
+        /// This is equivalent to calling \a on_symbol_namespace_event for
+        /// each of the given names, except that all listeners handled by the
+        /// same locality are installed using a single request.
+        std::vector<future<hpx::id_type>> on_symbol_namespace_events(
+            std::vector<std::string> const& names,
+            bool call_for_past_events = false);
+
         /// \warning This function is for internal use only. It is dangerous and
         ///          may break your code if you use it.
         void update_cache_entry(naming::gid_type const& gid, gva const& gva,
@@ -1545,6 +1545,70 @@ namespace hpx { namespace agas {
         return symbol_ns_.resolve_async(name);
     }    // }}}
 
+    hpx::future<std::vector<bool>> addressing_service::register_names_async(
+        std::vector<std::pair<std::string, naming::id_type>> const& entries)
+    {
+        std::vector<std::pair<std::string, naming::gid_type>> gids;
+        gids.reserve(entries.size());
+
+        std::vector<naming::id_type> ids;
+        ids.reserve(entries.size());
+
+        std::vector<std::int64_t> credits;
+        credits.reserve(entries.size());
+
+        for (auto const& entry : entries)
+        {
+            // We need to modify the reference count.
+            naming::gid_type& mutable_gid =
+                const_cast<naming::id_type&>(entry.second).get_gid();
+            naming::gid_type new_gid =
+                naming::detail::split_gid_if_needed(mutable_gid).get();
+
+            ids.push_back(entry.second);
+            credits.push_back(naming::detail::get_credit_from_gid(new_gid));
+            gids.emplace_back(entry.first, HPX_MOVE(new_gid));
+        }
+
+        return symbol_ns_.bind_names_async(HPX_MOVE(gids))
+            .then(hpx::launch::sync,
+                [ids = HPX_MOVE(ids), credits = HPX_MOVE(credits)](
+                    hpx::future<std::vector<bool>>&& f) mutable {
+                    // Return the credit to the GIDs for which the operation
+                    // failed
+                    if (f.has_exception())
+                    {
+                        for (std::size_t i = 0; i != ids.size(); ++i)
+                        {
+                            if (credits[i] != 0)
+                            {
+                                naming::detail::add_credit_to_gid(
+                                    ids[i].get_gid(), credits[i]);
+                            }
+                        }
+                        return f.get();
+                    }
+
+                    std::vector<bool> result = f.get();
+                    for (std::size_t i = 0; i != ids.size(); ++i)
+                    {
+                        if (!result[i] && credits[i] != 0)
+                        {
+                            naming::detail::add_credit_to_gid(
+                                ids[i].get_gid(), credits[i]);
+                        }
+                    }
+                    return result;
+                });
+    }
+
+    hpx::future<std::vector<naming::id_type>>
+    addressing_service::resolve_names_async(
+        std::vector<std::string> const& names)
+    {
+        return symbol_ns_.resolve_names_async(names);
+    }
+
     namespace detail {
         hpx::future<hpx::id_type> on_register_event(
             hpx::future<bool> f, hpx::future<hpx::id_type> result_f)
@@ -1559,6 +1623,21 @@ namespace hpx { namespace agas {
 
             return result_f;
         }
+
+        hpx::future<hpx::id_type> on_register_events(
+            hpx::shared_future<std::vector<bool>> f, std::size_t i,
+            hpx::future<hpx::id_type> result_f)
+        {
+            if (!f.get()[i])
+            {
+                HPX_THROW_EXCEPTION(bad_request,
+                    "hpx::agas::detail::on_register_events",
+                    "request 'symbol_ns_on_event' failed");
+                return hpx::future<hpx::id_type>();
+            }
+
+            return result_f;
+        }
     }    // namespace detail
 
     future<hpx::id_type> addressing_service::on_symbol_namespace_event(
@@ -1575,6 +1654,35 @@ namespace hpx { namespace agas {
                 &detail::on_register_event, HPX_MOVE(result_f))));
     }
 
+    std::vector<future<hpx::id_type>>
+    addressing_service::on_symbol_namespace_events(
+        std::vector<std::string> const& names, bool call_for_past_events)
+    {
+        std::vector<future<hpx::id_type>> results;
+        results.reserve(names.size());
+
+        std::vector<std::pair<std::string, hpx::id_type>> entries;
+        entries.reserve(names.size());
+
+        for (std::string const& name : names)
+        {
+            lcos::promise<naming::id_type, naming::gid_type> p;
+            results.push_back(p.get_future());
+            entries.emplace_back(name, p.get_id());
+        }
+
+        hpx::shared_future<std::vector<bool>> f =
+            symbol_ns_.on_events(HPX_MOVE(entries), call_for_past_events);
+
+        for (std::size_t i = 0; i != results.size(); ++i)
+        {
+            results[i] = f.then(hpx::launch::sync,
+                util::one_shot(util::bind_back(&detail::on_register_events, i,
+                    HPX_MOVE(results[i]))));
+        }
+        return results;
+    }
+
     // Return all matching entries in the symbol namespace
     hpx::future<addressing_service::iterate_names_return_type>
     addressing_service::iterate_ids(std::string const& pattern)
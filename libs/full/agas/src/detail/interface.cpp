@@ -80,6 +80,19 @@ namespace hpx { namespace agas { namespace detail { namespace impl {
         return naming::get_agas_client().resolve_name(name, ec);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    future<std::vector<bool>> register_names_async(
+        std::vector<std::pair<std::string, naming::id_type>> const& entries)
+    {
+        return naming::get_agas_client().register_names_async(entries);
+    }
+
+    future<std::vector<naming::id_type>> resolve_names_async(
+        std::vector<std::string> const& names)
+    {
+        return naming::get_agas_client().resolve_names_async(names);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     future<std::uint32_t> get_num_localities_async(components::component_type)
     {
@@ -434,6 +447,13 @@ namespace hpx { namespace agas { namespace detail { namespace impl {
             name, call_for_past_events);
     }
 
+    std::vector<hpx::future<hpx::id_type>> on_symbol_namespace_events(
+        std::vector<std::string> const& names, bool call_for_past_events)
+    {
+        return naming::get_agas_client().on_symbol_namespace_events(
+            names, call_for_past_events);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<std::pair<naming::id_type, naming::address>> begin_migration(
         naming::id_type const& id)
@@ -540,6 +560,9 @@ namespace hpx { namespace agas {
             detail::resolve_name_async = &detail::impl::resolve_name_async;
             detail::resolve_name = &detail::impl::resolve_name;
 
+            detail::register_names_async = &detail::impl::register_names_async;
+            detail::resolve_names_async = &detail::impl::resolve_names_async;
+
             detail::get_num_localities_async =
                 &detail::impl::get_num_localities_async;
             detail::get_num_localities = &detail::impl::get_num_localities;
@@ -609,6 +632,8 @@ namespace hpx { namespace agas {
 
             detail::on_symbol_namespace_event =
                 &detail::impl::on_symbol_namespace_event;
+            detail::on_symbol_namespace_events =
+                &detail::impl::on_symbol_namespace_events;
 
             detail::begin_migration = &detail::impl::begin_migration;
             detail::end_migration = &detail::impl::end_migration;
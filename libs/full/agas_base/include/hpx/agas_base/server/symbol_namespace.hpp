@@ -19,13 +19,20 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming_base/id_type.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <array>
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -51,16 +58,39 @@ namespace hpx { namespace agas { namespace server {
         using iterate_names_return_type =
             std::map<std::string, naming::gid_type>;
 
-        using gid_table_type =
-            std::map<std::string, std::shared_ptr<naming::gid_type>>;
+        using gid_table_type = std::unordered_map<std::string,
+            std::shared_ptr<naming::gid_type>>;
 
-        using on_event_data_map_type = std::multimap<std::string, hpx::id_type>;
+        using on_event_data_map_type =
+            std::unordered_multimap<std::string, hpx::id_type>;
+
+        using name_index_type = std::set<std::string>;
+
+        static constexpr std::size_t num_name_shards = 16;
 
     private:
-        mutex_type mutex_;
-        gid_table_type gids_;
+        // The names are distributed over a fixed number of independently
+        // locked shards to reduce contention between concurrent lookups.
+        // Pending event listeners are kept in the same shard as the name
+        // they are waiting for.
+        struct name_shard
+        {
+            mutex_type mutex_;
+            gid_table_type gids_;
+            on_event_data_map_type on_event_data_;
+        };
+
+        name_shard& get_shard(std::string const& key);
+
+        std::array<name_shard, num_name_shards> shards_;
+
+        // Ordered index of all bound names, used for pattern queries only.
+        // It is updated while holding the lock of the shard the name
+        // belongs to (the shard mutex is always acquired first).
+        mutex_type names_mutex_;
+        name_index_type names_;
+
         std::string instance_name_;
-        on_event_data_map_type on_event_data_;
 
     public:
         // data structure holding all counters for the omponent_namespace component
@@ -151,11 +181,26 @@ namespace hpx { namespace agas { namespace server {
         bool on_event(std::string const& name, bool call_for_past_events,
             hpx::id_type lco);
 
+        // bulk versions of the operations above, these allow to handle all
+        // names managed by one symbol namespace instance with a single action
+        std::vector<bool> bind_names(
+            std::vector<std::pair<std::string, naming::gid_type>> entries);
+
+        std::vector<naming::gid_type> resolve_names(
+            std::vector<std::string> const& keys);
+
+        std::vector<bool> on_events(
+            std::vector<std::pair<std::string, hpx::id_type>> const& entries,
+            bool call_for_past_events);
+
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, unbind)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, iterate)
         HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_event)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, bind_names)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, resolve_names)
+        HPX_DEFINE_COMPONENT_ACTION(symbol_namespace, on_events)
     };
 
 }}}    // namespace hpx::agas::server
@@ -193,4 +238,25 @@ HPX_REGISTER_ACTION_DECLARATION(
     hpx::agas::server::symbol_namespace::on_event_action,
     symbol_namespace_on_event_action)
 
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::bind_names_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::bind_names_action,
+    symbol_namespace_bind_names_action)
+
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::resolve_names_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::resolve_names_action,
+    symbol_namespace_resolve_names_action)
+
+HPX_ACTION_USES_MEDIUM_STACK(
+    hpx::agas::server::symbol_namespace::on_events_action)
+
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::agas::server::symbol_namespace::on_events_action,
+    symbol_namespace_on_events_action)
+
 #include <hpx/config/warnings_suffix.hpp>
@@ -21,6 +21,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
@@ -52,6 +53,9 @@ namespace hpx { namespace agas {
             return is_service_instance(id.get_gid());
         }
 
+        static std::uint32_t symbol_namespace_locality_id(
+            std::string const& key);
+
         static naming::id_type symbol_namespace_locality(
             std::string const& key);
 
@@ -74,6 +78,19 @@ namespace hpx { namespace agas {
         hpx::future<bool> on_event(std::string const& name,
             bool call_for_past_events, hpx::id_type lco);
 
+        // The bulk operations send a single action to each of the symbol
+        // namespace instances responsible for any of the given names. The
+        // results are returned in the order of the given names.
+        hpx::future<std::vector<bool>> bind_names_async(
+            std::vector<std::pair<std::string, naming::gid_type>> entries);
+
+        hpx::future<std::vector<naming::id_type>> resolve_names_async(
+            std::vector<std::string> keys) const;
+
+        hpx::future<std::vector<bool>> on_events(
+            std::vector<std::pair<std::string, hpx::id_type>> entries,
+            bool call_for_past_events);
+
         hpx::future<iterate_names_return_type> iterate_async(
             std::string const& pattern) const;
         iterate_names_return_type iterate(std::string const& pattern) const;
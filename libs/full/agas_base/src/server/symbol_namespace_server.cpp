@@ -27,6 +27,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -86,6 +87,12 @@ namespace hpx { namespace agas { namespace server {
         }
     }
 
+    symbol_namespace::name_shard& symbol_namespace::get_shard(
+        std::string const& key)
+    {
+        return shards_[std::hash<std::string>()(key) % num_name_shards];
+    }
+
     bool symbol_namespace::bind(std::string key, naming::gid_type gid)
     {    // {{{ bind implementation
         // parameters
@@ -93,10 +100,11 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.bind_.time_, counter_data_.bind_.enabled_);
         counter_data_.increment_bind_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        name_shard& shard = get_shard(key);
+        std::unique_lock<mutex_type> l(shard.mutex_);
 
-        gid_table_type::iterator it = gids_.find(key);
-        gid_table_type::iterator end = gids_.end();
+        gid_table_type::iterator it = shard.gids_.find(key);
+        gid_table_type::iterator end = shard.gids_.end();
 
         if (it != end)
         {
@@ -139,7 +147,7 @@ namespace hpx { namespace agas { namespace server {
             return false;
         }
 
-        if (HPX_UNLIKELY(!util::insert_checked(gids_.insert(
+        if (HPX_UNLIKELY(!util::insert_checked(shard.gids_.insert(
                 std::make_pair(key, std::make_shared<naming::gid_type>(gid))))))
         {
             l.unlock();
@@ -149,9 +157,14 @@ namespace hpx { namespace agas { namespace server {
                 "memory corruption");
         }
 
+        {
+            std::lock_guard<mutex_type> ll(names_mutex_);
+            names_.insert(key);
+        }
+
         // handle registered events
         typedef on_event_data_map_type::iterator iterator;
-        std::pair<iterator, iterator> p = on_event_data_.equal_range(key);
+        std::pair<iterator, iterator> p = shard.on_event_data_.equal_range(key);
 
         std::vector<hpx::id_type> lcos;
         if (p.first != p.second)
@@ -163,7 +176,7 @@ namespace hpx { namespace agas { namespace server {
                 ++it;
             }
 
-            on_event_data_.erase(p.first, p.second);
+            shard.on_event_data_.erase(p.first, p.second);
 
             // notify all LCOS which were registered with this name
             for (hpx::id_type const& id : lcos)
@@ -171,8 +184,8 @@ namespace hpx { namespace agas { namespace server {
                 // re-locate the entry in the GID table for each LCO anew, as we
                 // need to unlock the mutex protecting the table for each iteration
                 // below
-                gid_table_type::iterator gid_it = gids_.find(key);
-                if (gid_it == gids_.end())
+                gid_table_type::iterator gid_it = shard.gids_.find(key);
+                if (gid_it == shard.gids_.end())
                 {
                     l.unlock();
 
@@ -218,13 +231,16 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.resolve_.time_, counter_data_.resolve_.enabled_);
         counter_data_.increment_resolve_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        name_shard& shard = get_shard(key);
+        std::unique_lock<mutex_type> l(shard.mutex_);
 
-        gid_table_type::iterator it = gids_.find(key);
-        gid_table_type::iterator end = gids_.end();
+        gid_table_type::iterator it = shard.gids_.find(key);
+        gid_table_type::iterator end = shard.gids_.end();
 
         if (it == end)
         {
+            l.unlock();
+
             LAGAS_(info).format(
                 "symbol_namespace::resolve, key({1}), response(no_success)",
                 key);
@@ -253,13 +269,16 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.unbind_.time_, counter_data_.unbind_.enabled_);
         counter_data_.increment_unbind_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        name_shard& shard = get_shard(key);
+        std::unique_lock<mutex_type> l(shard.mutex_);
 
-        gid_table_type::iterator it = gids_.find(key);
-        gid_table_type::iterator end = gids_.end();
+        gid_table_type::iterator it = shard.gids_.find(key);
+        gid_table_type::iterator end = shard.gids_.end();
 
         if (it == end)
         {
+            l.unlock();
+
             LAGAS_(info).format(
                 "symbol_namespace::unbind, key({1}), response(no_success)",
                 key);
@@ -269,7 +288,12 @@ namespace hpx { namespace agas { namespace server {
 
         naming::gid_type const gid = *(it->second);
 
-        gids_.erase(it);
+        shard.gids_.erase(it);
+
+        {
+            std::lock_guard<mutex_type> ll(names_mutex_);
+            names_.erase(key);
+        }
 
         l.unlock();
 
@@ -290,42 +314,59 @@ namespace hpx { namespace agas { namespace server {
 
         std::map<std::string, naming::gid_type> found;
 
-        if (pattern.find_first_of("*?[]") != std::string::npos)
+        // collect the candidate names first, the gids are retrieved from the
+        // shards afterwards
+        std::vector<std::string> names;
+
+        std::string::size_type wildcard = pattern.find_first_of("*?[]\\");
+        if (wildcard != std::string::npos)
         {
             std::string str_rx(util::regex_from_pattern(pattern, throws));
             std::regex rx(str_rx);
 
-            std::unique_lock<mutex_type> l(mutex_);
-            for (gid_table_type::iterator it = gids_.begin(); it != gids_.end();
+            // only names starting with the literal prefix of the pattern have
+            // to be matched against the regular expression
+            std::string const prefix = pattern.substr(0, wildcard);
+
+            std::lock_guard<mutex_type> l(names_mutex_);
+            for (auto it = names_.lower_bound(prefix); it != names_.end();
                  ++it)
             {
-                if (!std::regex_match(it->first, rx))
-                    continue;
-
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(it->second);
-                util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+                if (it->compare(0, prefix.size(), prefix) != 0)
+                    break;
 
-                found[it->first] =
-                    naming::detail::split_gid_if_needed(*current_gid).get();
+                if (std::regex_match(*it, rx))
+                {
+                    names.push_back(*it);
+                }
             }
         }
+        else if (pattern.empty())
+        {
+            std::lock_guard<mutex_type> l(names_mutex_);
+            names.assign(names_.begin(), names_.end());
+        }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
-            for (gid_table_type::iterator it = gids_.begin(); it != gids_.end();
-                 ++it)
-            {
-                if (!pattern.empty() && pattern != it->first)
-                    continue;
+            names.push_back(pattern);
+        }
 
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(it->second);
-                util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+        for (std::string& name : names)
+        {
+            name_shard& shard = get_shard(name);
+            std::unique_lock<mutex_type> l(shard.mutex_);
 
-                found[it->first] =
-                    naming::detail::split_gid_if_needed(*current_gid).get();
-            }
+            // the entry might have been unbound concurrently
+            gid_table_type::iterator it = shard.gids_.find(name);
+            if (it == shard.gids_.end())
+                continue;
+
+            // hold on to entry while map is unlocked
+            std::shared_ptr<naming::gid_type> current_gid(it->second);
+            l.unlock();
+
+            found[HPX_MOVE(name)] =
+                naming::detail::split_gid_if_needed(*current_gid).get();
         }
 
         LAGAS_(info).format("symbol_namespace::iterate");
@@ -340,15 +381,16 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.on_event_.time_, counter_data_.on_event_.enabled_);
         counter_data_.increment_on_event_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        name_shard& shard = get_shard(name);
+        std::unique_lock<mutex_type> l(shard.mutex_);
 
         bool handled = false;
         naming::gid_type new_gid;
 
         if (call_for_past_events)
         {
-            gid_table_type::iterator it = gids_.find(name);
-            if (it != gids_.end())
+            gid_table_type::iterator it = shard.gids_.find(name);
+            if (it != shard.gids_.end())
             {
                 // hold on to entry while map is unlocked
                 std::shared_ptr<naming::gid_type> current_gid(it->second);
@@ -376,12 +418,12 @@ namespace hpx { namespace agas { namespace server {
 
         if (!handled)
         {
-            on_event_data_map_type::iterator it = on_event_data_.insert(
+            on_event_data_map_type::iterator it = shard.on_event_data_.insert(
                 on_event_data_map_type::value_type(name, lco));
 
             // This overload of insert always returns the iterator pointing
             // to the inserted value. It should never point to end
-            HPX_ASSERT(it != on_event_data_.end());
+            HPX_ASSERT(it != shard.on_event_data_.end());
             HPX_UNUSED(it);
         }
         l.unlock();
@@ -391,6 +433,45 @@ namespace hpx { namespace agas { namespace server {
         return true;
     }    // }}}
 
+    std::vector<bool> symbol_namespace::bind_names(
+        std::vector<std::pair<std::string, naming::gid_type>> entries)
+    {
+        std::vector<bool> result;
+        result.reserve(entries.size());
+        for (auto& entry : entries)
+        {
+            result.push_back(
+                bind(HPX_MOVE(entry.first), HPX_MOVE(entry.second)));
+        }
+        return result;
+    }
+
+    std::vector<naming::gid_type> symbol_namespace::resolve_names(
+        std::vector<std::string> const& keys)
+    {
+        std::vector<naming::gid_type> result;
+        result.reserve(keys.size());
+        for (std::string const& key : keys)
+        {
+            result.push_back(resolve(key));
+        }
+        return result;
+    }
+
+    std::vector<bool> symbol_namespace::on_events(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries,
+        bool call_for_past_events)
+    {
+        std::vector<bool> result;
+        result.reserve(entries.size());
+        for (auto const& entry : entries)
+        {
+            result.push_back(
+                on_event(entry.first, call_for_past_events, entry.second));
+        }
+        return result;
+    }
+
     // access current counter values
     std::int64_t symbol_namespace::counter_data::get_bind_count(bool reset)
     {
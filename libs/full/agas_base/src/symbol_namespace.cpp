@@ -18,6 +18,7 @@
 #include <hpx/modules/async_distributed.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
@@ -51,6 +52,18 @@ HPX_REGISTER_ACTION_ID(symbol_namespace::on_event_action,
     symbol_namespace_on_event_action,
     hpx::actions::symbol_namespace_on_event_action_id)
 
+HPX_REGISTER_ACTION_ID(symbol_namespace::bind_names_action,
+    symbol_namespace_bind_names_action,
+    hpx::actions::symbol_namespace_bind_names_action_id)
+
+HPX_REGISTER_ACTION_ID(symbol_namespace::resolve_names_action,
+    symbol_namespace_resolve_names_action,
+    hpx::actions::symbol_namespace_resolve_names_action_id)
+
+HPX_REGISTER_ACTION_ID(symbol_namespace::on_events_action,
+    symbol_namespace_on_events_action,
+    hpx::actions::symbol_namespace_on_events_action_id)
+
 namespace hpx { namespace agas {
 
     naming::gid_type symbol_namespace::get_service_instance(
@@ -84,7 +97,7 @@ namespace hpx { namespace agas {
             agas::symbol_ns_msb;
     }
 
-    naming::id_type symbol_namespace::symbol_namespace_locality(
+    std::uint32_t symbol_namespace::symbol_namespace_locality_id(
         std::string const& key)
     {
         std::uint32_t hash_value = 0;
@@ -94,8 +107,15 @@ namespace hpx { namespace agas {
             util::jenkins_hash hash;
             hash_value = hash(key) % get_initial_num_localities();
         }
+        return hash_value;
+    }
+
+    naming::id_type symbol_namespace::symbol_namespace_locality(
+        std::string const& key)
+    {
         return naming::id_type(
-            get_service_instance(hash_value), naming::id_type::unmanaged);
+            get_service_instance(symbol_namespace_locality_id(key)),
+            naming::id_type::unmanaged);
     }
 
     symbol_namespace::symbol_namespace()
@@ -240,6 +260,167 @@ namespace hpx { namespace agas {
     }
 }}    // namespace hpx::agas
 
+namespace hpx { namespace agas {
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+    namespace detail {
+
+        // Split the given requests into one group per locality responsible
+        // for the corresponding names, invoke the given function once for
+        // each of the groups, and scatter the results back into the order of
+        // the original requests.
+        template <typename Result, typename Request, typename GetKey,
+            typename F>
+        hpx::future<std::vector<Result>> bulk_symbol_namespace_request(
+            std::vector<Request>&& requests, GetKey&& get_key, F&& f)
+        {
+            using group_type =
+                std::pair<std::vector<std::size_t>, std::vector<Request>>;
+
+            std::map<std::uint32_t, group_type> groups;
+            for (std::size_t i = 0; i != requests.size(); ++i)
+            {
+                group_type& group =
+                    groups[symbol_namespace::symbol_namespace_locality_id(
+                        get_key(requests[i]))];
+
+                group.first.push_back(i);
+                group.second.push_back(HPX_MOVE(requests[i]));
+            }
+
+            std::vector<std::vector<std::size_t>> indices;
+            indices.reserve(groups.size());
+
+            std::vector<hpx::future<std::vector<Result>>> results;
+            results.reserve(groups.size());
+
+            for (auto& group : groups)
+            {
+                indices.push_back(HPX_MOVE(group.second.first));
+                results.push_back(
+                    f(group.first, HPX_MOVE(group.second.second)));
+            }
+
+            return hpx::dataflow(
+                hpx::unwrapping([count = requests.size(),
+                                    indices = HPX_MOVE(indices)](
+                                    std::vector<std::vector<Result>>&& data) {
+                    std::vector<Result> result(count);
+                    for (std::size_t i = 0; i != data.size(); ++i)
+                    {
+                        HPX_ASSERT(data[i].size() == indices[i].size());
+                        for (std::size_t j = 0; j != data[i].size(); ++j)
+                        {
+                            result[indices[i][j]] = HPX_MOVE(data[i][j]);
+                        }
+                    }
+                    return result;
+                }),
+                HPX_MOVE(results));
+        }
+    }    // namespace detail
+#endif
+
+    hpx::future<std::vector<bool>> symbol_namespace::bind_names_async(
+        std::vector<std::pair<std::string, naming::gid_type>> entries)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        using entry_type = std::pair<std::string, naming::gid_type>;
+
+        return detail::bulk_symbol_namespace_request<bool>(
+            HPX_MOVE(entries),
+            [](entry_type const& entry) -> std::string const& {
+                return entry.first;
+            },
+            [this](std::uint32_t locality_id,
+                std::vector<entry_type>&& group) {
+                if (locality_id == agas::get_locality_id())
+                {
+                    return hpx::make_ready_future(
+                        server_->bind_names(HPX_MOVE(group)));
+                }
+
+                server::symbol_namespace::bind_names_action action;
+                return hpx::async(action,
+                    naming::id_type(get_service_instance(locality_id),
+                        naming::id_type::unmanaged),
+                    HPX_MOVE(group));
+            });
+#else
+        HPX_UNUSED(entries);
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<bool>{});
+#endif
+    }
+
+    hpx::future<std::vector<naming::id_type>>
+    symbol_namespace::resolve_names_async(std::vector<std::string> keys) const
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        return detail::bulk_symbol_namespace_request<naming::id_type>(
+            HPX_MOVE(keys),
+            [](std::string const& key) -> std::string const& { return key; },
+            [this](std::uint32_t locality_id,
+                std::vector<std::string>&& group) {
+                if (locality_id == agas::get_locality_id())
+                {
+                    // convert the gids the same way as for remote results
+                    using get_remote_result =
+                        traits::get_remote_result<std::vector<naming::id_type>,
+                            std::vector<naming::gid_type>>;
+
+                    return hpx::make_ready_future(get_remote_result::call(
+                        server_->resolve_names(group)));
+                }
+
+                server::symbol_namespace::resolve_names_action action;
+                return hpx::async(action,
+                    naming::id_type(get_service_instance(locality_id),
+                        naming::id_type::unmanaged),
+                    HPX_MOVE(group));
+            });
+#else
+        HPX_UNUSED(keys);
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<naming::id_type>{});
+#endif
+    }
+
+    hpx::future<std::vector<bool>> symbol_namespace::on_events(
+        std::vector<std::pair<std::string, hpx::id_type>> entries,
+        bool call_for_past_events)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        using entry_type = std::pair<std::string, hpx::id_type>;
+
+        return detail::bulk_symbol_namespace_request<bool>(
+            HPX_MOVE(entries),
+            [](entry_type const& entry) -> std::string const& {
+                return entry.first;
+            },
+            [this, call_for_past_events](std::uint32_t locality_id,
+                std::vector<entry_type>&& group) {
+                if (locality_id == agas::get_locality_id())
+                {
+                    return hpx::make_ready_future(
+                        server_->on_events(group, call_for_past_events));
+                }
+
+                server::symbol_namespace::on_events_action action;
+                return hpx::async(action,
+                    naming::id_type(get_service_instance(locality_id),
+                        naming::id_type::unmanaged),
+                    HPX_MOVE(group), call_for_past_events);
+            });
+#else
+        HPX_UNUSED(entries);
+        HPX_UNUSED(call_for_past_events);
+        HPX_ASSERT(false);
+        return hpx::make_ready_future(std::vector<bool>{});
+#endif
+    }
+}}    // namespace hpx::agas
+
 namespace hpx { namespace agas {
 
     hpx::future<symbol_namespace::iterate_names_return_type>
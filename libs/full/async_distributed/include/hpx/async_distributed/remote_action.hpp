@@ -0,0 +1,317 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file remote_action.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/basic_action_fwd.hpp>
+#include <hpx/actions_base/traits/action_select_direct_execution.hpp>
+#include <hpx/actions_base/traits/action_was_object_migrated.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/detail/async_implementations.hpp>
+#include <hpx/async_distributed/packaged_action.hpp>
+#include <hpx/async_local/apply.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/pinned_ptr.hpp>
+#include <hpx/components_base/traits/component_supports_migration.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors/try_catch_exception_ptr.hpp>
+#include <hpx/execution_base/operation_state.hpp>
+#include <hpx/execution_base/receiver.hpp>
+#include <hpx/execution_base/sender.hpp>
+#include <hpx/functional/tag_invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/future_access.hpp>
+#include <hpx/futures/traits/get_remote_result.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace execution { namespace experimental {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        template <typename Action, typename Receiver, typename... Ts>
+        struct remote_action_operation_state
+        {
+            using action_type =
+                typename hpx::traits::extract_action<Action>::type;
+            using component_type = typename action_type::component_type;
+            using result_type = typename action_type::local_result_type;
+            using remote_result_type = typename action_type::remote_result_type;
+
+            using shared_state_ptr =
+                hpx::traits::detail::shared_state_ptr_t<result_type>;
+
+            template <typename Receiver_, typename Id, typename Args>
+            remote_action_operation_state(
+                Receiver_&& receiver, Id&& id, Args&& args)
+              : receiver(HPX_FORWARD(Receiver_, receiver))
+              , id(HPX_FORWARD(Id, id))
+              , args(HPX_FORWARD(Args, args))
+            {
+            }
+
+            remote_action_operation_state(
+                remote_action_operation_state&&) = delete;
+            remote_action_operation_state& operator=(
+                remote_action_operation_state&&) = delete;
+
+            HPX_NO_UNIQUE_ADDRESS std::decay_t<Receiver> receiver;
+            hpx::id_type id;
+            hpx::tuple<Ts...> args;
+
+            // keeps the target object from being migrated while a local
+            // invocation is running
+            components::pinned_ptr pinned;
+
+            // the shared state of the promise a remote invocation reports
+            // its result to
+            shared_state_ptr state;
+
+            // Invoke the action locally and report the result to the
+            // receiver.
+            template <std::size_t... Is>
+            void invoke_local(
+                naming::address const& addr, hpx::util::index_pack<Is...>)
+            {
+                using get_remote_result_type =
+                    hpx::traits::get_remote_result<result_type,
+                        remote_result_type>;
+
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        if constexpr (std::is_void_v<result_type>)
+                        {
+                            action_type::execute_function(addr.address_,
+                                addr.type_, HPX_MOVE(hpx::get<Is>(args))...);
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(receiver));
+                        }
+                        else
+                        {
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(receiver),
+                                get_remote_result_type::call(
+                                    action_type::execute_function(
+                                        addr.address_, addr.type_,
+                                        HPX_MOVE(hpx::get<Is>(args))...)));
+                        }
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(receiver), HPX_MOVE(ep));
+                    });
+            }
+
+            // Report the result received from the remote locality to the
+            // receiver.
+            void set_remote_result() noexcept
+            {
+                // the receiver might destroy this operation state, keep the
+                // shared state alive until we're done with it
+                shared_state_ptr s = HPX_MOVE(state);
+
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        if (s->has_exception())
+                        {
+                            hpx::execution::experimental::set_error(
+                                HPX_MOVE(receiver), s->get_exception_ptr());
+                        }
+                        else if constexpr (std::is_void_v<result_type>)
+                        {
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(receiver));
+                        }
+                        else
+                        {
+                            hpx::execution::experimental::set_value(
+                                HPX_MOVE(receiver), HPX_MOVE(*s->get_result()));
+                        }
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(receiver), HPX_MOVE(ep));
+                    });
+            }
+
+            template <std::size_t... Is>
+            void invoke_remote(
+                naming::address&& addr, hpx::util::index_pack<Is...>)
+            {
+                // The promise is used only to receive the reply parcel, its
+                // shared state completes this operation state directly. The
+                // destination is sent as an unmanaged id as the managed one
+                // is kept alive by this operation state.
+                lcos::packaged_action<action_type, result_type> p;
+                state = hpx::traits::detail::get_shared_state(p.get_future());
+                state->set_on_completed([this]() { set_remote_result(); });
+
+                hpx::id_type target = id;
+                if (target.get_management_type() == hpx::id_type::managed)
+                {
+                    target = hpx::id_type(
+                        target.get_gid(), hpx::id_type::unmanaged);
+                }
+
+                p.apply(HPX_MOVE(addr), target,
+                    HPX_MOVE(hpx::get<Is>(args))...);
+            }
+
+            void start() noexcept
+            {
+                using index_pack_type =
+                    typename hpx::util::make_index_pack<sizeof...(Ts)>::type;
+
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() {
+                        naming::address addr;
+                        if (agas::is_local_address_cached(id, addr) &&
+                            hpx::detail::can_invoke_locally<action_type>())
+                        {
+                            // route launch policy through component
+                            launch policy = hpx::traits::
+                                action_select_direct_execution<Action>::call(
+                                    launch::async, addr.address_);
+
+                            bool migrated = false;
+                            if (hpx::traits::component_supports_migration<
+                                    component_type>::call())
+                            {
+                                auto r = hpx::traits::
+                                    action_was_object_migrated<Action>::call(
+                                        id, addr.address_);
+                                migrated = r.first;
+                                pinned = HPX_MOVE(r.second);
+                            }
+
+                            if (!migrated)
+                            {
+                                if (policy == launch::sync ||
+                                    action_type::direct_execution::value)
+                                {
+                                    invoke_local(addr, index_pack_type());
+                                }
+                                else
+                                {
+                                    hpx::apply([this, addr]() {
+                                        invoke_local(addr, index_pack_type());
+                                    });
+                                }
+                                return;
+                            }
+                        }
+
+                        invoke_remote(HPX_MOVE(addr), index_pack_type());
+                    },
+                    [&](std::exception_ptr ep) {
+                        hpx::execution::experimental::set_error(
+                            HPX_MOVE(receiver), HPX_MOVE(ep));
+                    });
+            }
+
+            friend void tag_invoke(
+                start_t, remote_action_operation_state& os) noexcept
+            {
+                os.start();
+            }
+        };
+
+        template <typename T>
+        struct remote_action_value_types
+        {
+            template <template <typename...> class Tuple>
+            using apply = Tuple<T>;
+        };
+
+        template <>
+        struct remote_action_value_types<void>
+        {
+            template <template <typename...> class Tuple>
+            using apply = Tuple<>;
+        };
+
+        template <typename Action, typename... Ts>
+        struct remote_action_sender
+        {
+            using action_type =
+                typename hpx::traits::extract_action<Action>::type;
+            using result_type = typename action_type::local_result_type;
+
+            hpx::id_type id;
+            hpx::tuple<Ts...> args;
+
+            template <template <typename...> class Tuple,
+                template <typename...> class Variant>
+            using value_types = Variant<typename remote_action_value_types<
+                result_type>::template apply<Tuple>>;
+
+            template <template <typename...> class Variant>
+            using error_types = Variant<std::exception_ptr>;
+
+            static constexpr bool sends_done = false;
+
+            template <typename Receiver>
+            friend remote_action_operation_state<Action, Receiver, Ts...>
+            tag_invoke(connect_t, remote_action_sender&& s, Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver), HPX_MOVE(s.id),
+                    HPX_MOVE(s.args)};
+            }
+
+            template <typename Receiver>
+            friend remote_action_operation_state<Action, Receiver, Ts...>
+            tag_invoke(connect_t, remote_action_sender& s, Receiver&& receiver)
+            {
+                return {HPX_FORWARD(Receiver, receiver), s.id, s.args};
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    /// Create a sender which invokes the given action on the object
+    /// referenced by \a id once the operation state it is connected to is
+    /// started. The sender sends the result of the action, or the exception
+    /// thrown by it.
+    ///
+    /// In contrast to \a hpx::async, no future is created. A remote
+    /// invocation reports its result directly to the operation state, and a
+    /// local invocation is executed without creating any shared state at all
+    /// (inline for direct actions, on a new HPX thread otherwise).
+    ///
+    /// \param id   [in] The global address of the target object.
+    /// \param ts   [in] The arguments to pass to the action, they are stored
+    ///             in the sender.
+    ///
+    template <typename Action, typename... Ts>
+    detail::remote_action_sender<Action, std::decay_t<Ts>...> remote_action(
+        hpx::id_type const& id, Ts&&... ts)
+    {
+        return {id, hpx::tuple<std::decay_t<Ts>...>(HPX_FORWARD(Ts, ts)...)};
+    }
+
+    /// \copydoc remote_action
+    template <typename Component, typename Signature, typename Derived,
+        typename... Ts>
+    detail::remote_action_sender<Derived, std::decay_t<Ts>...> remote_action(
+        hpx::actions::basic_action<Component, Signature, Derived>,
+        hpx::id_type const& id, Ts&&... ts)
+    {
+        return {id, hpx::tuple<std::decay_t<Ts>...>(HPX_FORWARD(Ts, ts)...)};
+    }
+}}}    // namespace hpx::execution::experimental
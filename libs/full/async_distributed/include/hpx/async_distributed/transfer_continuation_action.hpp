@@ -108,6 +108,9 @@ namespace hpx { namespace actions {
             naming::address::component_type comptype,
             std::size_t num_thread) override;
 
+        // the continuation refers to an id, which requires preprocessing
+        std::size_t get_serialized_size() const override;
+
         // serialization support
         // loading ...
         void load(hpx::serialization::input_archive& ar) override;
@@ -149,6 +152,13 @@ namespace hpx { namespace actions {
         return true;
     }
 
+    template <typename Action>
+    std::size_t transfer_continuation_action<Action>::get_serialized_size()
+        const
+    {
+        return std::size_t(-1);
+    }
+
     template <typename Action>
     template <std::size_t... Is>
     threads::thread_function_type
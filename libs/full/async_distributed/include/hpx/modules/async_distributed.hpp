@@ -12,4 +12,5 @@
 #include <hpx/async_distributed/async_continue.hpp>
 #include <hpx/async_distributed/async_continue_callback.hpp>
 #include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/async_distributed/remote_action.hpp>
 #include <hpx/async_distributed/sync.hpp>
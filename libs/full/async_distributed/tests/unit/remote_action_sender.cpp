@@ -0,0 +1,151 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/async_distributed.hpp>
+#include <hpx/modules/execution.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int32_t increment(std::int32_t i)
+{
+    return i + 1;
+}
+HPX_PLAIN_ACTION(increment)
+
+std::atomic<std::int32_t> count(0);
+
+void increment_count()
+{
+    ++count;
+}
+HPX_PLAIN_ACTION(increment_count)
+
+std::int32_t throw_error()
+{
+    throw std::runtime_error("error");
+    return 0;
+}
+HPX_PLAIN_ACTION(throw_error)
+
+///////////////////////////////////////////////////////////////////////////////
+struct decrement_server
+  : hpx::components::managed_component_base<decrement_server>
+{
+    std::int32_t call(std::int32_t i) const
+    {
+        return i - 1;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(decrement_server, call)
+};
+
+typedef hpx::components::managed_component<decrement_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, decrement_server)
+
+typedef decrement_server::call_action call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_remote_action_sender(hpx::id_type const& target)
+{
+    {
+        HPX_TEST_EQ(
+            ex::sync_wait(ex::remote_action<increment_action>(target, 42)),
+            43);
+
+        increment_action inc;
+        HPX_TEST_EQ(ex::sync_wait(ex::remote_action(inc, target, 42)), 43);
+    }
+
+    {
+        std::int32_t const expected = count.load() + 1;
+        ex::sync_wait(ex::remote_action<increment_count_action>(target));
+
+        // only the local count can be checked
+        if (target == hpx::find_here())
+        {
+            HPX_TEST_EQ(count.load(), expected);
+        }
+    }
+
+    {
+        // the result of one invocation is passed on to the next one
+        auto s = ex::remote_action<increment_action>(target, 42) |
+            ex::let_value([target](std::int32_t i) {
+                return ex::remote_action<increment_action>(target, i);
+            }) |
+            ex::then([](std::int32_t i) { return i + 1; });
+        HPX_TEST_EQ(ex::sync_wait(std::move(s)), 45);
+    }
+
+    {
+        // senders holding their arguments can be connected more than once
+        auto s = ex::remote_action<increment_action>(target, 42);
+        HPX_TEST_EQ(ex::sync_wait(s), 43);
+        HPX_TEST_EQ(ex::sync_wait(s), 43);
+    }
+
+    {
+        hpx::id_type dec = hpx::new_<decrement_server>(target).get();
+        HPX_TEST_EQ(ex::sync_wait(ex::remote_action<call_action>(dec, 42)), 41);
+
+        std::vector<std::int32_t> results;
+        for (std::int32_t i = 0; i != 10; ++i)
+        {
+            results.push_back(
+                ex::sync_wait(ex::remote_action<call_action>(dec, i)));
+        }
+        for (std::int32_t i = 0; i != 10; ++i)
+        {
+            HPX_TEST_EQ(results[i], i - 1);
+        }
+    }
+
+    {
+        bool exception_thrown = false;
+        try
+        {
+            ex::sync_wait(ex::remote_action<throw_error_action>(target));
+            HPX_TEST(false);
+        }
+        catch (std::exception const&)
+        {
+            exception_thrown = true;
+        }
+        HPX_TEST(exception_thrown);
+    }
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_all_localities())
+    {
+        test_remote_action_sender(id);
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
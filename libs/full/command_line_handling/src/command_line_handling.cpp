@@ -1244,6 +1244,11 @@ namespace hpx { namespace util {
             }
         }
 
+        if (vm.count("hpx:print-startup-profile"))
+        {
+            ini_config.emplace_back("hpx.print_startup_profile!=1");
+        }
+
         if (debug_clp)
         {
             std::cerr << "Configuration before runtime start:\n";
@@ -570,6 +570,9 @@ namespace hpx { namespace util {
                 ("hpx:dump-config", "print the final runtime configuration")
                 // enable debug output from command line handling
                 ("hpx:debug-clp", "debug command line processing")
+                ("hpx:print-startup-profile", "print the time spent in each "
+                  "phase of the runtime startup on all localities before "
+                  "hpx_main is executed")
                 ("hpx:debug-hpx-log", value<std::string>()->implicit_value("cout"),
                   "enable all messages on the HPX log channel and send all "
                   "HPX logs to the target destination")
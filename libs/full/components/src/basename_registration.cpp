@@ -79,14 +79,15 @@ namespace hpx {
                 "no basename specified");
         }
 
-        std::vector<hpx::future<hpx::id_type>> results;
+        // install all listeners at once, this sends a single request to
+        // each of the localities managing any of the names
+        std::vector<std::string> names;
+        names.reserve(num_ids);
         for (std::size_t i = 0; i != num_ids; ++i)
         {
-            std::string name = detail::name_from_basename(basename, i);
-            results.push_back(
-                agas::on_symbol_namespace_event(HPX_MOVE(name), true));
+            names.push_back(detail::name_from_basename(basename, i));
         }
-        return results;
+        return agas::on_symbol_namespace_events(names, true);
     }
 
     std::vector<hpx::future<hpx::id_type>> find_from_basename(
@@ -98,15 +99,14 @@ namespace hpx {
                 "no basename specified");
         }
 
-        std::vector<hpx::future<hpx::id_type>> results;
+        std::vector<std::string> names;
+        names.reserve(ids.size());
         for (std::size_t i : ids)
         {
-            std::string name =
-                detail::name_from_basename(basename, i);    //-V106
-            results.push_back(
-                agas::on_symbol_namespace_event(HPX_MOVE(name), true));
+            names.push_back(
+                detail::name_from_basename(basename, i));    //-V106
         }
-        return results;
+        return agas::on_symbol_namespace_events(names, true);
     }
 
     hpx::future<hpx::id_type> find_from_basename(std::string basename,
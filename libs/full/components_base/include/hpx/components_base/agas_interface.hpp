@@ -63,6 +63,16 @@ namespace hpx { namespace agas {
     HPX_EXPORT hpx::future<naming::id_type> resolve_name(
         std::string const& name);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Register or resolve a set of names at once. All names which are managed
+    // by the same locality are handled by a single request. The results are
+    // returned in the order of the given names.
+    HPX_EXPORT hpx::future<std::vector<bool>> register_names(
+        std::vector<std::pair<std::string, naming::id_type>> const& entries);
+
+    HPX_EXPORT hpx::future<std::vector<naming::id_type>> resolve_names(
+        std::vector<std::string> const& names);
+
     ///////////////////////////////////////////////////////////////////////////
     HPX_EXPORT hpx::future<std::uint32_t> get_num_localities(
         naming::component_type type = naming::component_invalid);
@@ -249,6 +259,10 @@ namespace hpx { namespace agas {
     HPX_EXPORT hpx::future<hpx::id_type> on_symbol_namespace_event(
         std::string const& name, bool call_for_past_events);
 
+    HPX_EXPORT std::vector<hpx::future<hpx::id_type>>
+    on_symbol_namespace_events(
+        std::vector<std::string> const& names, bool call_for_past_events);
+
     ///////////////////////////////////////////////////////////////////////////
     HPX_EXPORT hpx::future<std::pair<naming::id_type, naming::address>>
     begin_migration(naming::id_type const& id);
@@ -54,6 +54,13 @@ namespace hpx { namespace agas { namespace detail {
     extern HPX_EXPORT future<hpx::id_type> (*resolve_name_async)(
         std::string const& name);
 
+    ///////////////////////////////////////////////////////////////////////////
+    extern HPX_EXPORT future<std::vector<bool>> (*register_names_async)(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries);
+
+    extern HPX_EXPORT future<std::vector<hpx::id_type>> (*resolve_names_async)(
+        std::vector<std::string> const& names);
+
     ///////////////////////////////////////////////////////////////////////////
     extern HPX_EXPORT future<std::uint32_t> (*get_num_localities_async)(
         naming::component_type type);
@@ -198,6 +205,10 @@ namespace hpx { namespace agas { namespace detail {
     extern HPX_EXPORT hpx::future<hpx::id_type> (*on_symbol_namespace_event)(
         std::string const& name, bool call_for_past_events);
 
+    extern HPX_EXPORT std::vector<hpx::future<hpx::id_type>> (
+        *on_symbol_namespace_events)(
+        std::vector<std::string> const& names, bool call_for_past_events);
+
     ///////////////////////////////////////////////////////////////////////////
     extern HPX_EXPORT hpx::future<std::pair<hpx::id_type, naming::address>> (
         *begin_migration)(hpx::id_type const& id);
@@ -0,0 +1,34 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace components { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // These hooks are installed by the automatic migration service (see
+    // hpx/runtime_distributed/migration_service.hpp) while it is running,
+    // they are nullptr otherwise. The hooks are stored with release and have
+    // to be loaded with acquire semantics.
+
+    // Invoked for every action executed on a component supporting migration.
+    using record_invocation_type = void (*)(naming::gid_type const& gid);
+    extern HPX_EXPORT std::atomic<record_invocation_type> record_invocation;
+
+    // Invoked for every parcel received for a component supporting
+    // migration, 'source' is the id of the locality the parcel was sent from.
+    using record_remote_invocation_type = void (*)(
+        naming::gid_type const& gid, component_type type, std::uint32_t source);
+    extern HPX_EXPORT std::atomic<record_remote_invocation_type>
+        record_remote_invocation;
+}}}    // namespace hpx::components::detail
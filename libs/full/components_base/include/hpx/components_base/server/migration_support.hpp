@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/detail/invocation_sampling.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/components_base/traits/action_decorate_function.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -18,6 +19,7 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 #include <type_traits>
@@ -260,6 +262,13 @@ namespace hpx { namespace components {
             threads::thread_function_type&& f, components::pinned_ptr,
             threads::thread_restart_state state)
         {
+            // let the automatic migration service know about this invocation
+            detail::record_invocation_type const record =
+                detail::record_invocation.load(std::memory_order_acquire);
+            if (record != nullptr)
+            {
+                record(this->gid_);
+            }
             return f(state);
         }
 
@@ -70,6 +70,18 @@ namespace hpx { namespace agas {
         return detail::resolve_name_async(name);
     }
 
+    hpx::future<std::vector<bool>> register_names(
+        std::vector<std::pair<std::string, naming::id_type>> const& entries)
+    {
+        return detail::register_names_async(entries);
+    }
+
+    hpx::future<std::vector<naming::id_type>> resolve_names(
+        std::vector<std::string> const& names)
+    {
+        return detail::resolve_names_async(names);
+    }
+
     naming::id_type resolve_name(
         launch::sync_policy, std::string const& name, error_code& ec)
     {
@@ -330,6 +342,12 @@ namespace hpx { namespace agas {
         return detail::on_symbol_namespace_event(name, call_for_past_events);
     }
 
+    std::vector<hpx::future<hpx::id_type>> on_symbol_namespace_events(
+        std::vector<std::string> const& names, bool call_for_past_events)
+    {
+        return detail::on_symbol_namespace_events(names, call_for_past_events);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<std::pair<naming::id_type, naming::address>> begin_migration(
         naming::id_type const& id)
@@ -55,6 +55,14 @@ namespace hpx { namespace agas { namespace detail {
     future<hpx::id_type> (*resolve_name_async)(
         std::string const& name) = nullptr;
 
+    ///////////////////////////////////////////////////////////////////////////
+    future<std::vector<bool>> (*register_names_async)(
+        std::vector<std::pair<std::string, hpx::id_type>> const& entries) =
+        nullptr;
+
+    future<std::vector<hpx::id_type>> (*resolve_names_async)(
+        std::vector<std::string> const& names) = nullptr;
+
     ///////////////////////////////////////////////////////////////////////////
     future<std::uint32_t> (*get_num_localities_async)(
         naming::component_type type) = nullptr;
@@ -193,6 +201,10 @@ namespace hpx { namespace agas { namespace detail {
     hpx::future<hpx::id_type> (*on_symbol_namespace_event)(
         std::string const& name, bool call_for_past_events) = nullptr;
 
+    std::vector<hpx::future<hpx::id_type>> (*on_symbol_namespace_events)(
+        std::vector<std::string> const& names,
+        bool call_for_past_events) = nullptr;
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<std::pair<hpx::id_type, naming::address>> (*begin_migration)(
         hpx::id_type const& id) = nullptr;
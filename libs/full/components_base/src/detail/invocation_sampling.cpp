@@ -0,0 +1,20 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/detail/invocation_sampling.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+
+namespace hpx { namespace components { namespace detail {
+
+    std::atomic<record_invocation_type> record_invocation(nullptr);
+
+    std::atomic<record_remote_invocation_type> record_remote_invocation(
+        nullptr);
+}}}    // namespace hpx::components::detail
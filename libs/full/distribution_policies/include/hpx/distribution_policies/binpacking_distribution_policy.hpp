@@ -14,6 +14,7 @@
 #include <hpx/async_distributed/dataflow.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/component_type.hpp>
+#include <hpx/distribution_policies/load_information.hpp>
 #include <hpx/functional/bind_back.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/naming_base/id_type.hpp>
@@ -52,6 +53,14 @@ namespace hpx { namespace components {
             std::string const& component_name, std::string const& counter_name,
             std::vector<hpx::id_type> const& localities);
 
+        // Retrieve the values of the given counter on all localities. Uses
+        // the information cached by the load information service, if
+        // possible.
+        HPX_EXPORT hpx::future<std::vector<std::uint64_t>> get_instance_counts(
+            component_type type, std::string const& component_name,
+            std::string const& counter_name,
+            std::vector<hpx::id_type> const& localities);
+
         HPX_EXPORT hpx::id_type const& get_best_locality(
             hpx::future<std::vector<std::uint64_t>>&& f,
             std::vector<hpx::id_type> const& localities);
@@ -71,6 +80,8 @@ namespace hpx { namespace components {
             {
                 hpx::id_type const& best_locality =
                     get_best_locality(HPX_MOVE(values), localities_);
+                add_cached_instance_count(
+                    best_locality, get_component_type<Component>(), 1);
 
                 return create_async<Component>(
                     best_locality, HPX_FORWARD(Ts, vs)...);
@@ -104,6 +115,8 @@ namespace hpx { namespace components {
 
                 for (std::size_t i = 0; i != to_create.size(); ++i)
                 {
+                    add_cached_instance_count(localities_[i],
+                        get_component_type<Component>(), to_create[i]);
                     objs.push_back(bulk_create_async<Component>(
                         localities_[i], to_create[i], vs...));
                 }
@@ -140,6 +153,11 @@ namespace hpx { namespace components {
     /// each of the localities will equalize the number of overall objects of
     /// this type based on a given criteria (by default this criteria is the
     /// overall number of objects of this type).
+    ///
+    /// If the load information service is running (see
+    /// \a hpx.load_information.enabled), the default criteria is taken from
+    /// the locally cached load of the target localities instead of querying
+    /// the performance counters on all of them.
     struct binpacking_distribution_policy
     {
     public:
@@ -246,8 +264,9 @@ namespace hpx { namespace components {
 
             // schedule creation of all objects across given localities
             hpx::future<std::vector<std::uint64_t>> values =
-                detail::get_counter_values(get_component_name<Component>(),
-                    counter_name_, localities_);
+                detail::get_instance_counts(get_component_type<Component>(),
+                    get_component_name<Component>(), counter_name_,
+                    localities_);
 
             return values.then(hpx::util::bind_back(
                 detail::create_helper<Component>(localities_),
@@ -277,8 +296,10 @@ namespace hpx { namespace components {
             {
                 // schedule creation of all objects across given localities
                 hpx::future<std::vector<std::uint64_t>> values =
-                    detail::get_counter_values(get_component_name<Component>(),
-                        counter_name_, localities_);
+                    detail::get_instance_counts(
+                        get_component_type<Component>(),
+                        get_component_name<Component>(), counter_name_,
+                        localities_);
 
                 return values.then(hpx::util::bind_back(
                     detail::create_bulk_helper<Component>(localities_), count,
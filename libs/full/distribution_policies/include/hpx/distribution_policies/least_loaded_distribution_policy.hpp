@@ -0,0 +1,248 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file least_loaded_distribution_policy.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/is_distribution_policy.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/distribution_policies/binpacking_distribution_policy.hpp>
+#include <hpx/functional/bind_back.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_components/create_component_helpers.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components {
+
+    inline constexpr char const* const default_least_loaded_counter_name =
+        "/threads{locality/total}/count/instantaneous/pending";
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Retrieve the number of pending threads on all localities. Uses the
+        // information cached by the load information service, if possible.
+        HPX_EXPORT hpx::future<std::vector<std::uint64_t>> get_thread_counts(
+            std::vector<hpx::id_type> const& localities);
+        /// \endcond
+    }    // namespace detail
+
+    /// This class specifies the parameters for a distribution policy placing
+    /// new objects on the least loaded of a given set of localities. The load
+    /// of a locality is measured as the number of its pending threads. Bulk
+    /// creations place more objects on the localities which are less loaded.
+    ///
+    /// The load is taken from the information cached by the load information
+    /// service (see \a hpx.load_information.enabled) if this is running and
+    /// recent enough. Otherwise the corresponding performance counters are
+    /// queried on all of the localities.
+    struct least_loaded_distribution_policy
+    {
+    public:
+        /// Default-construct a new instance of a
+        /// \a least_loaded_distribution_policy. This policy will represent
+        /// one locality (the local locality).
+        least_loaded_distribution_policy() = default;
+
+        /// Create a new \a least_loaded_distribution_policy representing the
+        /// given set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        ///
+        least_loaded_distribution_policy operator()(
+            std::vector<id_type> const& locs) const
+        {
+#if defined(HPX_DEBUG)
+            for (id_type const& loc : locs)
+            {
+                HPX_ASSERT(naming::is_locality(loc));
+            }
+#endif
+            return least_loaded_distribution_policy(locs);
+        }
+
+        /// Create a new \a least_loaded_distribution_policy representing the
+        /// given set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        ///
+        least_loaded_distribution_policy operator()(
+            std::vector<id_type>&& locs) const
+        {
+#if defined(HPX_DEBUG)
+            for (id_type const& loc : locs)
+            {
+                HPX_ASSERT(naming::is_locality(loc));
+            }
+#endif
+            return least_loaded_distribution_policy(HPX_MOVE(locs));
+        }
+
+        /// Create a new \a least_loaded_distribution_policy representing the
+        /// given locality
+        ///
+        /// \param loc     [in] The locality the new instance should
+        ///                 represent
+        ///
+        least_loaded_distribution_policy operator()(id_type const& loc) const
+        {
+            HPX_ASSERT(naming::is_locality(loc));
+            return least_loaded_distribution_policy(
+                std::vector<id_type>{loc});
+        }
+
+        /// Create one object on the least loaded of the localities associated
+        /// by this policy instance
+        ///
+        /// \param vs  [in] The arguments which will be forwarded to the
+        ///            constructor of the new object.
+        ///
+        /// \returns A future holding the global address which represents
+        ///          the newly created object
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<hpx::id_type> create(Ts&&... vs) const
+        {
+            // handle special cases
+            if (localities_.size() == 0)
+            {
+                return create_async<Component>(
+                    naming::get_id_from_locality_id(agas::get_locality_id()),
+                    HPX_FORWARD(Ts, vs)...);
+            }
+            else if (localities_.size() == 1)
+            {
+                return create_async<Component>(
+                    localities_.front(), HPX_FORWARD(Ts, vs)...);
+            }
+
+            hpx::future<std::vector<std::uint64_t>> values =
+                detail::get_thread_counts(localities_);
+
+            return values.then(hpx::util::bind_back(
+                detail::create_helper<Component>(localities_),
+                HPX_FORWARD(Ts, vs)...));
+        }
+
+        /// \cond NOINTERNAL
+        using bulk_locality_result =
+            std::pair<hpx::id_type, std::vector<hpx::id_type>>;
+        /// \endcond
+
+        /// Create multiple objects on the localities associated by
+        /// this policy instance
+        ///
+        /// \param count [in] The number of objects to create
+        /// \param vs   [in] The arguments which will be forwarded to the
+        ///             constructors of the new objects.
+        ///
+        /// \returns A future holding the list of global addresses which
+        ///          represent the newly created objects
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<std::vector<bulk_locality_result>> bulk_create(
+            std::size_t count, Ts&&... vs) const
+        {
+            if (localities_.size() > 1)
+            {
+                hpx::future<std::vector<std::uint64_t>> values =
+                    detail::get_thread_counts(localities_);
+
+                return values.then(hpx::util::bind_back(
+                    detail::create_bulk_helper<Component>(localities_), count,
+                    HPX_FORWARD(Ts, vs)...));
+            }
+
+            // handle special cases
+            hpx::id_type id = localities_.empty() ?
+                naming::get_id_from_locality_id(agas::get_locality_id()) :
+                localities_.front();
+
+            hpx::future<std::vector<hpx::id_type>> f =
+                bulk_create_async<Component>(id, count, HPX_FORWARD(Ts, vs)...);
+
+            return f.then(hpx::launch::sync,
+                [id = HPX_MOVE(id)](hpx::future<std::vector<hpx::id_type>>&& f)
+                    -> std::vector<bulk_locality_result> {
+                    std::vector<bulk_locality_result> result;
+                    result.emplace_back(id, f.get());
+                    return result;
+                });
+        }
+
+        /// Returns the number of associated localities for this distribution
+        /// policy
+        ///
+        /// \note This function is part of the creation policy implemented by
+        ///       this class
+        ///
+        std::size_t get_num_localities() const
+        {
+            return localities_.size();
+        }
+
+    protected:
+        /// \cond NOINTERNAL
+        explicit least_loaded_distribution_policy(
+            std::vector<id_type> const& localities)
+          : localities_(localities)
+        {
+        }
+
+        explicit least_loaded_distribution_policy(
+            std::vector<id_type>&& localities)
+          : localities_(HPX_MOVE(localities))
+        {
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & localities_;
+            // clang-format on
+        }
+
+        std::vector<id_type> localities_;    // localities to create things on
+        /// \endcond
+    };
+
+    /// A predefined instance of the least-loaded \a distribution_policy. It
+    /// will represent the local locality and will place all items to create
+    /// here.
+    static least_loaded_distribution_policy const least_loaded{};
+}}    // namespace hpx::components
+
+/// \cond NOINTERNAL
+namespace hpx {
+
+    using hpx::components::least_loaded;
+    using hpx::components::least_loaded_distribution_policy;
+
+    namespace traits {
+        template <>
+        struct is_distribution_policy<
+            components::least_loaded_distribution_policy> : std::true_type
+        {
+        };
+    }    // namespace traits
+}    // namespace hpx
+/// \endcond
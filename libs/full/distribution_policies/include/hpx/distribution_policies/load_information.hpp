@@ -0,0 +1,55 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file load_information.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx { namespace components { namespace detail {
+
+    /// \cond NOINTERNAL
+
+    // The load information service periodically gossips the load of each
+    // locality (the number of pending threads and the number of instances
+    // of each component type) to the other localities. The distribution
+    // policies use the locally cached information to avoid querying
+    // performance counters on all target localities for each placement.
+
+    // Retrieve the number of instances of the given component type on each
+    // of the given localities. Returns false if the service is not running
+    // or if the information about any of the localities is missing or older
+    // than hpx.load_information.max_staleness.
+    HPX_EXPORT bool get_cached_instance_counts(component_type type,
+        std::vector<hpx::id_type> const& localities,
+        std::vector<std::uint64_t>& values);
+
+    // Retrieve the number of pending threads on each of the given
+    // localities, same semantics as get_cached_instance_counts.
+    HPX_EXPORT bool get_cached_thread_counts(
+        std::vector<hpx::id_type> const& localities,
+        std::vector<std::uint64_t>& values);
+
+    // Account for objects placed on the given locality until the next update
+    // from that locality arrives. This prevents consecutive placements from
+    // all choosing the same locality.
+    HPX_EXPORT void add_cached_instance_count(hpx::id_type const& locality,
+        component_type type, std::size_t count);
+
+    // start/stop the load information service on this locality, the service
+    // is started during startup if hpx.load_information.enabled is set
+    HPX_EXPORT void start_load_information_service();
+    HPX_EXPORT void stop_load_information_service();
+
+    /// \endcond
+}}}    // namespace hpx::components::detail
@@ -5,6 +5,7 @@
 //  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 
 #include <hpx/distribution_policies/binpacking_distribution_policy.hpp>
+#include <hpx/distribution_policies/load_information.hpp>
 #include <hpx/performance_counters/counters.hpp>
 
 #include <cstddef>
@@ -106,6 +107,22 @@ namespace hpx { namespace components { namespace detail {
         return hpx::dataflow(&retrieve_counter_values, HPX_MOVE(counters));
     }
 
+    hpx::future<std::vector<std::uint64_t>> get_instance_counts(
+        component_type type, std::string const& component_name,
+        std::string const& counter_name,
+        std::vector<hpx::id_type> const& localities)
+    {
+        // the cached load information covers the default criteria only
+        std::vector<std::uint64_t> values;
+        if (counter_name == default_binpacking_counter_name &&
+            get_cached_instance_counts(type, localities, values))
+        {
+            return hpx::make_ready_future(HPX_MOVE(values));
+        }
+
+        return get_counter_values(component_name, counter_name, localities);
+    }
+
     hpx::id_type const& get_best_locality(
         hpx::future<std::vector<std::uint64_t>>&& f,
         std::vector<hpx::id_type> const& localities)
@@ -0,0 +1,30 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/distribution_policies/binpacking_distribution_policy.hpp>
+#include <hpx/distribution_policies/least_loaded_distribution_policy.hpp>
+#include <hpx/distribution_policies/load_information.hpp>
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components { namespace detail {
+
+    hpx::future<std::vector<std::uint64_t>> get_thread_counts(
+        std::vector<hpx::id_type> const& localities)
+    {
+        std::vector<std::uint64_t> values;
+        if (get_cached_thread_counts(localities, values))
+        {
+            return hpx::make_ready_future(HPX_MOVE(values));
+        }
+
+        return get_counter_values(
+            std::string(), default_least_loaded_counter_name, localities);
+    }
+}}}    // namespace hpx::components::detail
@@ -0,0 +1,432 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/apply.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/distribution_policies/load_information.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/runtime_local/runtime_local.hpp>
+#include <hpx/runtime_local/thread_pool_helpers.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/util/get_entry_as.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components { namespace detail {
+
+    // The load of one locality as exchanged between the localities.
+    struct locality_load
+    {
+        std::uint32_t locality_id = naming::invalid_locality_id;
+
+        // incremented by the owning locality for each gossip round
+        std::uint64_t version = 0;
+
+        // time (in milliseconds) since the sending locality has received
+        // this version
+        std::uint64_t age = 0;
+
+        std::uint64_t pending_threads = 0;
+        std::map<component_type, std::uint64_t> instance_counts;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & locality_id & version & age & pending_threads &
+                instance_counts;
+            // clang-format on
+        }
+    };
+
+    void update_load_information(std::vector<locality_load> const& loads);
+}}}    // namespace hpx::components::detail
+
+HPX_PLAIN_ACTION(hpx::components::detail::update_load_information,
+    update_load_information_action)
+
+namespace hpx { namespace components { namespace detail {
+
+    namespace {
+
+        class load_information_service
+        {
+        public:
+            using mutex_type = hpx::lcos::local::spinlock;
+            using clock_type = std::chrono::steady_clock;
+
+            static load_information_service& instance()
+            {
+                static load_information_service service;
+                return service;
+            }
+
+            void start();
+            void stop();
+
+            void update(std::vector<locality_load> const& loads);
+
+            bool get_instance_counts(component_type type,
+                std::vector<hpx::id_type> const& localities,
+                std::vector<std::uint64_t>& values);
+            bool get_thread_counts(std::vector<hpx::id_type> const& localities,
+                std::vector<std::uint64_t>& values);
+
+            void add_instance_count(hpx::id_type const& locality,
+                component_type type, std::size_t count);
+
+        private:
+            struct entry
+            {
+                std::uint64_t version = 0;
+                clock_type::time_point received;
+                std::uint64_t pending_threads = 0;
+                std::map<component_type, std::uint64_t> instance_counts;
+            };
+
+            bool gossip();
+
+            // Return the cached entry for the given locality if it is recent
+            // enough, must be called with mtx_ held.
+            entry const* find_entry(
+                std::uint32_t locality_id, clock_type::time_point now) const
+            {
+                auto it = loads_.find(locality_id);
+                if (it == loads_.end() ||
+                    now - it->second.received > max_staleness_)
+                {
+                    return nullptr;
+                }
+                return &it->second;
+            }
+
+            mutex_type mtx_;
+            std::unordered_map<std::uint32_t, entry> loads_;
+
+            std::atomic<bool> running_{false};
+            std::uint32_t here_ = naming::invalid_locality_id;
+            std::vector<hpx::id_type> peers_;
+            std::uint64_t version_ = 0;
+            std::size_t fanout_ = 2;
+            std::chrono::milliseconds max_staleness_{2000};
+            std::mt19937 gen_;
+
+            std::unique_ptr<hpx::util::interval_timer> timer_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        void load_information_service::start()
+        {
+            util::runtime_configuration const& cfg = get_runtime().get_config();
+
+            fanout_ = (std::max)(std::size_t(1),
+                util::get_entry_as<std::size_t>(
+                    cfg, "hpx.load_information.fanout", 2));
+            max_staleness_ =
+                std::chrono::milliseconds(util::get_entry_as<std::int64_t>(
+                    cfg, "hpx.load_information.max_staleness", 2000));
+
+            std::int64_t const interval = util::get_entry_as<std::int64_t>(
+                cfg, "hpx.load_information.interval", 500);
+
+            here_ = agas::get_locality_id();
+
+            // hpx_runtime_distributed depends on this module, which is why
+            // the peers are derived from the locality ids directly
+            std::uint32_t const num_localities =
+                agas::get_num_localities(hpx::launch::sync);
+            peers_.clear();
+            peers_.reserve(num_localities);
+            for (std::uint32_t id = 0; id != num_localities; ++id)
+            {
+                if (id != here_)
+                {
+                    peers_.push_back(naming::get_id_from_locality_id(id));
+                }
+            }
+
+            gen_.seed(here_);
+
+            running_.store(true, std::memory_order_release);
+
+            // the timer is terminated during pre-shutdown, no more updates
+            // are sent after that
+            timer_ = std::make_unique<hpx::util::interval_timer>(
+                [this]() { return gossip(); },
+                [this]() {
+                    running_.store(false, std::memory_order_release);
+                },
+                interval * 1000, "load_information", true);
+            timer_->start(true);
+        }
+
+        void load_information_service::stop()
+        {
+            running_.store(false, std::memory_order_release);
+
+            if (timer_)
+            {
+                timer_->stop(true);
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+            loads_.clear();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool load_information_service::gossip()
+        {
+            if (!running_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            // collect the load of this locality
+            entry own;
+            own.pending_threads = std::uint64_t(threads::get_thread_count(
+                threads::thread_schedule_state::pending));
+            enumerate_instance_counts([&own](component_type type) -> bool {
+                long const count = instance_count(type);
+                if (count > 0)
+                {
+                    own.instance_counts.emplace(type, std::uint64_t(count));
+                }
+                return true;
+            });
+
+            std::vector<locality_load> loads;
+            std::vector<hpx::id_type> targets;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                clock_type::time_point const now = clock_type::now();
+                own.version = ++version_;
+                own.received = now;
+                loads_[here_] = HPX_MOVE(own);
+
+                // forward all information which is still recent enough
+                loads.reserve(loads_.size());
+                for (auto const& e : loads_)
+                {
+                    auto const age = now - e.second.received;
+                    if (age > max_staleness_)
+                    {
+                        continue;
+                    }
+
+                    locality_load load;
+                    load.locality_id = e.first;
+                    load.version = e.second.version;
+                    load.age = std::uint64_t(
+                        std::chrono::duration_cast<std::chrono::milliseconds>(
+                            age)
+                            .count());
+                    load.pending_threads = e.second.pending_threads;
+                    load.instance_counts = e.second.instance_counts;
+                    loads.push_back(HPX_MOVE(load));
+                }
+
+                std::sample(peers_.begin(), peers_.end(),
+                    std::back_inserter(targets), fanout_, gen_);
+            }
+
+            for (hpx::id_type const& target : targets)
+            {
+                hpx::apply<update_load_information_action>(target, loads);
+            }
+
+            return true;
+        }
+
+        void load_information_service::update(
+            std::vector<locality_load> const& loads)
+        {
+            if (!running_.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            clock_type::time_point const now = clock_type::now();
+            for (locality_load const& load : loads)
+            {
+                if (load.locality_id == here_)
+                {
+                    continue;
+                }
+
+                // accept only newer information than what is known already
+                entry& e = loads_[load.locality_id];
+                if (load.version > e.version)
+                {
+                    e.version = load.version;
+                    e.received = now - std::chrono::milliseconds(load.age);
+                    e.pending_threads = load.pending_threads;
+                    e.instance_counts = load.instance_counts;
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool load_information_service::get_instance_counts(component_type type,
+            std::vector<hpx::id_type> const& localities,
+            std::vector<std::uint64_t>& values)
+        {
+            if (!running_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            values.clear();
+            values.reserve(localities.size());
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            clock_type::time_point const now = clock_type::now();
+            for (hpx::id_type const& locality : localities)
+            {
+                std::uint32_t const locality_id =
+                    naming::get_locality_id_from_id(locality);
+                if (locality_id == here_)
+                {
+                    long const count = instance_count(type);
+                    values.push_back(count > 0 ? std::uint64_t(count) : 0);
+                    continue;
+                }
+
+                entry const* e = find_entry(locality_id, now);
+                if (e == nullptr)
+                {
+                    return false;
+                }
+
+                auto it = e->instance_counts.find(type);
+                values.push_back(
+                    it != e->instance_counts.end() ? it->second : 0);
+            }
+            return true;
+        }
+
+        bool load_information_service::get_thread_counts(
+            std::vector<hpx::id_type> const& localities,
+            std::vector<std::uint64_t>& values)
+        {
+            if (!running_.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+
+            values.clear();
+            values.reserve(localities.size());
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            clock_type::time_point const now = clock_type::now();
+            for (hpx::id_type const& locality : localities)
+            {
+                std::uint32_t const locality_id =
+                    naming::get_locality_id_from_id(locality);
+                if (locality_id == here_)
+                {
+                    values.push_back(std::uint64_t(threads::get_thread_count(
+                        threads::thread_schedule_state::pending)));
+                    continue;
+                }
+
+                entry const* e = find_entry(locality_id, now);
+                if (e == nullptr)
+                {
+                    return false;
+                }
+                values.push_back(e->pending_threads);
+            }
+            return true;
+        }
+
+        void load_information_service::add_instance_count(
+            hpx::id_type const& locality, component_type type,
+            std::size_t count)
+        {
+            if (count == 0 || !running_.load(std::memory_order_acquire))
+            {
+                return;
+            }
+
+            std::uint32_t const locality_id =
+                naming::get_locality_id_from_id(locality);
+
+            std::lock_guard<mutex_type> l(mtx_);
+
+            // the local instance counts are always up to date
+            auto it = loads_.find(locality_id);
+            if (locality_id != here_ && it != loads_.end())
+            {
+                it->second.instance_counts[type] += count;
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void update_load_information(std::vector<locality_load> const& loads)
+    {
+        load_information_service::instance().update(loads);
+    }
+
+    bool get_cached_instance_counts(component_type type,
+        std::vector<hpx::id_type> const& localities,
+        std::vector<std::uint64_t>& values)
+    {
+        return load_information_service::instance().get_instance_counts(
+            type, localities, values);
+    }
+
+    bool get_cached_thread_counts(std::vector<hpx::id_type> const& localities,
+        std::vector<std::uint64_t>& values)
+    {
+        return load_information_service::instance().get_thread_counts(
+            localities, values);
+    }
+
+    void add_cached_instance_count(
+        hpx::id_type const& locality, component_type type, std::size_t count)
+    {
+        load_information_service::instance().add_instance_count(
+            locality, type, count);
+    }
+
+    void start_load_information_service()
+    {
+        load_information_service::instance().start();
+    }
+
+    void stop_load_information_service()
+    {
+        load_information_service::instance().stop();
+    }
+}}}    // namespace hpx::components::detail
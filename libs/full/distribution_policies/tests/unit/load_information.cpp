@@ -0,0 +1,148 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call)
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action)
+
+///////////////////////////////////////////////////////////////////////////////
+// wait for the load information about all localities to be available
+bool wait_for_instance_counts(std::vector<hpx::id_type> const& localities,
+    std::vector<std::uint64_t> const& expected)
+{
+    hpx::components::component_type const type =
+        hpx::components::get_component_type<test_server>();
+
+    std::vector<std::uint64_t> values;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        if (hpx::components::detail::get_cached_instance_counts(
+                type, localities, values) &&
+            values == expected)
+        {
+            return true;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return false;
+}
+
+std::vector<hpx::id_type> test_binpacking_cached()
+{
+    std::vector<hpx::id_type> keep_alive;
+
+    // create an increasing number of instances on all available localities
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    std::vector<std::uint64_t> expected;
+
+    std::uint64_t count = 0;
+    for (std::size_t i = 0; i != localities.size(); ++i)
+    {
+        for (hpx::id_type const& id :
+            hpx::new_<test_server[]>(localities[i], i + 1).get())
+        {
+            keep_alive.push_back(id);
+        }
+        expected.push_back(i + 1);
+        count += i + 1;
+    }
+
+    HPX_TEST(wait_for_instance_counts(localities, expected));
+
+    // the bin-packing policy fills up the number of instances based on the
+    // cached load information
+    for (hpx::id_type const& id :
+        hpx::new_<test_server[]>(hpx::binpacked(localities), count).get())
+    {
+        keep_alive.push_back(id);
+    }
+
+    // now, all localities should have the same number of instances
+    std::string counter_name(hpx::components::default_binpacking_counter_name);
+    counter_name += "test_server";
+
+    for (hpx::id_type const& locality : localities)
+    {
+        hpx::performance_counters::performance_counter instances(
+            counter_name, locality);
+        HPX_TEST_EQ(instances.get_value<std::uint64_t>(hpx::launch::sync),
+            std::uint64_t(localities.size() + 1));
+    }
+
+    return keep_alive;
+}
+
+void test_least_loaded()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    // the number of pending threads is known for all localities
+    std::vector<std::uint64_t> values =
+        hpx::components::detail::get_thread_counts(localities).get();
+    HPX_TEST_EQ(values.size(), localities.size());
+
+    hpx::id_type id =
+        hpx::new_<test_server>(hpx::least_loaded(localities)).get();
+    HPX_TEST(hpx::async<call_action>(id).get() != hpx::invalid_id);
+
+    std::vector<hpx::id_type> ids =
+        hpx::new_<test_server[]>(hpx::least_loaded(localities), 10).get();
+    HPX_TEST_EQ(ids.size(), std::size_t(10));
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> ids = test_binpacking_cached();
+    (void) ids;
+
+    test_least_loaded();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.load_information.enabled!=1",
+        "hpx.load_information.interval!=50",
+        "hpx.load_information.max_staleness!=60000"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -10,5 +10,7 @@
 #include <hpx/local/channel.hpp>
 
 namespace hpx { namespace distributed {
+    using hpx::lcos::batched_send_channel;
     using hpx::lcos::channel;
+    using hpx::lcos::prefetching_receive_channel;
 }}    // namespace hpx::distributed
@@ -46,5 +46,6 @@
 
 #include <hpx/distribution_policies/binpacking_distribution_policy.hpp>
 #include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/distribution_policies/least_loaded_distribution_policy.hpp>
 #include <hpx/distribution_policies/target_distribution_policy.hpp>
 #include <hpx/distribution_policies/unwrapping_result_policy.hpp>
@@ -8,3 +8,5 @@
 
 #include <hpx/parallel/algorithms/remove.hpp>
 #include <hpx/parallel/container_algorithms/remove.hpp>
+
+#include <hpx/parallel/segmented_algorithms/remove.hpp>
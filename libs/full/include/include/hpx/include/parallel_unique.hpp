@@ -8,3 +8,5 @@
 
 #include <hpx/parallel/algorithms/unique.hpp>
 #include <hpx/parallel/container_algorithms/unique.hpp>
+
+#include <hpx/parallel/segmented_algorithms/unique.hpp>
@@ -24,6 +24,7 @@
 #include <hpx/init_runtime/detail/run_or_start.hpp>
 #include <hpx/init_runtime_local/init_runtime_local.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/logging/detail/async_writer.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/filesystem.hpp>
 #include <hpx/modules/format.hpp>
@@ -35,6 +36,7 @@
 #include <hpx/program_options/parsers.hpp>
 #include <hpx/program_options/variables_map.hpp>
 #include <hpx/resource_partitioner/partitioner.hpp>
+#include <hpx/runtime_configuration/startup_profile.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -579,6 +581,11 @@ namespace hpx {
             if (!!shutdown)
                 rt.add_shutdown_function(HPX_MOVE(shutdown));
 
+            // write the log messages still queued for the background thread and
+            // stop it, the runtime writes its remaining messages synchronously
+            if (util::logging::is_async_logging_enabled())
+                rt.add_shutdown_function(&util::logging::stop_async_logging);
+
 #if defined(HPX_HAVE_DISTRIBUTED_RUNTIME)
             // Add startup function related to listing counter names or counter
             // infos (on console only).
@@ -764,6 +771,7 @@ namespace hpx {
             int argc, char** argv, init_params const& params, bool blocking)
         {
             init_environment();
+            util::reset_startup_profile();
 
             int result = 0;
             try
@@ -784,6 +792,7 @@ namespace hpx {
                     hpx::util::runtime_configuration(argv[0], params.mode, {}),
                     hpx_startup::user_main_config(params.cfg), f};
 #endif
+                util::startup_phase_completed("initial configuration");
 
                 // scope exception handling to resource partitioner initialization
                 // any exception thrown during run_or_start below are handled
@@ -796,6 +805,7 @@ namespace hpx {
 
                     result = cmdline.call(
                         params.desc_cmdline, argc, argv, component_registries);
+                    util::startup_phase_completed("command line handling");
 
                     hpx::threads::policies::detail::affinity_data
                         affinity_data{};
@@ -845,6 +855,7 @@ namespace hpx {
 
                     // Setup all internal parameters of the resource_partitioner
                     rp.configure_pools();
+                    util::startup_phase_completed("resource partitioning");
                 }
                 catch (hpx::exception const& e)
                 {
@@ -890,6 +901,8 @@ namespace hpx {
                 }
                 }
 
+                util::startup_phase_completed("runtime creation");
+
                 result = run_or_start(blocking, HPX_MOVE(rt), cmdline,
                     HPX_MOVE(params.startup), HPX_MOVE(params.shutdown));
             }
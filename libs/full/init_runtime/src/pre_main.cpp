@@ -15,22 +15,30 @@
 #include <hpx/collectives/latch.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/datastructures/tuple.hpp>
+#include <hpx/distribution_policies/load_information.hpp>
 #include <hpx/init_runtime/pre_main.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/performance_counters/agas_counter_types.hpp>
+#include <hpx/performance_counters/autotuning_counter_types.hpp>
+#include <hpx/performance_counters/futures_counter_types.hpp>
 #include <hpx/performance_counters/parcelhandler_counter_types.hpp>
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_configuration/runtime_mode.hpp>
+#include <hpx/runtime_configuration/startup_profile.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/applier.hpp>
+#include <hpx/runtime_distributed/migration_service.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
 #include <hpx/runtime_distributed/runtime_support.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/runtime_local/shutdown_function.hpp>
 
+#include <iostream>
 #include <string>
 #include <vector>
 
@@ -65,6 +73,14 @@ namespace hpx { namespace detail {
         lbt_ << "(2nd stage) pre_main: registered thread-manager performance "
                 "counter types";
 
+        performance_counters::register_autotuning_counter_types();
+        lbt_ << "(2nd stage) pre_main: registered autotuning performance "
+                "counter types";
+
+        performance_counters::register_futures_counter_types();
+        lbt_ << "(2nd stage) pre_main: registered futures performance "
+                "counter types";
+
 #if defined(HPX_HAVE_NETWORKING)
         performance_counters::register_parcelhandler_counter_types(
             applier::get_applier().get_parcel_handler());
@@ -88,10 +104,27 @@ namespace hpx { namespace detail {
     }
 #endif
 
+    ///////////////////////////////////////////////////////////////////////////
+    static void print_startup_profile()
+    {
+        if (get_config_entry("hpx.print_startup_profile", "0") == "0")
+        {
+            return;
+        }
+
+        // the output of all localities is written directly (not through
+        // hpx::cout) as the console might not be reachable yet
+        std::cout << "startup profile (locality " << get_locality_id()
+                  << "):\n";
+        util::print_startup_profile(std::cout);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Implements second and third stage bootstrapping.
     int pre_main(runtime_mode mode)
     {
+        util::startup_phase_completed("runtime start");
+
         // Register pre-shutdown and shutdown functions to flush pending
         // reference counting operations.
         register_pre_shutdown_function(&garbage_collect_non_blocking);
@@ -113,6 +146,7 @@ namespace hpx { namespace detail {
             exit_code = runtime_support::load_components(find_here());
             lbt_ << "(2nd stage) pre_main: loaded components"
                  << (exit_code ? ", application exit has been requested" : "");
+            util::startup_phase_completed("component loading");
 
             // Work on registration requests for message handler plugins
 #if defined(HPX_HAVE_NETWORKING)
@@ -121,14 +155,17 @@ namespace hpx { namespace detail {
             // Register all counter types before the startup functions are being
             // executed.
             register_counter_types();
+            util::startup_phase_completed("performance counter registration");
 
             rt.set_state(state_pre_startup);
             runtime_support::call_startup_functions(find_here(), true);
             lbt_ << "(3rd stage) pre_main: ran pre-startup functions";
+            util::startup_phase_completed("pre-startup functions");
 
             rt.set_state(state_startup);
             runtime_support::call_startup_functions(find_here(), false);
             lbt_ << "(4th stage) pre_main: ran startup functions";
+            util::startup_phase_completed("startup functions");
         }
         else
         {
@@ -138,6 +175,7 @@ namespace hpx { namespace detail {
             exit_code = runtime_support::load_components(find_here());
             lbt_ << "(2nd stage) pre_main: loaded components"
                  << (exit_code ? ", application exit has been requested" : "");
+            util::startup_phase_completed("component loading");
 
             // Second and third stage barrier creation.
             if (agas_client.is_bootstrap())
@@ -180,9 +218,11 @@ namespace hpx { namespace detail {
             // across all localities.
             lcos::barrier::synchronize();
             lbt_ << "(3rd stage) pre_main: passed 3rd stage boot barrier";
+            util::startup_phase_completed("startup synchronization");
 
             runtime_support::call_startup_functions(find_here(), true);
             lbt_ << "(3rd stage) pre_main: ran pre-startup functions";
+            util::startup_phase_completed("pre-startup functions");
 
             // Third stage separates pre-startup and startup function phase.
             lcos::barrier::synchronize();
@@ -197,6 +237,7 @@ namespace hpx { namespace detail {
             // component tables are populated.
             lcos::barrier::synchronize();
             lbt_ << "(5th stage) pre_main: passed 4th stage boot barrier";
+            util::startup_phase_completed("startup functions");
         }
 
         // Enable logging. Even if we terminate at this point we will see all
@@ -234,6 +275,26 @@ namespace hpx { namespace detail {
                  << connect_back_to;
         }
 
+        // Start sampling the invocations of migratable objects, if requested
+        if (get_config_entry("hpx.automatic_migration.enabled", "0") != "0")
+        {
+            components::detail::start_migration_service();
+            register_pre_shutdown_function(
+                &components::detail::stop_migration_service);
+            lbt_ << "(last stage) pre_main: started automatic migration "
+                    "service";
+        }
+
+        // Start exchanging the load of all localities, if requested
+        if (get_config_entry("hpx.load_information.enabled", "0") != "0")
+        {
+            components::detail::start_load_information_service();
+            register_pre_shutdown_function(
+                &components::detail::stop_load_information_service);
+            lbt_ << "(last stage) pre_main: started load information service";
+        }
+
+        print_startup_profile();
         return 0;
     }
 
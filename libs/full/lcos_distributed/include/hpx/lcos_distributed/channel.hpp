@@ -13,13 +13,18 @@
 #include <hpx/async_distributed/apply.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/promise_remote_result.hpp>
 #include <hpx/lcos_distributed/server/channel.hpp>
 #include <hpx/modules/naming.hpp>
 #include <hpx/runtime_components/new.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <deque>
+#include <iterator>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace lcos {
 
@@ -557,5 +562,227 @@ namespace hpx { namespace lcos {
             return close(launch::sync, force_delete_entries);
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A batched_send_channel buffers the values sent to a (possibly remote)
+    /// channel and ships them in batches of \a batch_size values. At most
+    /// \a window values sent through one instance may not have been
+    /// retrieved from the channel yet, further calls to \a set or \a flush
+    /// wait until enough of them have been retrieved. This bounds the
+    /// memory needed by the receiving end.
+    ///
+    /// \note An instance of this class is meant to be used by a single
+    ///       producer at a time. Buffered values are sent only once a batch
+    ///       is full or \a flush or \a close is called.
+    template <typename T>
+    class batched_send_channel
+    {
+        static_assert(!std::is_void<T>::value,
+            "batched_send_channel does not support channels of void");
+
+        using remote_type = traits::promise_remote_result_t<T>;
+        using set_values_action =
+            typename lcos::server::channel<T>::set_values_action;
+
+    public:
+        static constexpr std::size_t default_batch_size = 64;
+        static constexpr std::size_t default_window = 1024;
+
+        batched_send_channel() = default;
+
+        explicit batched_send_channel(channel<T> const& c,
+            std::size_t batch_size = default_batch_size,
+            std::size_t window = default_window)
+          : id_(c.get_id())
+          , batch_size_((std::max)(batch_size, std::size_t(1)))
+          , window_((std::max)(window, batch_size_))
+        {
+            buffer_.reserve(batch_size_);
+        }
+
+        explicit batched_send_channel(send_channel<T> const& c,
+            std::size_t batch_size = default_batch_size,
+            std::size_t window = default_window)
+          : id_(c.get_id())
+          , batch_size_((std::max)(batch_size, std::size_t(1)))
+          , window_((std::max)(window, batch_size_))
+        {
+            buffer_.reserve(batch_size_);
+        }
+
+        batched_send_channel(batched_send_channel&&) = default;
+        batched_send_channel& operator=(batched_send_channel&&) = default;
+
+        // values which are still buffered are sent without waiting for the
+        // receiving end
+        ~batched_send_channel()
+        {
+            if (id_ && !buffer_.empty())
+            {
+                hpx::apply(set_values_action(), id_, HPX_MOVE(buffer_));
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename U>
+        void set(U&& val)
+        {
+            buffer_.emplace_back(HPX_FORWARD(U, val));
+            if (buffer_.size() >= batch_size_)
+            {
+                flush();
+            }
+        }
+
+        // Send all buffered values to the channel. This waits for values
+        // sent earlier to be retrieved if otherwise more than window values
+        // would be outstanding.
+        void flush()
+        {
+            if (buffer_.empty())
+            {
+                return;
+            }
+
+            std::size_t const count = buffer_.size();
+            while (!batches_.empty() &&
+                (batches_.front().first.is_ready() ||
+                    outstanding_ + count > window_))
+            {
+                retire_batch();
+            }
+
+            std::vector<remote_type> values;
+            values.reserve(batch_size_);
+            std::swap(values, buffer_);
+
+            batches_.emplace_back(
+                hpx::async(set_values_action(), id_, HPX_MOVE(values)), count);
+            outstanding_ += count;
+        }
+
+        // Send all buffered values and close the channel once all values
+        // sent through this instance have been retrieved.
+        std::size_t close(bool force_delete_entries = false)
+        {
+            flush();
+            while (!batches_.empty())
+            {
+                retire_batch();
+            }
+
+            using action_type = typename lcos::server::channel<T>::close_action;
+            return action_type()(id_, force_delete_entries);
+        }
+
+        hpx::id_type const& get_id() const noexcept
+        {
+            return id_;
+        }
+
+    private:
+        // wait for the oldest batch to be retrieved, rethrows any error
+        // (e.g. if the channel was closed)
+        void retire_batch()
+        {
+            std::pair<hpx::future<void>, std::size_t> batch =
+                HPX_MOVE(batches_.front());
+            batches_.pop_front();
+
+            outstanding_ -= batch.second;
+            batch.first.get();
+        }
+
+        hpx::id_type id_;
+        std::size_t batch_size_ = default_batch_size;
+        std::size_t window_ = default_window;
+
+        std::vector<remote_type> buffer_;
+        std::deque<std::pair<hpx::future<void>, std::size_t>> batches_;
+        std::size_t outstanding_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A prefetching_receive_channel retrieves the values from a (possibly
+    /// remote) channel in batches of up to \a prefetch values. The next
+    /// batch is requested as soon as the previous one has arrived, which
+    /// makes most calls to \a get local.
+    ///
+    /// \note An instance of this class is meant to be used by a single
+    ///       consumer at a time. Values which were prefetched but not
+    ///       retrieved are lost when the instance is destroyed.
+    template <typename T>
+    class prefetching_receive_channel
+    {
+        static_assert(!std::is_void<T>::value,
+            "prefetching_receive_channel does not support channels of void");
+
+        using get_values_action =
+            typename lcos::server::channel<T>::get_values_action;
+
+    public:
+        static constexpr std::size_t default_prefetch = 64;
+
+        prefetching_receive_channel() = default;
+
+        explicit prefetching_receive_channel(
+            channel<T> const& c, std::size_t prefetch = default_prefetch)
+          : id_(c.get_id())
+          , prefetch_((std::max)(prefetch, std::size_t(1)))
+        {
+        }
+
+        explicit prefetching_receive_channel(receive_channel<T> const& c,
+            std::size_t prefetch = default_prefetch)
+          : id_(c.get_id())
+          , prefetch_((std::max)(prefetch, std::size_t(1)))
+        {
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        T get(launch::sync_policy, hpx::error_code& ec = hpx::throws)
+        {
+            if (buffer_.empty())
+            {
+                if (!pending_.valid())
+                {
+                    pending_ = hpx::async(get_values_action(), id_, prefetch_);
+                }
+
+                hpx::future<std::vector<T>> f = HPX_MOVE(pending_);
+                std::vector<T> values = f.get(ec);
+                if (ec)
+                {
+                    return T();
+                }
+
+                buffer_.assign(std::make_move_iterator(values.begin()),
+                    std::make_move_iterator(values.end()));
+
+                // fetch the next batch while this one is consumed
+                pending_ = hpx::async(get_values_action(), id_, prefetch_);
+            }
+
+            T value = HPX_MOVE(buffer_.front());
+            buffer_.pop_front();
+            return value;
+        }
+        T get(hpx::error_code& ec = hpx::throws)
+        {
+            return get(launch::sync, ec);
+        }
+
+        hpx::id_type const& get_id() const noexcept
+        {
+            return id_;
+        }
+
+    private:
+        hpx::id_type id_;
+        std::size_t prefetch_ = default_prefetch;
+
+        std::deque<T> buffer_;
+        hpx::future<std::vector<T>> pending_;
+    };
 }}    // namespace hpx::lcos
 #endif
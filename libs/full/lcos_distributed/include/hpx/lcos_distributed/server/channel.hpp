@@ -9,11 +9,13 @@
 #include <hpx/config.hpp>
 #include <hpx/actions/transfer_action.hpp>
 #include <hpx/actions_base/component_action.hpp>
+#include <hpx/async_combinators/when_all.hpp>
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/components_base/traits/is_component.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/futures/traits/get_remote_result.hpp>
 #include <hpx/futures/traits/promise_remote_result.hpp>
 #include <hpx/lcos_local/channel.hpp>
@@ -21,11 +23,16 @@
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <deque>
 #include <exception>
+#include <mutex>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace lcos { namespace server {
@@ -50,6 +57,7 @@ namespace hpx { namespace lcos { namespace server {
         using base_type = components::component_base<channel>;
         using result_type =
             std::conditional_t<std::is_void<T>::value, util::unused_type, T>;
+        using mutex_type = hpx::lcos::local::spinlock;
 
     public:
         channel() = default;
@@ -81,27 +89,32 @@ namespace hpx { namespace lcos { namespace server {
         void set_value(RemoteType&& result)
         {
             channel_.set(HPX_MOVE(result));
+            pushed(1);
         }
 
         // Close the channel
         void set_exception(std::exception_ptr const& /*e*/)
         {
             channel_.close();
+            release_batches();
         }
 
         // Retrieve the next value from the channel
         result_type get_value()
         {
+            requested(1);
             return channel_.get(launch::sync);
         }
         result_type get_value(error_code& ec)
         {
+            requested(1);
             return channel_.get(launch::sync, ec);
         }
 
         // Additional functionality exposed by the channel component
         hpx::future<T> get_generation(std::size_t generation)
         {
+            requested(1);
             return channel_.get(generation);
         }
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, get_generation)
@@ -109,17 +122,145 @@ namespace hpx { namespace lcos { namespace server {
         void set_generation(RemoteType&& value, std::size_t generation)
         {
             channel_.set(HPX_MOVE(value), generation);
+            pushed(1);
         }
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, set_generation)
 
         std::size_t close(bool force_delete_entries)
         {
-            return channel_.close(force_delete_entries);
+            std::size_t result = channel_.close(force_delete_entries);
+            release_batches();
+            return result;
         }
         HPX_DEFINE_COMPONENT_ACTION(channel, close)
 
+        // Push a batch of values to the channel. The returned future becomes
+        // ready once all values of the batch have been retrieved from the
+        // channel (or once the channel was closed), which allows for the
+        // sender to bound the number of values buffered here.
+        hpx::future<void> set_values(std::vector<RemoteType>&& values)
+        {
+            for (RemoteType& value : values)
+            {
+                channel_.set(HPX_MOVE(value));
+            }
+
+            std::unique_lock<mutex_type> l(mtx_);
+            pushed_ += values.size();
+
+            hpx::future<void> f;
+            if (requested_ >= pushed_)
+            {
+                f = hpx::make_ready_future();
+            }
+            else
+            {
+                lcos::local::promise<void> p;
+                f = p.get_future();
+                batches_.emplace_back(pushed_, HPX_MOVE(p));
+            }
+
+            release_batches(l);
+            return f;
+        }
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, set_values)
+
+        // Retrieve the next value from the channel together with up to
+        // max_count - 1 values which are available right away.
+        hpx::future<std::vector<result_type>> get_values(std::size_t max_count)
+        {
+            std::vector<hpx::future<result_type>> values;
+            {
+                std::unique_lock<mutex_type> l(mtx_);
+
+                std::size_t const available =
+                    pushed_ > requested_ ? pushed_ - requested_ : 0;
+                std::size_t const count = (std::max)(
+                    std::size_t(1), (std::min)(max_count, available));
+
+                values.reserve(count);
+                for (std::size_t i = 0; i != count; ++i)
+                {
+                    values.push_back(channel_.get());
+                }
+                requested_ += count;
+
+                release_batches(l);
+            }
+
+            return hpx::when_all(values).then(hpx::launch::sync,
+                [](hpx::future<std::vector<hpx::future<result_type>>>&& f) {
+                    std::vector<hpx::future<result_type>> values = f.get();
+
+                    // values beyond the first may be missing if the channel
+                    // was closed concurrently
+                    std::vector<result_type> result;
+                    result.reserve(values.size());
+                    for (hpx::future<result_type>& value : values)
+                    {
+                        if (value.has_exception() && !result.empty())
+                        {
+                            break;
+                        }
+                        result.push_back(value.get());
+                    }
+                    return result;
+                });
+        }
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, get_values)
+
     private:
+        // A value has been consumed once it has been both pushed to and
+        // requested from the channel. Release all batches which have been
+        // consumed completely.
+        void release_batches(std::unique_lock<mutex_type>& l)
+        {
+            std::size_t const consumed = (std::min)(pushed_, requested_);
+
+            std::vector<lcos::local::promise<void>> released;
+            while (!batches_.empty() && batches_.front().first <= consumed)
+            {
+                released.push_back(HPX_MOVE(batches_.front().second));
+                batches_.pop_front();
+            }
+
+            l.unlock();
+            for (lcos::local::promise<void>& p : released)
+            {
+                p.set_value();
+            }
+        }
+
+        // release all batches once the channel has been closed
+        void release_batches()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            requested_ = (std::max)(requested_, pushed_);
+            release_batches(l);
+        }
+
+        void pushed(std::size_t count)
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            pushed_ += count;
+            release_batches(l);
+        }
+
+        void requested(std::size_t count)
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            requested_ += count;
+            release_batches(l);
+        }
+
         lcos::local::channel<result_type> channel_;
+
+        // bookkeeping for batched senders
+        mutex_type mtx_;
+        std::size_t pushed_ = 0;
+        std::size_t requested_ = 0;
+        std::deque<std::pair<std::size_t, lcos::local::promise<void>>>
+            batches_;
     };
 }}}    // namespace hpx::lcos::server
 
@@ -146,6 +287,12 @@ namespace hpx { namespace lcos { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         hpx::lcos::server::channel<type>::close_action,                        \
         HPX_PP_CAT(__channel_close_action, HPX_PP_CAT(type, name)))            \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        hpx::lcos::server::channel<type>::set_values_action,                   \
+        HPX_PP_CAT(__channel_set_values_action, HPX_PP_CAT(type, name)))       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        hpx::lcos::server::channel<type>::get_values_action,                   \
+        HPX_PP_CAT(__channel_get_values_action, HPX_PP_CAT(type, name)))       \
     HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(                              \
         type, type, name, component_tag)                                       \
     /**/
@@ -179,5 +326,9 @@ namespace hpx { namespace lcos { namespace server {
         HPX_PP_CAT(__channel_set_generation_action, HPX_PP_CAT(type, name)))   \
     HPX_REGISTER_ACTION(hpx::lcos::server::channel<type>::close_action,        \
         HPX_PP_CAT(__channel_close_action, HPX_PP_CAT(type, name)))            \
+    HPX_REGISTER_ACTION(hpx::lcos::server::channel<type>::set_values_action,   \
+        HPX_PP_CAT(__channel_set_values_action, HPX_PP_CAT(type, name)))       \
+    HPX_REGISTER_ACTION(hpx::lcos::server::channel<type>::get_values_action,   \
+        HPX_PP_CAT(__channel_get_values_action, HPX_PP_CAT(type, name)))       \
     HPX_REGISTER_BASE_LCO_WITH_VALUE(type, type, name, component_tag)          \
     /**/
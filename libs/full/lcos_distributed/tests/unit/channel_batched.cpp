@@ -0,0 +1,90 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <vector>
+
+HPX_REGISTER_CHANNEL(int)
+
+///////////////////////////////////////////////////////////////////////////////
+void produce(hpx::lcos::channel<int> c, int count, std::size_t batch_size,
+    std::size_t window)
+{
+    hpx::lcos::batched_send_channel<int> sender(c, batch_size, window);
+    for (int i = 0; i != count; ++i)
+    {
+        sender.set(i);
+    }
+    sender.close();
+}
+HPX_PLAIN_ACTION(produce)
+
+void test_batched_channel(hpx::id_type const& producer_loc, int count,
+    std::size_t batch_size, std::size_t window, std::size_t prefetch)
+{
+    hpx::lcos::channel<int> c(hpx::find_here());
+    hpx::future<void> producer = hpx::async(
+        produce_action(), producer_loc, c, count, batch_size, window);
+
+    // values arrive in the order they were sent, the channel is closed
+    // after the last one
+    hpx::lcos::prefetching_receive_channel<int> receiver(c, prefetch);
+    int expected = 0;
+    while (true)
+    {
+        hpx::error_code ec(hpx::lightweight);
+        int value = receiver.get(ec);
+        if (ec)
+        {
+            break;
+        }
+        HPX_TEST_EQ(value, expected);
+        ++expected;
+    }
+    HPX_TEST_EQ(expected, count);
+
+    producer.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_flush(hpx::id_type const& loc)
+{
+    hpx::lcos::channel<int> c(loc);
+
+    // buffered values are sent on flush only
+    hpx::lcos::batched_send_channel<int> sender(c, 100);
+    sender.set(42);
+    sender.set(43);
+    sender.flush();
+
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 42);
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 43);
+
+    sender.close();
+}
+
+int main()
+{
+    for (hpx::id_type const& loc : hpx::find_all_localities())
+    {
+        test_batched_channel(loc, 10000, 64, 256, 32);
+        test_batched_channel(loc, 1000, 1, 1, 1);
+        test_batched_channel(loc, 1000, 100, 100, 1000);
+        test_flush(loc);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
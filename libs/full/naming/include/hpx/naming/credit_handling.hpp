@@ -50,6 +50,15 @@ namespace hpx { namespace naming {
         HPX_EXPORT std::int64_t replenish_credits_locked(
             std::unique_lock<gid_type::mutex_type>& l, gid_type& id);
 
+        // adds credit obtained from AGAS to the given id, returns any credit
+        // which can't be represented back to AGAS
+        HPX_EXPORT void add_replenished_credits(
+            gid_type& id, std::int64_t added_credit);
+
+        // asynchronously replenishes the credit of the given id if it has
+        // fallen to hpx.agas.credit_replenish_threshold
+        HPX_EXPORT void replenish_credits_speculatively(id_type_impl& id);
+
         ///////////////////////////////////////////////////////////////////////
         // splits the current credit of the given id and assigns half of it to
         // the returned copy
@@ -8,6 +8,7 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_local/apply.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/detail/agas_interface_functions.hpp>
 #include <hpx/functional/bind.hpp>
@@ -23,16 +24,23 @@
 #include <hpx/naming/split_gid.hpp>
 #include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/runtime_local.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/runtime_local/state.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/synchronization/spinlock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/util/get_entry_as.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <mutex>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 //
@@ -98,6 +106,13 @@
 // Note that both the id_type instance staying behind and the one sent along
 // are replenished before sending out the parcel at the sending locality.
 //
+// Ids which are sent very often exhaust their credit regularly, which makes
+// the serializing thread wait for AGAS. If hpx.agas.credit_replenish_threshold
+// is set, the credit of an id is replenished speculatively (asynchronously)
+// as soon as its log2 credit falls to the given threshold. The synchronous
+// replenishment described above is then required only if the id is split
+// faster than AGAS can respond.
+//
 ///////////////////////////////////////////////////////////////////////////////
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -302,6 +317,194 @@ namespace hpx { namespace naming {
             return hpx::make_ready_future(new_gid);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        namespace {
+
+            // The log2 credit at or below which the credit of an id that is
+            // being sent is replenished asynchronously, zero if disabled.
+            std::int16_t get_credit_replenish_threshold()
+            {
+                static std::atomic<std::int16_t> threshold(-1);
+
+                std::int16_t value = threshold.load(std::memory_order_relaxed);
+                if (value < 0 && get_runtime_ptr() != nullptr)
+                {
+                    value = util::get_entry_as<std::int16_t>(
+                        get_runtime().get_config(),
+                        "hpx.agas.credit_replenish_threshold", 0);
+
+                    // a credit of 2 is replenished synchronously anyways
+                    std::int16_t const max_threshold =
+                        detail::log2(HPX_GLOBALCREDIT_INITIAL) - 1;
+                    value = value <= 1 ? 0 : (std::min)(value, max_threshold);
+
+                    threshold.store(value, std::memory_order_relaxed);
+                }
+                return value;
+            }
+
+            // Collects the ids whose credit is running low and requests new
+            // credit for them from AGAS. All ids collected while the previous
+            // batch is being issued are handled by the next batch. There is
+            // at most one outstanding request per id.
+            class credit_replenisher
+            {
+            public:
+                using mutex_type = hpx::lcos::local::spinlock;
+
+                static credit_replenisher& instance()
+                {
+                    static credit_replenisher replenisher;
+                    return replenisher;
+                }
+
+                void add(id_type_impl& id);
+
+            private:
+                void flush();
+                void replenish(hpx::intrusive_ptr<id_type_impl> id);
+                void done(id_type_impl const* id);
+
+                mutex_type mtx_;
+                std::vector<hpx::intrusive_ptr<id_type_impl>> pending_;
+                std::unordered_set<id_type_impl const*> in_flight_;
+            };
+
+            void credit_replenisher::add(id_type_impl& id)
+            {
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (!in_flight_.insert(&id).second)
+                    {
+                        return;    // already being replenished
+                    }
+
+                    // the reference keeps the id alive until the new credit
+                    // has been added to it
+                    pending_.emplace_back(&id);
+                    if (pending_.size() != 1)
+                    {
+                        return;    // the batch has been scheduled already
+                    }
+                }
+
+                hpx::apply([this]() { flush(); });
+            }
+
+            void credit_replenisher::flush()
+            {
+                std::vector<hpx::intrusive_ptr<id_type_impl>> ids;
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    std::swap(ids, pending_);
+                }
+
+                for (auto& id : ids)
+                {
+                    replenish(HPX_MOVE(id));
+                }
+            }
+
+            void credit_replenisher::replenish(
+                hpx::intrusive_ptr<id_type_impl> id)
+            {
+                gid_type gid;
+                std::int64_t added_credit = 0;
+                {
+                    std::unique_lock<gid_type::mutex_type> l(id->get_mutex());
+                    if (has_credits(*id))
+                    {
+                        // request the credit needed to fill up the id,
+                        // splits happening in the meantime are accounted
+                        // for once the request has returned
+                        added_credit =
+                            static_cast<std::int64_t>(
+                                HPX_GLOBALCREDIT_INITIAL) -
+                            get_credit_from_gid(*id);
+                        gid = *id;    // strips lock-bit
+                    }
+                }
+
+                if (added_credit <= 0 ||
+                    !threads::threadmanager_is(state_running))
+                {
+                    done(id.get());
+                    return;
+                }
+
+                agas::incref(gid, added_credit)
+                    .then(hpx::launch::sync,
+                        [this, id = HPX_MOVE(id), added_credit](
+                            hpx::future<std::int64_t>&& f) {
+                            // keep the current credit if the request failed,
+                            // the id will be replenished synchronously
+                            if (!f.has_exception())
+                            {
+                                add_replenished_credits(*id, added_credit);
+                            }
+                            done(id.get());
+                        });
+            }
+
+            void credit_replenisher::done(id_type_impl const* id)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                in_flight_.erase(id);
+            }
+        }    // namespace
+
+        void add_replenished_credits(gid_type& gid, std::int64_t added_credit)
+        {
+            std::unique_lock<gid_type::mutex_type> l(gid.get_mutex());
+
+            // The credit can be represented as a power of two only. Any
+            // credit exceeding the largest representable value is returned to
+            // AGAS, this includes all of the added credit if the credit of
+            // the id has been moved in the meantime.
+            std::int64_t overflow_credit = added_credit;
+            if (has_credits(gid))
+            {
+                std::int64_t const credit = get_credit_from_gid(gid);
+                std::int64_t new_credit = (std::min)(credit + added_credit,
+                    static_cast<std::int64_t>(HPX_GLOBALCREDIT_INITIAL));
+                new_credit = power2(detail::log2(new_credit));
+
+                overflow_credit = credit + added_credit - new_credit;
+
+                set_credit_for_gid(gid, new_credit);
+                set_credit_split_mask_for_gid(gid);
+            }
+
+            if (overflow_credit > 0)
+            {
+                gid_type unlocked_gid = gid;    // strips lock-bit
+                l.unlock();
+
+                // Note that this operation may be asynchronous
+                agas::decref(unlocked_gid, overflow_credit);
+            }
+        }
+
+        void replenish_credits_speculatively(id_type_impl& id)
+        {
+            std::int16_t const threshold = get_credit_replenish_threshold();
+            if (threshold == 0)
+            {
+                return;
+            }
+
+            {
+                std::unique_lock<gid_type::mutex_type> l(id.get_mutex());
+                if (!has_credits(id) ||
+                    get_log2credit_from_gid(id) > threshold)
+                {
+                    return;
+                }
+            }
+
+            credit_replenisher::instance().add(id);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         gid_type move_gid(gid_type& gid)
         {
@@ -478,6 +681,9 @@ namespace hpx { namespace naming {
             handle_futures.await_future(
                 *traits::future_access<decltype(f)>::get_shared_state(f),
                 false);
+
+            // ids sent often are replenished before their credit is exhausted
+            replenish_credits_speculatively(gid);
         }
 
         void preprocess_gid(
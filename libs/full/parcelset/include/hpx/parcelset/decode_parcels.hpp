@@ -17,6 +17,7 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/threading_base/trace_recorder.hpp>
 
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/naming_base/id_type.hpp>
@@ -28,10 +29,13 @@
 #include <boost/exception/exception.hpp>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <memory>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -105,6 +109,295 @@ namespace hpx::parcelset {
         return chunks;
     }
 
+    namespace detail {
+
+        // Messages with at least this many parcels are decoded in parallel
+        // (if they carry a parcel offset table)
+        inline constexpr std::size_t parallel_decode_threshold = 64;
+
+        // The minimal number of parcels to decode on one thread
+        inline constexpr std::size_t parallel_decode_min_batch_size = 16;
+
+        ///////////////////////////////////////////////////////////////////////
+        // De-serialize the next parcel from the given archive. Non-direct
+        // actions are scheduled right away, parcels carrying direct actions
+        // are appended to deferred_parcels if deferred_schedule is true.
+        template <typename Parcelport>
+        void decode_parcel(Parcelport& pp,
+            serialization::input_archive& archive, std::size_t num_thread,
+            bool deferred_schedule,
+            std::vector<parcelset::parcel>& deferred_parcels,
+            hpx::chrono::high_resolution_timer& timer,
+            std::int64_t& overall_add_parcel_time)
+        {
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            std::size_t archive_pos = archive.current_pos();
+            std::int64_t serialize_time = timer.elapsed_nanoseconds();
+#else
+            HPX_UNUSED(pp);
+#endif
+            // de-serialize parcel and add it to incoming parcel queue
+            parcelset::parcel p;
+
+            // deferred_schedule will be set to false if the action to be
+            // loaded is a non direct action. If we only got one parcel to
+            // decode, deferred_schedule will be preset to false and the
+            // direct action will be called directly
+            bool migrated =
+                p.load_schedule(archive, num_thread, deferred_schedule);
+
+            std::int64_t add_parcel_time = timer.elapsed_nanoseconds();
+
+#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            parcelset::data_point action_data;
+            action_data.bytes_ = archive.current_pos() - archive_pos;
+            action_data.serialization_time_ =
+                add_parcel_time - serialize_time;
+            action_data.num_parcels_ = 1;
+            pp.add_received_data(p.get_action_name(), action_data);
+#endif
+            // make sure this parcel ended up on the right locality
+            std::uint32_t here = agas::get_locality_id();
+            if (hpx::get_runtime_ptr() &&
+                here != naming::invalid_locality_id &&
+                (naming::get_locality_id_from_gid(p.destination_locality()) !=
+                    here))
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "hpx::parcelset::decode_message",
+                    "parcel destination does not match locality which "
+                    "received the parcel ({}), {}",
+                    here, p);
+                return;
+            }
+
+            if (migrated)
+            {
+                agas::route(HPX_MOVE(p),
+                    &parcelset::detail::parcel_route_handler,
+                    threads::thread_priority::normal);
+            }
+            else if (deferred_schedule)
+            {
+                // If we got a direct action
+                deferred_parcels.push_back(HPX_MOVE(p));
+            }
+
+            // be sure not to measure add_parcel as serialization time
+            overall_add_parcel_time +=
+                timer.elapsed_nanoseconds() - add_parcel_time;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Schedule all parcels carrying direct actions
+        inline void schedule_deferred_parcels(
+            std::vector<parcelset::parcel>& deferred_parcels,
+            std::size_t num_thread)
+        {
+            if (deferred_parcels.empty())
+                return;
+
+            for (std::size_t i = 1; i != deferred_parcels.size(); ++i)
+            {
+                auto f = [num_thread](parcelset::parcel&& p) {
+                    if (p.schedule_action(num_thread))
+                    {
+                        // route this parcel as the object was migrated
+                        agas::route(HPX_MOVE(p),
+                            &parcelset::detail::parcel_route_handler,
+                            threads::thread_priority::normal);
+                    }
+                };
+
+                // schedule all but the first parcel on a new thread.
+                hpx::threads::thread_init_data data(
+                    hpx::threads::make_thread_function_nullary(
+                        util::deferred_call(
+                            HPX_MOVE(f), HPX_MOVE(deferred_parcels[i]))),
+                    "schedule_parcel", threads::thread_priority::boost,
+                    threads::thread_schedule_hint(
+                        static_cast<std::int16_t>(num_thread)),
+                    threads::thread_stacksize::default_,
+                    threads::thread_schedule_state::pending, true);
+                hpx::threads::register_thread(data);
+            }
+
+            // If we are the first deferred parcel, we don't need to spin
+            // up a new thread...
+            if (deferred_parcels[0].schedule_action(num_thread))
+            {
+                // route this parcel as the object was migrated
+                agas::route(HPX_MOVE(deferred_parcels[0]),
+                    &parcelset::detail::parcel_route_handler,
+                    threads::thread_priority::normal);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The state shared by all threads decoding the parcels of the same
+        // message in parallel.
+        template <typename Parcelport, typename Buffer>
+        struct parallel_decode_state
+        {
+            parallel_decode_state(Parcelport& pp,
+                std::shared_ptr<Buffer>&& buffer,
+                std::vector<std::uint64_t>&& offsets,
+                std::size_t offsets_pos, std::size_t num_batches,
+                std::size_t num_thread)
+              : pp_(pp)
+              , buffer_(HPX_MOVE(buffer))
+              , offsets_(HPX_MOVE(offsets))
+              , offsets_pos_(offsets_pos)
+              , num_thread_(num_thread)
+              , pending_batches_(num_batches)
+              , serialization_time_(0)
+            {
+            }
+
+            // the last batch to finish updates the statistics
+            void batch_done(std::int64_t serialization_time)
+            {
+                serialization_time_ += serialization_time;
+                if (--pending_batches_ != 0)
+                    return;
+
+                parcelset::data_point& data = buffer_->data_point_;
+                data.num_parcels_ = offsets_.size();
+                data.raw_bytes_ = offsets_pos_;
+                data.serialization_time_ = serialization_time_;
+
+                threads::tracing::record(
+                    threads::tracing::event_type::parcel_receive, nullptr,
+                    data.raw_bytes_,
+                    static_cast<std::uint32_t>(offsets_.size()));
+
+                pp_.add_received_data(data);
+            }
+
+            // decode the parcels [first, last) using the given archive
+            void decode_batch(serialization::input_archive& archive,
+                std::size_t first, std::size_t last)
+            {
+                hpx::chrono::high_resolution_timer timer;
+                std::int64_t overall_add_parcel_time = 0;
+
+                std::vector<parcelset::parcel> deferred_parcels;
+                deferred_parcels.reserve(last - first);
+
+                archive.seek(offsets_[first]);
+                for (std::size_t i = first; i != last; ++i)
+                {
+                    detail::decode_parcel(pp_, archive, num_thread_, true,
+                        deferred_parcels, timer, overall_add_parcel_time);
+                }
+
+                batch_done(
+                    timer.elapsed_nanoseconds() - overall_add_parcel_time);
+
+                schedule_deferred_parcels(deferred_parcels, num_thread_);
+            }
+
+            // decode the parcels [first, last) using a new archive
+            void decode_batch(std::size_t first, std::size_t last)
+            {
+                serialization::input_archive archive(buffer_->data_,
+                    static_cast<std::size_t>(
+                        static_cast<std::uint64_t>(buffer_->data_size_)));
+                decode_batch(archive, first, last);
+            }
+
+            Parcelport& pp_;
+            std::shared_ptr<Buffer> buffer_;
+            std::vector<std::uint64_t> offsets_;
+            std::size_t offsets_pos_;
+            std::size_t num_thread_;
+            std::atomic<std::size_t> pending_batches_;
+            std::atomic<std::int64_t> serialization_time_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Split the parcels of the given message into batches, all but the
+        // first of which are decoded on new threads. Each parcel is scheduled
+        // as soon as its batch has been decoded.
+        template <typename Parcelport, typename Buffer>
+        void decode_parcels_parallel(Parcelport& pp,
+            serialization::input_archive& archive,
+            std::shared_ptr<Buffer> buffer, std::size_t parcel_count,
+            std::size_t offsets_pos, std::size_t num_thread)
+        {
+            archive.seek(offsets_pos);
+
+            std::uint64_t num_offsets = 0;
+            archive >> num_offsets;
+            if (num_offsets != parcel_count)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "hpx::parcelset::decode_message",
+                    "inconsistent parcel offset table");
+                return;
+            }
+
+            std::vector<std::uint64_t> offsets(parcel_count);
+            for (std::uint64_t& offset : offsets)
+            {
+                archive >> offset;
+            }
+
+            if (offsets.empty() ||
+                !std::is_sorted(offsets.begin(), offsets.end()) ||
+                offsets.back() >= offsets_pos)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "hpx::parcelset::decode_message",
+                    "inconsistent parcel offset table");
+                return;
+            }
+
+            std::size_t const num_batches = (std::min)(
+                (std::max)(hpx::get_num_worker_threads(), std::size_t(1)),
+                parcel_count / parallel_decode_min_batch_size);
+            std::size_t const batch_size =
+                (parcel_count + num_batches - 1) / num_batches;
+
+            using state_type = parallel_decode_state<Parcelport, Buffer>;
+            auto state = std::make_shared<state_type>(pp, HPX_MOVE(buffer),
+                HPX_MOVE(offsets), offsets_pos, num_batches, num_thread);
+
+            for (std::size_t first = batch_size; first < parcel_count;
+                 first += batch_size)
+            {
+                std::size_t const last =
+                    (std::min)(first + batch_size, parcel_count);
+
+                auto f = [state, first, last]() {
+                    try
+                    {
+                        state->decode_batch(first, last);
+                    }
+                    catch (...)
+                    {
+                        LPT_(error).format(
+                            "decode_message: caught exception while "
+                            "decoding parcels in parallel");
+                        hpx::report_error(std::current_exception());
+                    }
+                };
+
+                hpx::threads::thread_init_data data(
+                    hpx::threads::make_thread_function_nullary(HPX_MOVE(f)),
+                    "decode_parcels", threads::thread_priority::boost,
+                    threads::thread_schedule_hint(),
+                    threads::thread_stacksize::default_,
+                    threads::thread_schedule_state::pending, true);
+                hpx::threads::register_thread(data);
+            }
+
+            // decode the first batch on this thread
+            state->decode_batch(
+                archive, 0, (std::min)(batch_size, parcel_count));
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(Parcelport& pp, Buffer buffer,
@@ -115,6 +408,15 @@ namespace hpx::parcelset {
         std::size_t inbound_data_size = static_cast<std::size_t>(
             static_cast<std::uint64_t>(buffer.data_size_));
 
+        // messages carrying several parcels without any zero-copy chunks can
+        // be decoded in parallel, this requires for the buffer to be shared
+        std::shared_ptr<Buffer> shared_buffer;
+        if (parcel_count == 0 && chunks.empty())
+        {
+            shared_buffer = std::make_shared<Buffer>(HPX_MOVE(buffer));
+        }
+        Buffer& buf = shared_buffer ? *shared_buffer : buffer;
+
         // protect from unhandled exceptions bubbling up
         try
         {
@@ -123,17 +425,31 @@ namespace hpx::parcelset {
                 // mark start of serialization
                 hpx::chrono::high_resolution_timer timer;
                 std::int64_t overall_add_parcel_time = 0;
-                parcelset::data_point& data = buffer.data_point_;
+                parcelset::data_point& data = buf.data_point_;
 
                 {
                     std::vector<parcelset::parcel> deferred_parcels;
                     // De-serialize the parcel data
                     serialization::input_archive archive(
-                        buffer.data_, inbound_data_size, &chunks);
+                        buf.data_, inbound_data_size, &chunks);
 
                     if (parcel_count == 0)
                     {
                         archive >> parcel_count;    //-V128
+
+                        // position of the parcel offset table (if any)
+                        std::uint64_t offsets_pos = 0;
+                        archive >> offsets_pos;
+
+                        if (offsets_pos != 0 && shared_buffer &&
+                            parcel_count >= detail::parallel_decode_threshold)
+                        {
+                            detail::decode_parcels_parallel(pp, archive,
+                                HPX_MOVE(shared_buffer), parcel_count,
+                                static_cast<std::size_t>(offsets_pos),
+                                num_thread);
+                            return;
+                        }
                     }
                     if (parcel_count > 1)
                     {
@@ -142,113 +458,22 @@ namespace hpx::parcelset {
 
                     for (std::size_t i = 0; i != parcel_count; ++i)
                     {
-                        bool deferred_schedule = parcel_count > 1;
-
-#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        std::size_t archive_pos = archive.current_pos();
-                        std::int64_t serialize_time =
-                            timer.elapsed_nanoseconds();
-#endif
-                        // de-serialize parcel and add it to incoming parcel queue
-                        parcelset::parcel p;
-
-                        // deferred_schedule will be set to false if the action
-                        // to be loaded is a non direct action. If we only got
-                        // one parcel to decode, deferred_schedule will be
-                        // preset to false and the direct action will be called
-                        // directly
-                        bool migrated = p.load_schedule(
-                            archive, num_thread, deferred_schedule);
-
-                        std::int64_t add_parcel_time =
-                            timer.elapsed_nanoseconds();
-
-#if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        parcelset::data_point action_data;
-                        action_data.bytes_ =
-                            archive.current_pos() - archive_pos;
-                        action_data.serialization_time_ =
-                            add_parcel_time - serialize_time;
-                        action_data.num_parcels_ = 1;
-                        pp.add_received_data(p.get_action_name(), action_data);
-#endif
-                        // make sure this parcel ended up on the right locality
-                        std::uint32_t here = agas::get_locality_id();
-                        if (hpx::get_runtime_ptr() &&
-                            here != naming::invalid_locality_id &&
-                            (naming::get_locality_id_from_gid(
-                                 p.destination_locality()) != here))
-                        {
-                            HPX_THROW_EXCEPTION(invalid_status,
-                                "hpx::parcelset::decode_message",
-                                "parcel destination does not match locality "
-                                "which received the parcel ({}), {}",
-                                here, p);
-                            return;
-                        }
-
-                        if (migrated)
-                        {
-                            agas::route(HPX_MOVE(p),
-                                &parcelset::detail::parcel_route_handler,
-                                threads::thread_priority::normal);
-                        }
-                        else if (deferred_schedule)
-                        {
-                            // If we got a direct action
-                            deferred_parcels.push_back(HPX_MOVE(p));
-                        }
-
-                        // be sure not to measure add_parcel as serialization time
-                        overall_add_parcel_time +=
-                            timer.elapsed_nanoseconds() - add_parcel_time;
+                        detail::decode_parcel(pp, archive, num_thread,
+                            parcel_count > 1, deferred_parcels, timer,
+                            overall_add_parcel_time);
                     }
 
                     // complete received data with parcel count
                     data.num_parcels_ = parcel_count;
                     data.raw_bytes_ = archive.bytes_read();
 
-                    if (!deferred_parcels.empty())
-                    {
-                        for (std::size_t i = 1; i != deferred_parcels.size();
-                             ++i)
-                        {
-                            auto f = [num_thread](parcelset::parcel&& p) {
-                                if (p.schedule_action(num_thread))
-                                {
-                                    // route this parcel as the object
-                                    // was migrated
-                                    agas::route(HPX_MOVE(p),
-                                        &parcelset::detail::
-                                            parcel_route_handler,
-                                        threads::thread_priority::normal);
-                                }
-                            };
-
-                            // schedule all but the first parcel on a new thread.
-                            hpx::threads::thread_init_data data(
-                                hpx::threads::make_thread_function_nullary(
-                                    util::deferred_call(HPX_MOVE(f),
-                                        HPX_MOVE(deferred_parcels[i]))),
-                                "schedule_parcel",
-                                threads::thread_priority::boost,
-                                threads::thread_schedule_hint(
-                                    static_cast<std::int16_t>(num_thread)),
-                                threads::thread_stacksize::default_,
-                                threads::thread_schedule_state::pending, true);
-                            hpx::threads::register_thread(data);
-                        }
+                    threads::tracing::record(
+                        threads::tracing::event_type::parcel_receive, nullptr,
+                        data.raw_bytes_,
+                        static_cast<std::uint32_t>(parcel_count));
 
-                        // If we are the first deferred parcel, we don't need to spin
-                        // up a new thread...
-                        if (deferred_parcels[0].schedule_action(num_thread))
-                        {
-                            // route this parcel as the object was migrated
-                            agas::route(HPX_MOVE(deferred_parcels[0]),
-                                &parcelset::detail::parcel_route_handler,
-                                threads::thread_priority::normal);
-                        }
-                    }
+                    detail::schedule_deferred_parcels(
+                        deferred_parcels, num_thread);
                 }
 
                 // store the time required for serialization
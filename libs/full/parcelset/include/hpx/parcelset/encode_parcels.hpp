@@ -19,6 +19,7 @@
 #include <hpx/modules/runtime_local.hpp>
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/serialization/detail/pointer.hpp>
 
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
@@ -33,6 +34,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <memory>
 #include <string>
@@ -181,6 +183,22 @@ namespace hpx::parcelset {
                 buffer.data_.reserve(arg_size);
                 buffer.chunks_.reserve(num_chunks);
 
+                // Messages carrying more than one parcel are followed by a
+                // table holding the positions of the individual parcels, which
+                // allows for the receiver to decode them in parallel. The
+                // position of that table is stored right after the number of
+                // parcels, zero signals that no table is available.
+                bool const write_offsets = num_parcels != std::size_t(-1) &&
+                    parcels_sent > 1 && filter.get() == nullptr;
+
+                std::size_t offsets_slot = 0;
+                std::uint64_t offsets_pos = 0;
+                std::vector<std::uint64_t> offsets;
+                if (write_offsets)
+                {
+                    offsets.reserve(parcels_sent);
+                }
+
                 // mark start of serialization
                 hpx::chrono::high_resolution_timer timer;
 
@@ -195,10 +213,30 @@ namespace hpx::parcelset {
                         archive_flags, &buffer.chunks_, filter.get());
 
                     if (num_parcels != std::size_t(-1))
+                    {
                         archive << parcels_sent;    //-V128
 
+                        // placeholder for the position of the offset table
+                        offsets_slot = archive.current_pos();
+                        archive << offsets_pos;
+                    }
+
                     for (std::size_t i = 0; i != parcels_sent; ++i)
                     {
+                        if (write_offsets)
+                        {
+                            offsets.push_back(archive.current_pos());
+
+                            // make sure each parcel can be de-serialized
+                            // independently of the others
+                            auto* tracker = archive.try_get_extra_data<
+                                serialization::detail::output_pointer_tracker>();
+                            if (tracker != nullptr)
+                            {
+                                tracker->clear();
+                            }
+                        }
+
 #if defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         std::size_t archive_pos = archive.current_pos();
                         std::int64_t serialize_time =
@@ -228,8 +266,40 @@ namespace hpx::parcelset {
                         HPX_UNUSED(pp);
 #endif
                     }
+
+                    if (write_offsets)
+                    {
+                        // The table is written element by element, which
+                        // places it inline into the archive. Serializing the
+                        // vector as a whole would turn larger tables into a
+                        // zero-copy chunk referring to this local vector.
+                        offsets_pos = archive.current_pos();
+                        archive << std::uint64_t(offsets.size());
+                        for (std::uint64_t offset : offsets)
+                        {
+                            archive << offset;
+                        }
+                    }
+
                     archive.flush();
                     arg_size = archive.bytes_written();
+
+                    if (write_offsets)
+                    {
+                        // the archive is not compressed, patch the position of
+                        // the offset table into the placeholder
+#if defined(HPX_SERIALIZATION_HAVE_SUPPORTS_ENDIANESS)
+                        if (archive.endianess_differs())
+                        {
+                            serialization::reverse_bytes(sizeof(offsets_pos),
+                                reinterpret_cast<char*>(&offsets_pos));
+                        }
+#endif
+                        HPX_ASSERT(offsets_slot + sizeof(offsets_pos) <=
+                            buffer.data_.size());
+                        std::memcpy(&buffer.data_[offsets_slot], &offsets_pos,
+                            sizeof(offsets_pos));
+                    }
                 }
 
                 // store the time required for serialization
@@ -128,6 +128,8 @@ namespace hpx::parcelset::detail {
         std::size_t size() const override;
         std::size_t& size() override;
 
+        std::size_t get_serialized_size() const override;
+
         bool schedule_action(std::size_t num_thread) override;
 
         // returns true if parcel was migrated, false if scheduled locally
@@ -50,6 +50,21 @@ namespace hpx::parcelset::detail {
 
         bool apply_single(parcelset::parcel& p)
         {
+            // Parcels with a serialized size known at compile time can't
+            // refer to any futures or ids, so there is no need to
+            // preprocess them.
+            if (!archive_.disable_array_optimization() &&
+                !archive_.endianess_differs())
+            {
+                std::size_t const size = p.get_serialized_size();
+                if (size != std::size_t(-1))
+                {
+                    p.size() = size + overhead_;
+                    p.num_chunks() = 0;
+                    return true;
+                }
+            }
+
             archive_.reset();
 
             archive_ << p;
@@ -16,18 +16,22 @@
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
+#include <hpx/serialization/traits/serialized_size.hpp>
 
 #include <hpx/actions/transfer_action.hpp>
 #include <hpx/actions_base/detail/action_factory.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/detail/invocation_sampling.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -386,6 +390,32 @@ namespace hpx::parcelset::detail {
         return size_;
     }
 
+    std::size_t parcel::get_serialized_size() const
+    {
+        if (!action_)
+        {
+            return std::size_t(-1);
+        }
+
+        std::size_t const action_size = action_->get_serialized_size();
+        if (action_size == std::size_t(-1))
+        {
+            return std::size_t(-1);
+        }
+
+        // see save_data below
+        std::size_t size = hpx::traits::serialized_size_v<parcel_data> +
+            hpx::traits::serialized_size_v<std::uint32_t> + action_size;
+
+#if defined(HPX_DEBUG)
+        // the action name is serialized as its length followed by the
+        // characters
+        size += hpx::traits::serialized_size_v<std::uint64_t> +
+            std::strlen(action_->get_action_name());
+#endif
+        return size;
+    }
+
     std::pair<naming::address_type, naming::component_type>
     parcel::determine_lva()
     {
@@ -454,6 +484,18 @@ namespace hpx::parcelset::detail {
             return true;
         }
 
+        // let the automatic migration service know where invocations of
+        // migratable objects originate from
+        components::detail::record_remote_invocation_type const record =
+            components::detail::record_remote_invocation.load(
+                std::memory_order_acquire);
+        if (record != nullptr && naming::detail::is_migratable(data_.dest_))
+        {
+            record(data_.dest_,
+                data_.addr_.type_,
+                naming::get_locality_id_from_gid(data_.source_id_));
+        }
+
         // continuation support, this is handled in the transfer action
         action_->load_schedule(ar, HPX_MOVE(data_.dest_), p.first, p.second,
             num_thread, deferred_schedule);
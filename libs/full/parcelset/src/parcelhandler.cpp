@@ -28,6 +28,7 @@
 #include <hpx/modules/threadmanager.hpp>
 #include <hpx/modules/type_support.hpp>
 #include <hpx/modules/util.hpp>
+#include <hpx/threading_base/trace_recorder.hpp>
 #include <hpx/util/from_string.hpp>
 
 #include <hpx/components_base/agas_interface.hpp>
@@ -584,6 +585,13 @@ namespace hpx::parcelset {
         // properly initialize parcel
         init_parcel(p);
 
+        if (threads::tracing::is_enabled())
+        {
+            threads::tracing::record(threads::tracing::event_type::parcel_send,
+                threads::get_self_id_data(),
+                naming::get_locality_id_from_gid(gid));
+        }
+
         bool resolved_locally = true;
 
         if (!addr)
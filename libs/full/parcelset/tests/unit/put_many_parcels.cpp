@@ -0,0 +1,154 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send messages holding enough parcels to be decoded in parallel on the
+// receiving locality, with zero-copy serialization enabled.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 128;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename... Ts>
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, hpx::id_type const& cont, Ts&&... data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<std::int64_t>(cont), Action(),
+        hpx::threads::thread_priority::normal, std::forward<Ts>(data)...));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t small_argument(std::int64_t i)
+{
+    return i + 1;
+}
+HPX_PLAIN_ACTION(small_argument)
+
+std::int64_t large_argument(std::int64_t i, std::vector<std::int64_t> const& v)
+{
+    return i + std::accumulate(v.begin(), v.end(), std::int64_t(0));
+}
+HPX_PLAIN_ACTION(large_argument)
+
+// all parcels are sent as a single message, the arguments are small enough
+// not to create any zero-copy chunks
+void test_small_arguments(hpx::id_type const& id)
+{
+    std::vector<hpx::future<std::int64_t>> results;
+    results.reserve(numparcels_default);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        hpx::lcos::promise<std::int64_t> p;
+        results.push_back(p.get_future());
+        parcels.push_back(generate_parcel<small_argument_action>(
+            id, p.get_id(), std::int64_t(i)));
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    hpx::wait_all(results);
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), std::int64_t(i + 1));
+    }
+}
+
+// the arguments of every other parcel are large enough to be sent as
+// zero-copy chunks
+void test_mixed_arguments(hpx::id_type const& id)
+{
+    std::vector<std::int64_t> data(1024, 1);
+
+    std::vector<hpx::future<std::int64_t>> results;
+    results.reserve(numparcels_default);
+
+    std::vector<hpx::parcelset::parcel> parcels;
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        hpx::lcos::promise<std::int64_t> p;
+        results.push_back(p.get_future());
+        if (i % 2 == 0)
+        {
+            parcels.push_back(generate_parcel<small_argument_action>(
+                id, p.get_id(), std::int64_t(i)));
+        }
+        else
+        {
+            parcels.push_back(generate_parcel<large_argument_action>(
+                id, p.get_id(), std::int64_t(i), data));
+        }
+    }
+
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    hpx::wait_all(results);
+    for (std::size_t i = 0; i != numparcels_default; ++i)
+    {
+        std::int64_t const expected =
+            i % 2 == 0 ? std::int64_t(i + 1) : std::int64_t(i + 1024);
+        HPX_TEST_EQ(results[i].get(), expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        for (int i = 0; i != 10; ++i)
+        {
+            test_small_arguments(id);
+            test_mixed_arguments(id);
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly disable message handlers (parcel coalescing), explicitly
+    // enable zero-copy serialization
+    std::vector<std::string> const cfg = {
+#if defined(HPX_HAVE_NETWORKING)
+        "hpx.parcel.message_handlers=0",
+        "hpx.parcel.zero_copy_optimization!=1"
+#endif
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -90,6 +90,8 @@ namespace hpx::parcelset::detail {
         virtual std::size_t size() const = 0;
         virtual std::size_t& size() = 0;
 
+        virtual std::size_t get_serialized_size() const = 0;
+
         virtual bool schedule_action(std::size_t num_thread) = 0;
 
         virtual bool load_schedule(serialization::input_archive& ar,
@@ -175,6 +177,12 @@ namespace hpx::parcelset {
         std::size_t size() const;
         std::size_t& size();
 
+        // Return the number of bytes this parcel occupies when being
+        // serialized if this is known without having to serialize it,
+        // otherwise return std::size_t(-1). Parcels with a known serialized
+        // size don't need to be preprocessed before being sent.
+        std::size_t get_serialized_size() const;
+
         bool schedule_action(std::size_t num_thread = std::size_t(-1));
 
         // returns true if parcel was migrated, false if scheduled locally
@@ -191,6 +191,11 @@ namespace hpx::parcelset {
         return data_->size();
     }
 
+    std::size_t parcel::get_serialized_size() const
+    {
+        return data_->get_serialized_size();
+    }
+
     bool parcel::schedule_action(std::size_t num_thread)
     {
         return data_->schedule_action(num_thread);
@@ -0,0 +1,16 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+namespace hpx::performance_counters {
+
+    // install the counters exposing the efficiency of the pools used for
+    // allocating the shared states of futures
+    HPX_EXPORT void register_futures_counter_types();
+}    // namespace hpx::performance_counters
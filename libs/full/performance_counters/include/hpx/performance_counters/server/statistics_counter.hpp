@@ -30,6 +30,15 @@ namespace hpx { namespace performance_counters { namespace server {
             virtual bool need_reset() const = 0;
             virtual double get_value() = 0;
             virtual void add_value(double value) = 0;
+
+            // Statistics supporting concurrent updates are never replaced
+            // but reset in place, which allows to update them without
+            // holding the lock of the counter.
+            virtual bool is_concurrent() const
+            {
+                return false;
+            }
+            virtual void reset() {}
         };
     }    // namespace detail
 
@@ -83,6 +92,9 @@ namespace hpx { namespace performance_counters { namespace server {
         bool evaluate();
         bool ensure_base_counter();
 
+        // has to be called while holding the lock
+        void reset_statistic();
+
     private:
         typedef lcos::local::spinlock mutex_type;
         mutable mutex_type mtx_;
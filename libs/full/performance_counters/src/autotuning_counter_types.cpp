@@ -0,0 +1,132 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/execution/detail/autotuning_registry.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/performance_counters/autotuning_counter_types.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace hpx::performance_counters {
+
+    namespace detail {
+
+        using autotuning_registry =
+            hpx::execution::experimental::detail::autotuning_registry;
+
+        using autotuning_site_value_type =
+            std::int64_t (autotuning_registry::*)(std::string const&, bool);
+
+        // Creation function for counters reporting the tuning results of a
+        // single call site. The call site is given as the counter parameter:
+        //
+        //   /parallel{locality#<locality_id>/total}/autotuning/<name>@<key>
+        //
+        naming::gid_type autotuning_site_counter_creator(
+            autotuning_site_value_type value, counter_info const& info,
+            error_code& ec)
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, bad_parameter,
+                    "autotuning_site_counter_creator",
+                    "the autotuning call site has to be specified as the "
+                    "counter parameter: {}",
+                    info.fullname_);
+                return naming::invalid_gid;
+            }
+
+            hpx::util::function_nonser<std::int64_t(bool)> f =
+                util::bind_front(value, &autotuning_registry::instance(),
+                    HPX_MOVE(paths.parameters_));
+
+            return locality_raw_counter_creator(info, f, ec);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_autotuning_counter_types()
+    {
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        using detail::autotuning_registry;
+        autotuning_registry& registry = autotuning_registry::instance();
+
+        generic_counter_type_data const counter_types[] = {
+            {"/parallel/autotuning/count/call-sites", counter_raw,
+                "returns the number of call sites using an autotuned chunk "
+                "size",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    hpx::util::function_nonser<std::int64_t(bool)>(
+                        util::bind_front(
+                            &autotuning_registry::get_num_sites, &registry)),
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/parallel/autotuning/count/converged", counter_raw,
+                "returns the number of call sites for which the autotuning "
+                "of the chunk size has converged",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    hpx::util::function_nonser<std::int64_t(bool)>(
+                        util::bind_front(
+                            &autotuning_registry::get_num_converged_sites,
+                            &registry)),
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/parallel/autotuning/count/profile-hits", counter_raw,
+                "returns the number of call sites for which the tuning "
+                "results were loaded from the autotuning profile",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    hpx::util::function_nonser<std::int64_t(bool)>(
+                        util::bind_front(
+                            &autotuning_registry::get_num_profile_sites,
+                            &registry)),
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/parallel/autotuning/count/explorations",
+                counter_monotonically_increasing,
+                "returns the number of chunk size/core count configurations "
+                "explored by the autotuning",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    hpx::util::function_nonser<std::int64_t(bool)>(
+                        util::bind_front(
+                            &autotuning_registry::get_num_trials, &registry)),
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/parallel/autotuning/chunk-size", counter_raw,
+                "returns the currently best chunk size for the call site "
+                "given as the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::autotuning_site_counter_creator,
+                    &autotuning_registry::get_chunk_size),
+                &locality_counter_discoverer, ""},
+            {"/parallel/autotuning/cores", counter_raw,
+                "returns the currently best number of cores for the call "
+                "site given as the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind_front(&detail::autotuning_site_counter_creator,
+                    &autotuning_registry::get_cores),
+                &locality_counter_discoverer, ""}};
+
+        install_counter_types(
+            counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
+    }
+}    // namespace hpx::performance_counters
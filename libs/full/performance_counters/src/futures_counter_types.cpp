@@ -0,0 +1,64 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/futures/detail/shared_state_pool.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/futures_counter_types.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+
+#include <cstdint>
+
+namespace hpx::performance_counters {
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_futures_counter_types()
+    {
+#if defined(HPX_HAVE_FUTURE_SHARED_STATE_POOL)
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        using lcos::detail::shared_state_pool;
+
+        generic_counter_type_data const counter_types[] = {
+            {"/futures/count/shared-state-allocations",
+                counter_monotonically_increasing,
+                "returns the number of shared states of futures allocated on "
+                "this locality",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    hpx::util::function_nonser<std::int64_t(bool)>(
+                        &shared_state_pool::get_allocation_count),
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/futures/count/shared-state-pool-hits",
+                counter_monotonically_increasing,
+                "returns the number of shared states of futures whose memory "
+                "was taken from the per-thread pools",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    hpx::util::function_nonser<std::int64_t(bool)>(
+                        &shared_state_pool::get_pool_hit_count),
+                    _2),
+                &locality_counter_discoverer, ""},
+            {"/futures/count/shared-state-recycled",
+                counter_monotonically_increasing,
+                "returns the number of shared states of futures whose memory "
+                "was returned to the per-thread pools",
+                HPX_PERFORMANCE_COUNTER_V1,
+                util::bind(&locality_raw_counter_creator, _1,
+                    hpx::util::function_nonser<std::int64_t(bool)>(
+                        &shared_state_pool::get_recycled_count),
+                    _2),
+                &locality_counter_discoverer, ""}};
+
+        install_counter_types(
+            counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
+#endif
+    }
+}    // namespace hpx::performance_counters
@@ -20,6 +20,7 @@
 #include <hpx/performance_counters/server/raw_counter.hpp>
 #include <hpx/performance_counters/server/raw_values_counter.hpp>
 #include <hpx/performance_counters/server/statistics_counter.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
 #include <hpx/statistics/rolling_max.hpp>
 #include <hpx/statistics/rolling_min.hpp>
 #include <hpx/util/regex_from_pattern.hpp>
@@ -844,6 +845,29 @@ namespace hpx { namespace performance_counters {
                     complemented_info, base_counter_name, sample_interval,
                     window_size, reset_base_counter);
             }
+            else if (p.countername_ == "p50" || p.countername_ == "p90" ||
+                p.countername_ == "p99" || p.countername_ == "p999")
+            {
+                typedef hpx::components::component<hpx::performance_counters::
+                        server::statistics_counter<hpx::util::tag::percentile>>
+                    counter_t;
+
+                // the percentile is passed on in per-mille
+                std::size_t permille = 500;
+                if (p.countername_ == "p90")
+                    permille = 900;
+                else if (p.countername_ == "p99")
+                    permille = 990;
+                else if (p.countername_ == "p999")
+                    permille = 999;
+
+                if (parameters.size() > 1)
+                    reset_base_counter = (parameters[1] != 0) ? true : false;
+
+                gid = components::server::construct<counter_t>(
+                    complemented_info, base_counter_name, sample_interval,
+                    permille, reset_base_counter);
+            }
             else
             {
                 HPX_THROWS_IF(ec, bad_parameter,
@@ -27,6 +27,7 @@
 #include <boost/accumulators/statistics/stats.hpp>
 #include <boost/accumulators/statistics/variance.hpp>
 
+#include <hpx/statistics/log_linear_histogram.hpp>
 #include <hpx/statistics/rolling_max.hpp>
 #include <hpx/statistics/rolling_min.hpp>
 
@@ -373,6 +374,55 @@ namespace hpx { namespace performance_counters { namespace server {
         private:
             accumulator_type accum_;
         };
+
+        // The percentile to report is passed as parameter2 (in per-mille),
+        // the sampled values are recorded into a (sharded) histogram which
+        // can be updated without locking.
+        template <>
+        struct counter_type_from_statistic<hpx::util::tag::percentile>
+          : counter_type_from_statistic_base
+        {
+            counter_type_from_statistic(std::size_t parameter2)
+              : permille_(parameter2)
+            {
+                if (parameter2 > 1000)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "counter_type_from_statistic<Statistic>",
+                        "percentile is specified to be larger than 100%");
+                }
+            }
+
+            double get_value() override
+            {
+                return static_cast<double>(histogram_.percentile(
+                    static_cast<double>(permille_) / 10.0));
+            }
+
+            void add_value(double value) override
+            {
+                histogram_.add(static_cast<std::int64_t>(value));
+            }
+
+            bool need_reset() const override
+            {
+                return false;
+            }
+
+            bool is_concurrent() const override
+            {
+                return true;
+            }
+
+            void reset() override
+            {
+                histogram_.reset();
+            }
+
+        private:
+            std::size_t permille_;
+            hpx::util::log_linear_histogram histogram_;
+        };
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -436,10 +486,7 @@ namespace hpx { namespace performance_counters { namespace server {
 
         if (reset || value_->need_reset())
         {
-            value_.reset(new detail::counter_type_from_statistic<Statistic>(
-                parameter2_));    // reset accumulator
-            value_->add_value(static_cast<double>(prev_value_.value_));
-            // start off with last base value
+            reset_statistic();
         }
 
         return value;
@@ -465,6 +512,11 @@ namespace hpx { namespace performance_counters { namespace server {
                 "base counter should keep scaling constant over time");
             return false;
         }
+        else if (value_->is_concurrent())
+        {
+            // accumulate new value, the statistic is never replaced
+            value_->add_value(static_cast<double>(base_value.value_));
+        }
         else
         {
             // accumulate new value
@@ -597,10 +649,22 @@ namespace hpx { namespace performance_counters { namespace server {
     void statistics_counter<Statistic>::reset_counter_value()
     {
         std::lock_guard<mutex_type> l(mtx_);
+        reset_statistic();
+    }
 
+    template <typename Statistic>
+    void statistics_counter<Statistic>::reset_statistic()
+    {
         // reset accumulator
-        value_.reset(
-            new detail::counter_type_from_statistic<Statistic>(parameter2_));
+        if (value_->is_concurrent())
+        {
+            value_->reset();
+        }
+        else
+        {
+            value_.reset(new detail::counter_type_from_statistic<Statistic>(
+                parameter2_));
+        }
 
         // start off with last base value
         value_->add_value(static_cast<double>(prev_value_.value_));
@@ -647,6 +711,8 @@ template class HPX_EXPORT hpx::performance_counters::server::statistics_counter<
     hpx::util::tag::rolling_min>;
 template class HPX_EXPORT hpx::performance_counters::server::statistics_counter<
     hpx::util::tag::rolling_max>;
+template class HPX_EXPORT hpx::performance_counters::server::statistics_counter<
+    hpx::util::tag::percentile>;
 
 ///////////////////////////////////////////////////////////////////////////////
 // Average
@@ -747,6 +813,17 @@ HPX_REGISTER_DERIVED_COMPONENT_FACTORY(rolling_max_count_counter_type,
     hpx::components::factory_enabled)
 HPX_DEFINE_GET_COMPONENT_TYPE(rolling_max_count_counter_type::wrapped_type)
 
+///////////////////////////////////////////////////////////////////////////////
+// Percentiles
+typedef hpx::components::component<hpx::performance_counters::server::
+        statistics_counter<hpx::util::tag::percentile>>
+    percentile_count_counter_type;
+
+HPX_REGISTER_DERIVED_COMPONENT_FACTORY(percentile_count_counter_type,
+    percentile_count_counter, "base_performance_counter",
+    hpx::components::factory_enabled)
+HPX_DEFINE_GET_COMPONENT_TYPE(percentile_count_counter_type::wrapped_type)
+
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace performance_counters { namespace detail {
     /// Creation function for aggregating performance counters to be registered
@@ -0,0 +1,85 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_main.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_histogram()
+{
+    hpx::util::log_linear_histogram histogram(4);
+
+    std::vector<hpx::future<void>> futures;
+    for (int t = 0; t != 4; ++t)
+    {
+        futures.push_back(hpx::async([&]() {
+            for (std::int64_t i = 1; i <= 10000; ++i)
+                histogram.add(i);
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(histogram.count(), std::uint64_t(40000));
+    HPX_TEST_EQ(histogram.min(), std::uint64_t(1));
+    HPX_TEST_EQ(histogram.max(), std::uint64_t(10000));
+
+    // the relative error is bounded by 2^-precision_bits
+    std::uint64_t const p50 = histogram.percentile(50);
+    HPX_TEST_LTE(std::uint64_t(5000), p50);
+    HPX_TEST_LTE(p50, std::uint64_t(5000 + 5000 / 32));
+
+    std::uint64_t const p99 = histogram.percentile(99);
+    HPX_TEST_LTE(std::uint64_t(9900), p99);
+    HPX_TEST_LTE(p99, std::uint64_t(10000));
+
+    histogram.reset();
+    HPX_TEST_EQ(histogram.count(), std::uint64_t(0));
+    HPX_TEST_EQ(histogram.percentile(99), std::uint64_t(0));
+}
+
+void test_counters()
+{
+    using hpx::performance_counters::performance_counter;
+
+    performance_counter p50("/statistics{/runtime/uptime}/p50@100");
+    performance_counter p99("/statistics{/runtime/uptime}/p99@100");
+    performance_counter p999("/statistics{/runtime/uptime}/p999@100");
+
+    p50.start(hpx::launch::sync);
+    p99.start(hpx::launch::sync);
+    p999.start(hpx::launch::sync);
+
+    hpx::this_thread::sleep_for(std::chrono::seconds(1));
+
+    double const val50 = p50.get_value<double>(hpx::launch::sync);
+    double const val99 = p99.get_value<double>(hpx::launch::sync);
+    double const val999 = p999.get_value<double>(hpx::launch::sync);
+
+    HPX_TEST_LT(0.0, val50);
+    HPX_TEST_LTE(val50, val99);
+    HPX_TEST_LTE(val99, val999);
+
+    p50.stop(hpx::launch::sync);
+    p99.stop(hpx::launch::sync);
+    p999.stop(hpx::launch::sync);
+}
+
+int main()
+{
+    test_histogram();
+    test_counters();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,139 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Sends the same id to another locality many times with speculative credit
+// replenishment enabled and verifies that the referenced object is kept
+// alive while referenced and is released afterwards.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/plain_actions.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "components/managed_refcnt_checker.hpp"
+#include "components/simple_refcnt_checker.hpp"
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+using hpx::naming::id_type;
+using hpx::naming::detail::get_credit_from_gid;
+
+using hpx::test::managed_refcnt_monitor;
+using hpx::test::simple_refcnt_monitor;
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t receive(id_type const& id)
+{
+    return get_credit_from_gid(id.get_gid());
+}
+HPX_PLAIN_ACTION(receive)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Client>
+void hpx_test_main(variables_map& vm)
+{
+    std::uint64_t const delay = vm["delay"].as<std::uint64_t>();
+    std::size_t const count = vm["count"].as<std::size_t>();
+
+    using server_type = typename Client::server_type;
+
+    hpx::components::component_type ctype =
+        hpx::components::get_component_type<server_type>();
+    std::vector<id_type> remote_localities = hpx::find_remote_localities(ctype);
+
+    if (remote_localities.empty())
+        throw std::logic_error("this test cannot be run on one locality");
+
+    id_type const here = hpx::find_here();
+
+    Client monitor(here);
+
+    {
+        id_type id = monitor.detach().get();
+
+        // each send splits the credit of the id, without replenishment the
+        // credit would be exhausted many times over
+        std::vector<hpx::future<std::int64_t>> sent;
+        sent.reserve(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            sent.push_back(
+                hpx::async<receive_action>(remote_localities[0], id));
+        }
+
+        for (auto& f : sent)
+        {
+            HPX_TEST_LT(std::int64_t(0), f.get());
+        }
+
+        // Flush pending reference counting operations.
+        hpx::agas::garbage_collect();
+        hpx::agas::garbage_collect(remote_localities[0]);
+
+        // The component is still referenced.
+        HPX_TEST_EQ(false, monitor.is_ready(std::chrono::milliseconds(delay)));
+    }
+
+    // Flush pending reference counting operations.
+    hpx::agas::garbage_collect();
+    hpx::agas::garbage_collect(remote_localities[0]);
+    hpx::agas::garbage_collect();
+    hpx::agas::garbage_collect(remote_localities[0]);
+
+    // The component should be out of scope now.
+    HPX_TEST_EQ(true, monitor.is_ready(std::chrono::milliseconds(delay)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    hpx_test_main<simple_refcnt_monitor>(vm);
+    hpx_test_main<managed_refcnt_monitor>(vm);
+
+    hpx::finalize();
+    return hpx::util::report_errors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("delay", value<std::uint64_t>()->default_value(1000),
+         "number of milliseconds to wait for object destruction")
+        ("count", value<std::size_t>()->default_value(1000),
+         "number of times the id is sent to the other locality");
+    // clang-format on
+
+    // We need to explicitly enable the test components used by this test.
+    std::vector<std::string> const cfg = {
+        "hpx.components.simple_refcnt_checker.enabled! = 1",
+        "hpx.components.managed_refcnt_checker.enabled! = 1",
+        "hpx.agas.credit_replenish_threshold! = 24"};
+
+    // Initialize and run HPX.
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,120 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+///////////////////////////////////////////////////////////////////////////////
+std::string make_name(std::size_t i)
+{
+    return "/register_names_test/" + std::to_string(hpx::get_locality_id()) +
+        "/" + std::to_string(i);
+}
+
+void test_register_resolve_names(std::size_t count)
+{
+    std::vector<hpx::id_type> ids;
+    std::vector<std::pair<std::string, hpx::id_type>> entries;
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        hpx::id_type id = hpx::new_<test_server>(hpx::find_here()).get();
+        ids.push_back(id);
+        entries.emplace_back(make_name(i), id);
+        names.push_back(make_name(i));
+    }
+
+    // all names are registered in one go
+    std::vector<bool> registered = hpx::agas::register_names(entries).get();
+    HPX_TEST_EQ(registered.size(), count);
+    for (bool r : registered)
+    {
+        HPX_TEST(r);
+    }
+
+    // registering a different id under an existing name fails
+    std::vector<std::pair<std::string, hpx::id_type>> duplicate = {
+        std::make_pair(make_name(0), ids[1])};
+    registered = hpx::agas::register_names(duplicate).get();
+    HPX_TEST_EQ(registered.size(), std::size_t(1));
+    HPX_TEST(!registered[0]);
+
+    // the names are resolved in the order they were given
+    names.push_back(make_name(count));    // not registered
+    std::vector<hpx::id_type> resolved = hpx::agas::resolve_names(names).get();
+    HPX_TEST_EQ(resolved.size(), count + 1);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(resolved[i], ids[i]);
+    }
+    HPX_TEST(!resolved[count]);
+
+    // pattern queries see all registered names
+    std::map<std::string, hpx::id_type> symbols = hpx::agas::find_symbols(
+        hpx::launch::sync,
+        "/register_names_test/" + std::to_string(hpx::get_locality_id()) +
+            "/*");
+    HPX_TEST_EQ(symbols.size(), count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        auto it = symbols.find(make_name(i));
+        HPX_TEST(it != symbols.end());
+        if (it != symbols.end())
+        {
+            HPX_TEST_EQ(it->second, ids[i]);
+        }
+    }
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(hpx::agas::unregister_name(hpx::launch::sync, names[i]),
+            ids[i]);
+    }
+
+    symbols = hpx::agas::find_symbols(hpx::launch::sync,
+        "/register_names_test/" + std::to_string(hpx::get_locality_id()) +
+            "/*");
+    HPX_TEST(symbols.empty());
+}
+
+int hpx_main()
+{
+    test_register_resolve_names(100);
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,145 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_distributed/migration_service.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::migration_support<
+        hpx::components::component_base<test_server>>
+{
+    typedef hpx::components::migration_support<
+        hpx::components::component_base<test_server>>
+        base_type;
+
+    test_server() = default;
+
+    // Components which should be migrated using hpx::migrate<> need to
+    // be Serializable and CopyConstructable. Components can be
+    // MoveConstructable in which case the serialized data is moved into the
+    // component's constructor.
+    test_server(test_server const& rhs)
+      : base_type(rhs)
+    {
+    }
+
+    test_server(test_server&& rhs)
+      : base_type(std::move(rhs))
+    {
+    }
+
+    test_server& operator=(test_server const&)
+    {
+        return *this;
+    }
+    test_server& operator=(test_server&&)
+    {
+        return *this;
+    }
+
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action)
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void enable_migration()
+{
+    hpx::components::enable_automatic_migration<test_server>();
+}
+HPX_PLAIN_ACTION(enable_migration, enable_migration_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_automatic_migration(hpx::id_type const& there)
+{
+    hpx::id_type id = hpx::new_<test_server>(there).get();
+    HPX_TEST_EQ(call_action()(id), there);
+
+    // invoke the object from here until the service has moved it over
+    bool migrated = false;
+    for (std::size_t i = 0; !migrated && i != 100; ++i)
+    {
+        std::vector<hpx::future<hpx::id_type>> calls;
+        for (std::size_t j = 0; j != 100; ++j)
+        {
+            calls.push_back(hpx::async<call_action>(id));
+        }
+        hpx::wait_all(calls);
+
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+        migrated = call_action()(id) == hpx::find_here();
+    }
+
+    HPX_TEST(migrated);
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    std::vector<hpx::future<void>> enabled;
+    for (hpx::id_type const& id : localities)
+    {
+        enabled.push_back(
+            hpx::async<enable_migration_action>(id));
+    }
+    hpx::wait_all(enabled);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_automatic_migration(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.automatic_migration.enabled!=1",
+        "hpx.automatic_migration.interval!=50",
+        "hpx.automatic_migration.sample_rate!=1",
+        "hpx.automatic_migration.min_samples!=10"};
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
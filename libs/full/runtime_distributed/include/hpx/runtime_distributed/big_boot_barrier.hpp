@@ -60,6 +60,11 @@ namespace hpx { namespace agas {
 
         std::vector<parcelset::endpoints_type> localities;
 
+        // notifications for the registered localities, sent out along a
+        // k-ary tree once the bootstrap locality is up and running
+        std::size_t const fanout;
+        std::vector<notification_header> notifications;
+
         void spin();
 
         void notify();
@@ -87,12 +92,7 @@ namespace hpx { namespace agas {
             parcelset::endpoints_type const& endpoints_,
             util::runtime_configuration const& ini_);
 
-        ~big_boot_barrier()
-        {
-            util::unique_function_nonser<void()>* f;
-            while (thunks.pop(f))
-                delete f;
-        }
+        ~big_boot_barrier();
 
         parcelset::locality here()
         {
@@ -113,9 +113,11 @@ namespace hpx { namespace agas {
             std::uint32_t target_locality_id, parcelset::locality const& dest,
             Action act, Args&&... args);
 
-        void apply_notification(std::uint32_t source_locality_id,
-            std::uint32_t target_locality_id, parcelset::locality const& dest,
-            notification_header&& hdr);
+        // send the given notifications to the corresponding localities, each
+        // of which forwards the notifications for its own subtree
+        void apply_notifications(std::uint32_t source_locality_id,
+            std::vector<notification_header> const& children,
+            std::vector<parcelset::endpoints_type> const& endpoints_table);
 
         void wait_bootstrap();
         void wait_hosted(std::string const& locality_name,
@@ -129,6 +131,8 @@ namespace hpx { namespace agas {
 
         void add_locality_endpoints(std::uint32_t locality_id,
             parcelset::endpoints_type const& endpoints);
+
+        void add_notification(notification_header&& hdr);
     };
 
     HPX_EXPORT void create_big_boot_barrier(parcelset::parcelport* pp_,
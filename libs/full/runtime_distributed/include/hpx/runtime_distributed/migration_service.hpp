@@ -0,0 +1,67 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file migration_service.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/traits/component_supports_migration.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/migrate_component.hpp>
+
+namespace hpx { namespace components {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        using migrate_function_type = hpx::future<hpx::id_type> (*)(
+            hpx::id_type const&, hpx::id_type const&);
+
+        HPX_EXPORT void register_automatic_migration(
+            component_type type, migrate_function_type f);
+
+        // start/stop the automatic migration service on this locality, the
+        // service is started during startup if hpx.automatic_migration.enabled
+        // is set
+        HPX_EXPORT void start_migration_service();
+        HPX_EXPORT void stop_migration_service();
+    }    // namespace detail
+    /// \endcond
+
+    /// Allow the automatic migration service to migrate instances of the
+    /// given component type.
+    ///
+    /// If enabled (see \a hpx.automatic_migration.enabled), the automatic
+    /// migration service samples the invocations of all components supporting
+    /// migration and periodically migrates the components which are mostly
+    /// invoked from one other locality to that locality. Only instances of
+    /// component types for which this function was called on the locality
+    /// the instance currently lives on are considered.
+    ///
+    /// \tparam  Component     Specifies the component type to enable
+    ///                        automatic migration for. This type has to
+    ///                        support migration.
+    ///
+    /// \note This function has to be called on each locality after the
+    ///       runtime system has been started, e.g. from hpx_main.
+    ///
+    template <typename Component>
+    void enable_automatic_migration()
+    {
+        static_assert(traits::component_supports_migration<Component>::call(),
+            "automatic migration requires a component supporting migration");
+
+        detail::register_automatic_migration(get_component_type<Component>(),
+            [](hpx::id_type const& to_migrate, hpx::id_type const& target) {
+                return migrate<Component>(to_migrate, target);
+            });
+    }
+}}    // namespace hpx::components
+#endif
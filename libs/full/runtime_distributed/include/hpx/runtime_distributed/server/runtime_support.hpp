@@ -291,6 +291,8 @@ namespace hpx { namespace components { namespace server {
             naming::resolver_client& agas_client, bool isdefault,
             bool isenabled, hpx::program_options::options_description& options,
             std::set<std::string>& startup_handled);
+        void load_component_registries(
+            hpx::util::plugin::dll& d, error_code& ec);
 
         bool load_startup_shutdown_functions(
             hpx::util::plugin::dll& d, error_code& ec);
@@ -36,6 +36,7 @@
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/from_string.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -353,7 +354,10 @@ namespace hpx { namespace agas {
     };
 
     // This structure is used in the response from node zero to the locality which
-    // is trying to register (first roundtrip).
+    // is trying to register (first roundtrip). The notifications are sent along
+    // a k-ary tree: each locality forwards the notifications for the localities
+    // in its subtree (children) to its direct children. Only the headers sent
+    // over the wire carry the table of all locality endpoints.
     struct notification_header
     {
         notification_header()
@@ -395,6 +399,7 @@ namespace hpx { namespace agas {
         parcelset::endpoints_type agas_endpoints;
         detail::assigned_id_sequence ids;
         std::vector<parcelset::endpoints_type> endpoints;
+        std::vector<notification_header> children;
 
         template <typename Archive>
         void serialize(Archive& ar, const unsigned int)
@@ -411,6 +416,7 @@ namespace hpx { namespace agas {
             ar & agas_endpoints;
             ar & ids;
             ar & endpoints;
+            ar & children;
             // clang-format on
         }
     };
@@ -445,6 +451,52 @@ HPX_REGISTER_ACTION_ID(notify_worker_action, notify_worker_action,
 
 namespace hpx { namespace agas {
 
+    namespace detail {
+
+        // find the endpoint of the given locality which is reachable through
+        // the bootstrap parcelport
+        parcelset::locality get_bootstrap_destination(
+            parcelset::endpoints_type const& endpoints,
+            parcelset::locality const& here)
+        {
+            for (parcelset::endpoints_type::value_type const& loc : endpoints)
+            {
+                if (loc.second.type() == here.type())
+                {
+                    return loc.second;
+                }
+            }
+            return parcelset::locality();
+        }
+
+        // Arrange the given notifications in a k-ary tree rooted at the
+        // bootstrap locality (node zero), the notification for node i is
+        // stored at index i - 1. Returns the direct children of the given
+        // node, each of which holds its own subtree.
+        std::vector<notification_header> make_notification_tree(
+            std::vector<notification_header>& nodes, std::size_t node,
+            std::size_t fanout)
+        {
+            std::vector<notification_header> children;
+
+            std::size_t const first = fanout * node + 1;
+            std::size_t const last =
+                (std::min)(first + fanout, nodes.size() + 1);
+            if (first < last)
+            {
+                children.reserve(last - first);
+            }
+
+            for (std::size_t i = first; i < last; ++i)
+            {
+                notification_header& hdr = nodes[i - 1];
+                hdr.children = make_notification_tree(nodes, i, fanout);
+                children.push_back(HPX_MOVE(hdr));
+            }
+            return children;
+        }
+    }    // namespace detail
+
     // remote call to AGAS
     void register_worker(registration_header const& header)
     {
@@ -513,18 +565,6 @@ namespace hpx { namespace agas {
             component_addr, symbol_addr, rt.get_config().get_num_localities(),
             first_core, bbb.get_endpoints(), assigned_ids);
 
-        parcelset::locality dest;
-        parcelset::locality here = bbb.here();
-        for (parcelset::endpoints_type::value_type const& loc :
-            header.endpoints)
-        {
-            if (loc.second.type() == here.type())
-            {
-                dest = loc.second;
-                break;
-            }
-        }
-
         // collect endpoints from all registering localities
         bbb.add_locality_endpoints(
             naming::get_locality_id_from_gid(prefix), header.endpoints);
@@ -535,6 +575,8 @@ namespace hpx { namespace agas {
         {
             // We can just send the parcel now, the connecting locality isn't a part
             // of startup synchronization.
+            parcelset::locality dest = detail::get_bootstrap_destination(
+                header.endpoints, bbb.here());
             get_big_boot_barrier().apply_late(0,
                 naming::get_locality_id_from_gid(prefix), dest,
                 notify_worker_action(), HPX_MOVE(hdr));
@@ -546,13 +588,7 @@ namespace hpx { namespace agas {
             // synchronization.
 
             // delay the final response until the runtime system is up and running
-            util::unique_function_nonser<void()>* thunk =
-                new util::unique_function_nonser<void()>(util::one_shot(
-                    util::bind_front(&big_boot_barrier::apply_notification,
-                        &get_big_boot_barrier(), 0,
-                        naming::get_locality_id_from_gid(prefix), dest,
-                        HPX_MOVE(hdr))));
-            get_big_boot_barrier().add_thunk(thunk);
+            bbb.add_notification(HPX_MOVE(hdr));
         }
     }
 
@@ -579,6 +615,14 @@ namespace hpx { namespace agas {
 
         // set our prefix
         agas_client.set_local_locality(header.prefix);
+
+        // forward the notifications to our children in the bootstrap tree
+        // before doing anything else, this keeps the overall startup latency
+        // logarithmic in the number of localities
+        get_big_boot_barrier().apply_notifications(
+            naming::get_locality_id_from_gid(header.prefix), header.children,
+            header.endpoints);
+
         agas_client.register_console(header.agas_endpoints);
         cfg.parse("assigned locality",
             hpx::util::format("hpx.locality!={1}",
@@ -618,13 +662,31 @@ namespace hpx { namespace agas {
     }
     // }}}
 
-    void big_boot_barrier::apply_notification(std::uint32_t source_locality_id,
-        std::uint32_t target_locality_id, parcelset::locality const& dest,
-        notification_header&& hdr)
+    void big_boot_barrier::apply_notifications(
+        std::uint32_t source_locality_id,
+        std::vector<notification_header> const& children,
+        std::vector<parcelset::endpoints_type> const& endpoints_table)
     {
-        hdr.endpoints = localities;
-        apply(source_locality_id, target_locality_id, dest,
-            notify_worker_action(), HPX_MOVE(hdr));
+        for (notification_header const& child : children)
+        {
+            std::uint32_t const target_locality_id =
+                naming::get_locality_id_from_gid(child.prefix);
+
+            HPX_ASSERT(target_locality_id < endpoints_table.size());
+            parcelset::locality dest = detail::get_bootstrap_destination(
+                endpoints_table[target_locality_id], bootstrap_agas);
+
+            notification_header hdr(child);
+            hdr.endpoints = endpoints_table;
+            apply(source_locality_id, target_locality_id, dest,
+                notify_worker_action(), HPX_MOVE(hdr));
+        }
+    }
+
+    void big_boot_barrier::add_notification(notification_header&& hdr)
+    {
+        // the bbb mutex is held by the caller (see register_worker)
+        notifications.push_back(HPX_MOVE(hdr));
     }
 
     void big_boot_barrier::add_locality_endpoints(std::uint32_t locality_id,
@@ -679,6 +741,7 @@ namespace hpx { namespace agas {
       , mtx()
       , connected(get_number_of_bootstrap_connections(ini_))
       , thunks(32)
+      , fanout(ini_.get_agas_bootstrap_fanout())
     {
         // register all not registered typenames
         if (service_type == service_mode_bootstrap)
@@ -689,6 +752,13 @@ namespace hpx { namespace agas {
         }
     }
 
+    big_boot_barrier::~big_boot_barrier()
+    {
+        util::unique_function_nonser<void()>* f;
+        while (thunks.pop(f))
+            delete f;
+    }
+
     void big_boot_barrier::wait_bootstrap()
     {    // {{{
         HPX_ASSERT(service_mode_bootstrap == service_type);
@@ -802,6 +872,30 @@ namespace hpx { namespace agas {
                 }
                 delete p;
             }
+
+            // Send the notifications to the registered localities. Instead of
+            // sending the (growing) table of all endpoints to every locality
+            // from here, we send it only to our direct children in a k-ary
+            // tree, which in turn forward it to their children.
+            std::vector<notification_header> nodes;
+            {
+                std::lock_guard<std::mutex> l(mtx);
+                std::swap(nodes, notifications);
+            }
+
+            if (!nodes.empty())
+            {
+                std::sort(nodes.begin(), nodes.end(),
+                    [](notification_header const& lhs,
+                        notification_header const& rhs) {
+                        return naming::get_locality_id_from_gid(lhs.prefix) <
+                            naming::get_locality_id_from_gid(rhs.prefix);
+                    });
+
+                std::size_t const k = fanout != 0 ? fanout : nodes.size();
+                apply_notifications(0,
+                    detail::make_notification_tree(nodes, 0, k), localities);
+            }
         }
     }
 
@@ -0,0 +1,334 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/detail/invocation_sampling.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_distributed/migration_service.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/runtime_local/runtime_local.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/util/get_entry_as.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components { namespace detail {
+
+    namespace {
+
+        // The sampled invocations of one component instance during the
+        // current evaluation interval.
+        struct invocation_data
+        {
+            naming::gid_type gid;
+            component_type type = component_invalid;
+
+            // all sampled invocations, local and remote
+            std::uint64_t count = 0;
+
+            // sampled invocations per source locality
+            std::map<std::uint32_t, std::uint64_t> remote_counts;
+        };
+
+        struct migration_candidate
+        {
+            naming::gid_type gid;
+            component_type type;
+            std::uint32_t target;
+            std::uint64_t samples;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class migration_service
+        {
+        public:
+            using mutex_type = hpx::lcos::local::spinlock;
+
+            static migration_service& instance()
+            {
+                static migration_service service;
+                return service;
+            }
+
+            void register_type(component_type type, migrate_function_type f)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                migrate_functions_[type] = f;
+            }
+
+            void start();
+            void stop();
+
+            void record(naming::gid_type const& gid);
+            void record_remote(naming::gid_type const& gid,
+                component_type type, std::uint32_t source);
+
+        private:
+            bool evaluate();
+            void migrate(migration_candidate const& c);
+
+            // Every sample_rate_'th invocation is recorded, the counters are
+            // kept per OS-thread to avoid contention.
+            bool sample(std::uint64_t& count) const noexcept
+            {
+                return ++count % sample_rate_ == 0;
+            }
+
+            mutex_type mtx_;
+            std::unordered_map<naming::gid_type, invocation_data> data_;
+            std::unordered_map<component_type, migrate_function_type>
+                migrate_functions_;
+
+            std::uint64_t sample_rate_ = 16;
+            std::uint64_t min_samples_ = 64;
+            double dominance_ = 0.5;
+            std::size_t max_batch_ = 16;
+
+            std::atomic<std::size_t> in_flight_{0};
+            std::unique_ptr<hpx::util::interval_timer> timer_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        void record_invocation_hook(naming::gid_type const& gid)
+        {
+            migration_service::instance().record(gid);
+        }
+
+        void record_remote_invocation_hook(naming::gid_type const& gid,
+            component_type type, std::uint32_t source)
+        {
+            migration_service::instance().record_remote(gid, type, source);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void migration_service::start()
+        {
+            util::runtime_configuration const& cfg = get_runtime().get_config();
+
+            sample_rate_ = (std::max)(std::uint64_t(1),
+                util::get_entry_as<std::uint64_t>(
+                    cfg, "hpx.automatic_migration.sample_rate", 16));
+            min_samples_ = util::get_entry_as<std::uint64_t>(
+                cfg, "hpx.automatic_migration.min_samples", 64);
+            dominance_ = util::get_entry_as<double>(
+                cfg, "hpx.automatic_migration.dominance", 0.5);
+            max_batch_ = util::get_entry_as<std::size_t>(
+                cfg, "hpx.automatic_migration.max_batch", 16);
+
+            std::int64_t const interval = util::get_entry_as<std::int64_t>(
+                cfg, "hpx.automatic_migration.interval", 1000);
+
+            record_invocation.store(
+                &record_invocation_hook, std::memory_order_release);
+            record_remote_invocation.store(
+                &record_remote_invocation_hook, std::memory_order_release);
+
+            // the timer is terminated during pre-shutdown, at which point
+            // sampling is stopped as well
+            timer_ = std::make_unique<hpx::util::interval_timer>(
+                [this]() { return evaluate(); },
+                []() {
+                    record_invocation.store(nullptr, std::memory_order_release);
+                    record_remote_invocation.store(
+                        nullptr, std::memory_order_release);
+                },
+                interval * 1000, "automatic_migration", true);
+            timer_->start(false);
+        }
+
+        void migration_service::stop()
+        {
+            record_invocation.store(nullptr, std::memory_order_release);
+            record_remote_invocation.store(nullptr, std::memory_order_release);
+
+            if (timer_)
+            {
+                timer_->stop(true);
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+            data_.clear();
+        }
+
+        void migration_service::record(naming::gid_type const& gid)
+        {
+            static thread_local std::uint64_t count = 0;
+            if (!gid || !sample(count))
+            {
+                return;
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+            ++data_[gid].count;
+        }
+
+        void migration_service::record_remote(naming::gid_type const& gid,
+            component_type type, std::uint32_t source)
+        {
+            static thread_local std::uint64_t count = 0;
+            if (source == naming::invalid_locality_id || !sample(count))
+            {
+                return;
+            }
+
+            std::lock_guard<mutex_type> l(mtx_);
+            invocation_data& data = data_[gid];
+            if (data.type == component_invalid)
+            {
+                data.gid =
+                    naming::detail::get_stripped_gid_except_dont_cache(gid);
+                data.type = type;
+            }
+            ++data.remote_counts[source];
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool migration_service::evaluate()
+        {
+            // don't start a new batch before all migrations issued by the
+            // previous one have finished
+            if (in_flight_.load(std::memory_order_acquire) != 0)
+            {
+                return true;
+            }
+
+            std::unordered_map<naming::gid_type, invocation_data> data;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                std::swap(data, data_);
+            }
+
+            std::uint32_t const here = agas::get_locality_id();
+
+            std::vector<migration_candidate> candidates;
+            for (auto const& e : data)
+            {
+                invocation_data const& d = e.second;
+                if (d.type == component_invalid)
+                {
+                    continue;    // never invoked remotely
+                }
+
+                std::uint64_t remote = 0;
+                auto dominant = d.remote_counts.end();
+                for (auto it = d.remote_counts.begin();
+                     it != d.remote_counts.end(); ++it)
+                {
+                    remote += it->second;
+                    if (dominant == d.remote_counts.end() ||
+                        it->second > dominant->second)
+                    {
+                        dominant = it;
+                    }
+                }
+
+                // the object is moved only if most of its invocations
+                // originate from one other locality, this also prevents
+                // objects from bouncing between localities
+                std::uint64_t const total = (std::max)(d.count, remote);
+                if (dominant == d.remote_counts.end() ||
+                    dominant->first == here ||
+                    dominant->second < min_samples_ ||
+                    double(dominant->second) <= dominance_ * double(total))
+                {
+                    continue;
+                }
+
+                candidates.push_back(
+                    {d.gid, d.type, dominant->first, dominant->second});
+            }
+
+            // migrate the hottest objects first, throttled to max_batch_
+            // migrations per interval
+            std::sort(candidates.begin(), candidates.end(),
+                [](migration_candidate const& lhs,
+                    migration_candidate const& rhs) {
+                    return lhs.samples > rhs.samples;
+                });
+            if (candidates.size() > max_batch_)
+            {
+                candidates.resize(max_batch_);
+            }
+
+            for (migration_candidate const& c : candidates)
+            {
+                migrate(c);
+            }
+
+            return true;
+        }
+
+        void migration_service::migrate(migration_candidate const& c)
+        {
+            migrate_function_type f = nullptr;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                auto it = migrate_functions_.find(c.type);
+                if (it == migrate_functions_.end())
+                {
+                    return;    // automatic migration not enabled for type
+                }
+                f = it->second;
+            }
+
+            naming::gid_type gid = c.gid;
+            naming::detail::set_is_migratable(gid);
+            naming::detail::set_dont_store_in_cache(gid);
+
+            hpx::id_type to_migrate(gid, hpx::id_type::unmanaged);
+            hpx::id_type target = naming::get_id_from_locality_id(c.target);
+
+            LRT_(info).format(
+                "automatic_migration: migrating {} to locality#{} "
+                "({} sampled remote invocations)",
+                gid, c.target, c.samples);
+
+            in_flight_.fetch_add(1, std::memory_order_acq_rel);
+            f(to_migrate, target).then(hpx::launch::sync,
+                [this, gid](hpx::future<hpx::id_type>&& r) {
+                    // the object might have been destroyed or migrated in
+                    // the meantime
+                    if (r.has_exception())
+                    {
+                        LRT_(warning).format(
+                            "automatic_migration: migrating {} failed", gid);
+                    }
+                    in_flight_.fetch_sub(1, std::memory_order_acq_rel);
+                });
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_automatic_migration(
+        component_type type, migrate_function_type f)
+    {
+        migration_service::instance().register_type(type, f);
+    }
+
+    void start_migration_service()
+    {
+        migration_service::instance().start();
+    }
+
+    void stop_migration_service()
+    {
+        migration_service::instance().stop();
+    }
+}}}    // namespace hpx::components::detail
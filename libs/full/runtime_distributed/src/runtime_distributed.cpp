@@ -40,6 +40,7 @@
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_components/server/console_error_sink.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_configuration/startup_profile.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/applier.hpp>
 #include <hpx/runtime_distributed/big_boot_barrier.hpp>
@@ -272,6 +273,7 @@ namespace hpx {
                     std::terminate();
                 });
 
+            util::startup_phase_completed("runtime creation");
             agas::get_big_boot_barrier().wait_bootstrap();
         }
         else
@@ -290,12 +292,15 @@ namespace hpx {
                     std::terminate();
                 });
 
+            util::startup_phase_completed("runtime creation");
             agas::get_big_boot_barrier().wait_hosted(
                 pp ? pp->get_locality_name() : "<console>",
                 agas_client_.get_primary_ns_lva(),
                 agas_client_.get_symbol_ns_lva());
         }
 
+        util::startup_phase_completed("AGAS bootstrap");
+
         agas_client_.initialize(std::uint64_t(runtime_support_.get()));
         parcel_handler_.initialize();
 #else
@@ -1037,6 +1042,46 @@ namespace hpx {
                 &performance_counters::detail::statistics_counter_creator,
                 &performance_counters::default_counter_discoverer, ""},
 
+            // p50 counter
+            {"/statistics/p50", performance_counters::counter_aggregating,
+                "returns the median (50th percentile) value of its base "
+                "counter over an arbitrary time line as recorded in a "
+                "log-linear histogram; pass required base counter as the "
+                "instance name: /statistics{<base_counter_name>}/p50",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::statistics_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
+            // p90 counter
+            {"/statistics/p90", performance_counters::counter_aggregating,
+                "returns the 90th percentile value of its base counter over "
+                "an arbitrary time line as recorded in a log-linear "
+                "histogram; pass required base counter as the instance "
+                "name: /statistics{<base_counter_name>}/p90",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::statistics_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
+            // p99 counter
+            {"/statistics/p99", performance_counters::counter_aggregating,
+                "returns the 99th percentile value of its base counter over "
+                "an arbitrary time line as recorded in a log-linear "
+                "histogram; pass required base counter as the instance "
+                "name: /statistics{<base_counter_name>}/p99",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::statistics_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
+            // p999 counter
+            {"/statistics/p999", performance_counters::counter_aggregating,
+                "returns the 99.9th percentile value of its base counter over "
+                "an arbitrary time line as recorded in a log-linear "
+                "histogram; pass required base counter as the instance "
+                "name: /statistics{<base_counter_name>}/p999",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::statistics_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
             // uptime counters
             {
                 "/runtime/uptime", performance_counters::counter_elapsed_time,
@@ -34,6 +34,7 @@
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_configuration/component_commandline_base.hpp>
 #include <hpx/runtime_configuration/component_factory_base.hpp>
+#include <hpx/runtime_configuration/component_registry_base.hpp>
 #include <hpx/runtime_configuration/static_factory_data.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/find_localities.hpp>
@@ -1476,6 +1477,16 @@ namespace hpx { namespace components { namespace server {
                 startup_handled);
         }
 
+        // modules not loaded during module discovery (see hpx.module_cache)
+        // are loaded only once one of their components is needed
+        if (!isenabled)
+        {
+            LRT_(info).format("deferring load of module for disabled "
+                              "component: {}: {}",
+                lib.string(), instance);
+            return false;
+        }
+
         // first, try using the path as the full path to the library
         error_code ec(lightweight);
         hpx::util::plugin::dll d(lib.string(), HPX_MANGLE_STRING(component));
@@ -1501,10 +1512,46 @@ namespace hpx { namespace components { namespace server {
             return false;    // next please :-P
         }
 
+        // the component types of this module have not been registered yet
+        ec = error_code(lightweight);
+        load_component_registries(d, ec);
+        if (ec)
+        {
+            LRT_(warning).format(
+                "loading of component registries failed: {}: {}: {}",
+                lib.string(), instance, get_error_what(ec));
+        }
+
         modules_.insert(std::make_pair(HPX_MANGLE_STRING(component), d));
         return true;
     }
 
+    void runtime_support::load_component_registries(
+        hpx::util::plugin::dll& d, error_code& ec)
+    {
+        hpx::util::plugin::plugin_factory<component_registry_base> pf(
+            d, "registry");
+
+        // retrieve the names of all known registries
+        std::vector<std::string> names;
+        pf.get_names(names, ec);
+        if (ec)
+            return;
+
+        for (std::string const& s : names)
+        {
+            std::shared_ptr<component_registry_base> registry(
+                pf.create(s, ec));
+            if (ec)
+                return;
+
+            // register the component types the same way as for the modules
+            // loaded during module discovery
+            startup_functions_.push_back(
+                [registry]() { registry->register_component_type(); });
+        }
+    }
+
     bool runtime_support::load_startup_shutdown_functions(
         hpx::util::plugin::dll& d, error_code& ec)
     {
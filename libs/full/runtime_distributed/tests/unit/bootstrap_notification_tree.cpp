@@ -0,0 +1,81 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The bootstrap locality notifies the other localities along a tree whose
+// fan-out is given by hpx.agas.bootstrap_fanout, all other localities forward
+// the notifications to their children. Verify that every locality has
+// received the endpoints of all other localities.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint32_t locality_id()
+{
+    return hpx::get_locality_id();
+}
+HPX_PLAIN_ACTION(locality_id, locality_id_action)
+
+// Invoked on every locality, returns the locality ids reported back by all
+// localities known to the invoking locality.
+std::vector<std::uint32_t> ping_all_localities()
+{
+    std::vector<hpx::future<std::uint32_t>> futures;
+    for (hpx::id_type const& id : hpx::find_all_localities())
+    {
+        futures.push_back(hpx::async(locality_id_action(), id));
+    }
+
+    std::vector<std::uint32_t> ids;
+    for (hpx::future<std::uint32_t>& f : futures)
+    {
+        ids.push_back(f.get());
+    }
+    return ids;
+}
+HPX_PLAIN_ACTION(ping_all_localities, ping_all_localities_action)
+
+std::string get_bootstrap_fanout()
+{
+    return hpx::get_config_entry("hpx.agas.bootstrap_fanout", "");
+}
+HPX_PLAIN_ACTION(get_bootstrap_fanout, get_bootstrap_fanout_action)
+
+int main()
+{
+    std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+    HPX_TEST_EQ(localities.size(), std::size_t(hpx::get_num_localities(
+                                       hpx::launch::sync)));
+
+    std::vector<std::uint32_t> expected;
+    for (hpx::id_type const& id : localities)
+    {
+        expected.push_back(hpx::naming::get_locality_id_from_id(id));
+    }
+
+    std::string const fanout = get_bootstrap_fanout();
+    for (hpx::id_type const& id : localities)
+    {
+        // all localities have to run with the same configuration
+        HPX_TEST_EQ(get_bootstrap_fanout_action()(id), fanout);
+
+        // every locality can reach all other localities
+        HPX_TEST(ping_all_localities_action()(id) == expected);
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
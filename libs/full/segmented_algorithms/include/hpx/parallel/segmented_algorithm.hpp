@@ -20,8 +20,12 @@
 #include <hpx/parallel/segmented_algorithms/generate.hpp>
 #include <hpx/parallel/segmented_algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/segmented_algorithms/minmax.hpp>
+#include <hpx/parallel/segmented_algorithms/partition.hpp>
 #include <hpx/parallel/segmented_algorithms/reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/remove.hpp>
+#include <hpx/parallel/segmented_algorithms/sort.hpp>
 #include <hpx/parallel/segmented_algorithms/transform.hpp>
 #include <hpx/parallel/segmented_algorithms/transform_exclusive_scan.hpp>
 #include <hpx/parallel/segmented_algorithms/transform_inclusive_scan.hpp>
 #include <hpx/parallel/segmented_algorithms/transform_reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/unique.hpp>
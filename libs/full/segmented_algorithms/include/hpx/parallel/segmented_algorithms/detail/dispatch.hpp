@@ -221,10 +221,71 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The local algorithms are invoked on plain pointers if all of the local
+    // iterators refer to contiguous data and if the result of the algorithm
+    // does not have to be mapped back to local iterators. This exposes the
+    // local data to the vectorized implementations of the algorithms.
+    template <typename Result, typename Enable = void>
+    struct has_local_iterator_result
+      : hpx::traits::is_segmented_local_iterator<Result>
+    {
+    };
+
+    template <>
+    struct has_local_iterator_result<void> : std::false_type
+    {
+    };
+
+    template <typename Iterator1, typename Iterator2>
+    struct has_local_iterator_result<util::in_out_result<Iterator1, Iterator2>>
+      : std::true_type
+    {
+    };
+
+    template <typename Iterator>
+    struct has_local_iterator_result<util::min_max_result<Iterator>>
+      : std::true_type
+    {
+    };
+
+    template <typename Iterator1, typename Iterator2, typename Iterator3>
+    struct has_local_iterator_result<
+        util::in_in_out_result<Iterator1, Iterator2, Iterator3>>
+      : std::true_type
+    {
+    };
+
+    template <typename Result, typename... Args>
+    inline constexpr bool use_local_pointers_v =
+        !has_local_iterator_result<Result>::value &&
+        (hpx::traits::is_segmented_local_iterator_v<Args> || ...) &&
+        ((!hpx::traits::is_segmented_local_iterator_v<Args> ||
+             hpx::traits::is_segmented_local_contiguous_v<Args>) &&
+            ...);
+
+    template <typename Arg>
+    HPX_FORCEINLINE decltype(auto) segmented_local_pointer(Arg&& arg)
+    {
+        using arg_type = std::decay_t<Arg>;
+        if constexpr (hpx::traits::is_segmented_local_iterator_v<arg_type>)
+        {
+            return hpx::traits::segmented_local_pointer_traits<
+                arg_type>::local(HPX_FORWARD(Arg, arg));
+        }
+        else
+        {
+            return HPX_FORWARD(Arg, arg);
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Algo, typename ExPolicy, typename... Args>
     struct dispatcher
     {
+        static constexpr bool use_local_pointers = use_local_pointers_v<
+            typename std::decay_t<Algo>::result_type, Args...>;
+
         using result_type = parallel::util::detail::algorithm_result_t<ExPolicy,
             typename std::decay_t<Algo>::result_type>;
 
@@ -232,7 +293,13 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             Algo const& algo, ExPolicy policy, Args... args)
         {
             using hpx::traits::segmented_local_iterator_traits;
-            if constexpr (std::is_void_v<result_type>)
+            if constexpr (use_local_pointers)
+            {
+                return algo.call2(HPX_FORWARD(ExPolicy, policy),
+                    std::true_type(),
+                    segmented_local_pointer(HPX_FORWARD(Args, args))...);
+            }
+            else if constexpr (std::is_void_v<result_type>)
             {
                 return algo.call2(HPX_FORWARD(ExPolicy, policy),
                     std::true_type(),
@@ -253,7 +320,13 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             Algo const& algo, ExPolicy policy, Args... args)
         {
             using hpx::traits::segmented_local_iterator_traits;
-            if constexpr (std::is_void_v<result_type>)
+            if constexpr (use_local_pointers)
+            {
+                return algo.call2(HPX_FORWARD(ExPolicy, policy),
+                    std::false_type(),
+                    segmented_local_pointer(HPX_FORWARD(Args, args))...);
+            }
+            else if constexpr (std::is_void_v<result_type>)
             {
                 return algo.call2(HPX_FORWARD(ExPolicy, policy),
                     std::false_type(),
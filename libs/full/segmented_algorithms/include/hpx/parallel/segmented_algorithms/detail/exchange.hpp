@@ -0,0 +1,276 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/segmented_algorithms/detail/exchange.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // Segmented algorithms which move elements between segments (sort,
+    // remove_if, unique, partition) run one task per segment. These tasks
+    // take part in collective operations as separate sites: site 'k' is
+    // responsible for the k-th (non-empty) segment of the input range.
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // generate a unique base name for the communicator connecting the
+        // sites of one invocation of a segmented algorithm
+        inline std::string make_segmented_basename(char const* algorithm)
+        {
+            static std::atomic<std::size_t> count(0);
+            return hpx::util::format("/hpx/segmented_algorithms/{}/{}/{}",
+                algorithm, agas::get_locality_id(), ++count);
+        }
+
+        inline std::vector<std::size_t> exclusive_offsets(
+            std::vector<std::size_t> const& counts, std::size_t init = 0)
+        {
+            std::vector<std::size_t> offsets;
+            offsets.reserve(counts.size());
+            for (std::size_t count : counts)
+            {
+                offsets.push_back(init);
+                init += count;
+            }
+            return offsets;
+        }
+
+        // Gather the given per-site counters from all sites, returns one
+        // vector of values per counter.
+        inline std::vector<std::vector<std::size_t>> gather_counts(
+            collectives::communicator const& comm, std::size_t this_site,
+            std::vector<std::size_t>&& local_counts)
+        {
+            std::size_t const num_counts = local_counts.size();
+
+            std::vector<std::vector<std::size_t>> all_counts =
+                collectives::all_gather(comm, HPX_MOVE(local_counts),
+                    collectives::this_site_arg(this_site))
+                    .get();
+
+            std::vector<std::vector<std::size_t>> result(num_counts);
+            for (std::size_t i = 0; i != num_counts; ++i)
+            {
+                result[i].reserve(all_counts.size());
+                for (auto const& counts : all_counts)
+                {
+                    result[i].push_back(counts[i]);
+                }
+            }
+            return result;
+        }
+
+        // Move the elements in 'data' to the sites owning their destination.
+        // The elements of site 'k' are destined for the global positions
+        // [offsets[k], offsets[k] + counts[k]), site 'k' owns the global
+        // positions [sum(sizes[0..k)), sum(sizes[0..k]). The received
+        // elements are stored in the local range starting at 'dest'.
+        template <typename T, typename LocalIter>
+        void exchange_elements(collectives::communicator const& comm,
+            std::size_t this_site, std::vector<T>&& data,
+            std::vector<std::size_t> const& offsets,
+            std::vector<std::size_t> const& counts,
+            std::vector<std::size_t> const& sizes, LocalIter dest)
+        {
+            std::size_t const num_sites = sizes.size();
+            std::vector<std::size_t> const starts = exclusive_offsets(sizes);
+
+            HPX_ASSERT(data.size() == counts[this_site]);
+            HPX_UNUSED(counts);
+
+            // slice the local data by destination site
+            std::size_t const offset = offsets[this_site];
+            std::vector<std::vector<T>> pieces(num_sites);
+            for (std::size_t j = 0; j != num_sites; ++j)
+            {
+                std::size_t const lo = (std::max)(offset, starts[j]);
+                std::size_t const hi =
+                    (std::min)(offset + data.size(), starts[j] + sizes[j]);
+                if (lo < hi)
+                {
+                    pieces[j].assign(
+                        std::make_move_iterator(data.begin() + (lo - offset)),
+                        std::make_move_iterator(data.begin() + (hi - offset)));
+                }
+            }
+            data.clear();
+
+            std::vector<std::vector<T>> received =
+                collectives::all_to_all(comm, HPX_MOVE(pieces),
+                    collectives::this_site_arg(this_site))
+                    .get();
+
+            std::size_t const start = starts[this_site];
+            for (std::size_t k = 0; k != num_sites; ++k)
+            {
+                std::vector<T>& piece = received[k];
+                if (!piece.empty())
+                {
+                    std::size_t const pos = (std::max)(offsets[k], start);
+                    std::move(piece.begin(), piece.end(),
+                        std::next(dest, pos - start));
+                }
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke the given algorithm concurrently on all segments of the
+        // range [first, last). The algorithm is called with the local range,
+        // the base name of the communicator, the number of sites, the index
+        // of the site, and the additional arguments.
+        template <typename Algo, typename SegIter, typename IsSeq,
+            typename... Args>
+        std::vector<future<typename std::decay_t<Algo>::result_type>>
+        segmented_collective_dispatch(Algo&& algo, char const* name,
+            SegIter first, SegIter last, IsSeq, Args const&... args)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using segment_iterator = typename traits::segment_iterator;
+            using local_iterator_type = typename traits::local_iterator;
+
+            // all sites have to run concurrently as they wait for each other
+            // during the collective operations, only the local operations
+            // are executed sequentially if requested
+            using policy_type = std::conditional_t<IsSeq::value,
+                hpx::execution::sequenced_policy,
+                hpx::execution::parallel_policy>;
+
+            using site_type = hpx::tuple<hpx::id_type, local_iterator_type,
+                local_iterator_type>;
+
+            segment_iterator sit = traits::segment(first);
+            segment_iterator send = traits::segment(last);
+
+            std::vector<site_type> sites;
+            if (sit == send)
+            {
+                // all elements are on the same partition
+                sites.emplace_back(traits::get_id(sit), traits::local(first),
+                    traits::local(last));
+            }
+            else
+            {
+                // handle the remaining part of the first partition
+                local_iterator_type beg = traits::local(first);
+                local_iterator_type end = traits::end(sit);
+                if (beg != end)
+                {
+                    sites.emplace_back(traits::get_id(sit), beg, end);
+                }
+
+                // handle all of the full partitions
+                for (++sit; sit != send; ++sit)
+                {
+                    beg = traits::begin(sit);
+                    end = traits::end(sit);
+                    if (beg != end)
+                    {
+                        sites.emplace_back(traits::get_id(sit), beg, end);
+                    }
+                }
+
+                // handle the beginning of the last partition
+                beg = traits::begin(sit);
+                end = traits::local(last);
+                if (beg != end)
+                {
+                    sites.emplace_back(traits::get_id(sit), beg, end);
+                }
+            }
+
+            std::string const basename = make_segmented_basename(name);
+            std::size_t const num_sites = sites.size();
+
+            std::vector<future<typename std::decay_t<Algo>::result_type>>
+                results;
+            results.reserve(num_sites);
+
+            for (std::size_t k = 0; k != num_sites; ++k)
+            {
+                results.push_back(dispatch_async(hpx::get<0>(sites[k]), algo,
+                    policy_type(), std::integral_constant<bool, false>(),
+                    hpx::get<1>(sites[k]), hpx::get<2>(sites[k]), basename,
+                    num_sites, k, args...));
+            }
+            return results;
+        }
+
+        // returns an iterator referring to the element at the position
+        // reported by the sites
+        template <typename SegIter>
+        struct advance_segmented
+        {
+            SegIter first_;
+
+            template <typename Results>
+            SegIter operator()(Results&& results) const
+            {
+                SegIter it = first_;
+                std::advance(it, results.front().get());
+                return it;
+            }
+        };
+
+        // Combine the results of all sites, any remote exceptions are
+        // rethrown.
+        template <typename ExPolicy, typename Result, typename F>
+        typename util::detail::algorithm_result<ExPolicy,
+            std::invoke_result_t<F, std::vector<future<Result>>&&>>::type
+        segmented_collective_result(
+            std::vector<future<Result>>&& results, F&& f)
+        {
+            using result_type =
+                std::invoke_result_t<F, std::vector<future<Result>>&&>;
+            using result =
+                util::detail::algorithm_result<ExPolicy, result_type>;
+
+            return result::get(dataflow(
+                [f = HPX_FORWARD(F, f)](std::vector<future<Result>>&& r) mutable
+                -> result_type {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+                    return f(HPX_MOVE(r));
+                },
+                HPX_MOVE(results)));
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
@@ -76,12 +76,10 @@ namespace hpx { namespace segmented {
             return HPX_MOVE(first);
         }
 
-        using iterator_traits = hpx::traits::segmented_iterator_traits<SegIter>;
         using value_type = typename std::iterator_traits<SegIter>::value_type;
 
         return hpx::parallel::v1::detail::segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
-                typename iterator_traits::local_iterator>(),
+            hpx::parallel::v1::detail::seg_for_each(),
             hpx::execution::seq, first, last,
             hpx::parallel::v1::detail::fill_function<value_type>(value),
             hpx::parallel::util::projection_identity{}, std::true_type{});
@@ -113,12 +111,9 @@ namespace hpx { namespace segmented {
             return result::get(HPX_MOVE(first));
         }
 
-        using iterator_traits = hpx::traits::segmented_iterator_traits<SegIter>;
         using value_type = typename std::iterator_traits<SegIter>::value_type;
 
-        return segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
-                typename iterator_traits::local_iterator>(),
+        return segmented_for_each(hpx::parallel::v1::detail::seg_for_each(),
             HPX_FORWARD(ExPolicy, policy), first, last,
             hpx::parallel::v1::detail::fill_function<value_type>(value),
             hpx::parallel::util::projection_identity{}, is_seq());
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
@@ -33,6 +34,50 @@ namespace hpx { namespace parallel { inline namespace v1 {
         ///////////////////////////////////////////////////////////////////////
         /// \cond NOINTERNAL
 
+        // The local for_each always returns the end of the given range,
+        // which is known to the segmented algorithm already. Dropping the
+        // result allows for contiguous local data to be passed to the local
+        // algorithm as plain pointers (see dispatcher).
+        struct seg_for_each : public detail::algorithm<seg_for_each, void>
+        {
+            seg_for_each()
+              : seg_for_each::algorithm("for_each")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename F,
+                typename Proj>
+            static hpx::util::unused_type sequential(ExPolicy&& policy,
+                InIter first, InIter last, F&& f, Proj&& proj)
+            {
+                for_each<InIter>::sequential(HPX_FORWARD(ExPolicy, policy),
+                    first, last, HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last, F&& f,
+                Proj&& proj)
+            {
+                using result = util::detail::algorithm_result<ExPolicy>;
+                if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+                {
+                    return result::get(for_each<FwdIter>::parallel(
+                        HPX_FORWARD(ExPolicy, policy), first, last,
+                        HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj)));
+                }
+                else
+                {
+                    for_each<FwdIter>::parallel(HPX_FORWARD(ExPolicy, policy),
+                        first, last, HPX_FORWARD(F, f),
+                        HPX_FORWARD(Proj, proj));
+                    return result::get();
+                }
+            }
+        };
+
         // sequential remote implementation
         template <typename Algo, typename ExPolicy, typename SegIter,
             typename F, typename Proj>
@@ -55,9 +100,8 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 local_iterator_type end = traits::local(last);
                 if (beg != end)
                 {
-                    local_iterator_type out = dispatch(traits::get_id(sit),
-                        algo, policy, std::true_type(), beg, end, f, proj);
-                    last = traits::compose(send, out);
+                    dispatch(traits::get_id(sit), algo, policy,
+                        std::true_type(), beg, end, f, proj);
                 }
             }
             else
@@ -65,11 +109,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 // handle the remaining part of the first partition
                 local_iterator_type beg = traits::local(first);
                 local_iterator_type end = traits::end(sit);
-                local_iterator_type out = traits::local(last);
-
                 if (beg != end)
                 {
-                    out = dispatch(traits::get_id(sit), algo, policy,
+                    dispatch(traits::get_id(sit), algo, policy,
                         std::true_type(), beg, end, f, proj);
                 }
 
@@ -78,11 +120,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 {
                     beg = traits::begin(sit);
                     end = traits::end(sit);
-                    out = traits::begin(send);
-
                     if (beg != end)
                     {
-                        out = dispatch(traits::get_id(sit), algo, policy,
+                        dispatch(traits::get_id(sit), algo, policy,
                             std::true_type(), beg, end, f, proj);
                     }
                 }
@@ -92,11 +132,9 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 end = traits::local(last);
                 if (beg != end)
                 {
-                    out = dispatch(traits::get_id(sit), algo, policy,
+                    dispatch(traits::get_id(sit), algo, policy,
                         std::true_type(), beg, end, f, proj);
                 }
-
-                last = traits::compose(send, out);
             }
 
             return result::get(HPX_MOVE(last));
@@ -121,7 +159,7 @@ namespace hpx { namespace parallel { inline namespace v1 {
             segment_iterator sit = traits::segment(first);
             segment_iterator send = traits::segment(last);
 
-            std::vector<future<local_iterator_type>> segments;
+            std::vector<future<void>> segments;
             segments.reserve(std::distance(sit, send));
 
             if (sit == send)
@@ -169,13 +207,12 @@ namespace hpx { namespace parallel { inline namespace v1 {
             }
 
             return result::get(dataflow(
-                [=](std::vector<hpx::future<local_iterator_type>>&& r)
-                    -> SegIter {
+                [=](std::vector<hpx::future<void>>&& r) -> SegIter {
                     // handle any remote exceptions, will throw on error
                     std::list<std::exception_ptr> errors;
                     parallel::util::detail::handle_remote_exceptions<
                         ExPolicy>::call(r, errors);
-                    return traits::compose(send, r.back().get());
+                    return last;
                 },
                 HPX_MOVE(segments)));
         }
@@ -199,16 +236,13 @@ namespace hpx { namespace segmented {
         static_assert((hpx::traits::is_forward_iterator<InIter>::value),
             "Requires at least input iterator.");
 
-        using iterator_traits = hpx::traits::segmented_iterator_traits<InIter>;
-
         if (first == last)
         {
             return first;
         }
 
         return hpx::parallel::v1::detail::segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
-                typename iterator_traits::local_iterator>(),
+            hpx::parallel::v1::detail::seg_for_each(),
             hpx::execution::seq, first, last, HPX_FORWARD(F, f),
             hpx::parallel::util::projection_identity(), std::true_type());
     }
@@ -240,11 +274,8 @@ namespace hpx { namespace segmented {
             return result::get(HPX_MOVE(first));
         }
 
-        using iterator_traits = hpx::traits::segmented_iterator_traits<SegIter>;
-
         return segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
-                typename iterator_traits::local_iterator>(),
+            hpx::parallel::v1::detail::seg_for_each(),
             HPX_FORWARD(ExPolicy, policy), first, last, HPX_FORWARD(F, f),
             hpx::parallel::util::projection_identity(), is_seq());
     }
@@ -262,8 +293,6 @@ namespace hpx { namespace segmented {
         static_assert((hpx::traits::is_input_iterator<InIter>::value),
             "Requires at least input iterator.");
 
-        using iterator_traits = hpx::traits::segmented_iterator_traits<InIter>;
-
         if (hpx::parallel::v1::detail::is_negative(count) || count == 0)
         {
             return first;
@@ -272,8 +301,7 @@ namespace hpx { namespace segmented {
         auto last = first;
         hpx::parallel::v1::detail::advance(last, std::size_t(count));
         return hpx::parallel::v1::detail::segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
-                typename iterator_traits::local_iterator>(),
+            hpx::parallel::v1::detail::seg_for_each(),
             hpx::execution::seq, first, last, HPX_FORWARD(F, f),
             hpx::parallel::util::projection_identity(), std::true_type());
     }
@@ -305,13 +333,10 @@ namespace hpx { namespace segmented {
             return result::get(HPX_MOVE(first));
         }
 
-        using iterator_traits = hpx::traits::segmented_iterator_traits<SegIter>;
-
         auto last = first;
         hpx::parallel::v1::detail::advance(last, std::size_t(count));
         return segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
-                typename iterator_traits::local_iterator>(),
+            hpx::parallel::v1::detail::seg_for_each(),
             HPX_FORWARD(ExPolicy, policy), first, last, HPX_FORWARD(F, f),
             hpx::parallel::util::projection_identity(), is_seq());
     }
@@ -0,0 +1,186 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_partition
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Each site partitions its local data, afterwards all elements
+        // satisfying the predicate are moved to the front of the overall
+        // range, all other elements are moved behind those.
+        template <typename ExPolicy, typename Iter, typename Pred>
+        std::size_t segmented_partition_site(ExPolicy&& policy, Iter first,
+            Iter last, std::string const& basename, std::size_t num_sites,
+            std::size_t this_site, Pred&& pred)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            Iter middle = hpx::partition(
+                HPX_FORWARD(ExPolicy, policy), first, last, pred);
+
+            if (num_sites == 1)
+            {
+                return std::distance(first, middle);
+            }
+
+            std::vector<value_type> head(std::make_move_iterator(first),
+                std::make_move_iterator(middle));
+            std::vector<value_type> tail(std::make_move_iterator(middle),
+                std::make_move_iterator(last));
+
+            collectives::communicator comm =
+                collectives::create_communicator(basename.c_str(),
+                    collectives::num_sites_arg(num_sites),
+                    collectives::this_site_arg(this_site));
+
+            std::vector<std::vector<std::size_t>> counts =
+                gather_counts(comm, this_site,
+                    std::vector<std::size_t>{head.size(), tail.size()});
+
+            std::vector<std::size_t> sizes(num_sites);
+            for (std::size_t k = 0; k != num_sites; ++k)
+            {
+                sizes[k] = counts[0][k] + counts[1][k];
+            }
+
+            std::size_t const num_heads = std::accumulate(
+                counts[0].begin(), counts[0].end(), std::size_t(0));
+
+            exchange_elements(comm, this_site, HPX_MOVE(head),
+                exclusive_offsets(counts[0]), counts[0], sizes, first);
+            exchange_elements(comm, this_site, HPX_MOVE(tail),
+                exclusive_offsets(counts[1], num_heads), counts[1], sizes,
+                first);
+
+            return num_heads;
+        }
+
+        struct segmented_partition
+          : public detail::algorithm<segmented_partition, std::size_t>
+        {
+            segmented_partition()
+              : segmented_partition::algorithm("segmented_partition")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Pred>
+            static std::size_t sequential(ExPolicy&& policy, Iter first,
+                Iter last, std::string const& basename, std::size_t num_sites,
+                std::size_t this_site, Pred&& pred)
+            {
+                return segmented_partition_site(HPX_FORWARD(ExPolicy, policy),
+                    first, last, basename, num_sites, this_site,
+                    HPX_FORWARD(Pred, pred));
+            }
+
+            template <typename ExPolicy, typename Iter, typename Pred>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::size_t>::type
+            parallel(ExPolicy&& policy, Iter first, Iter last,
+                std::string const& basename, std::size_t num_sites,
+                std::size_t this_site, Pred&& pred)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::size_t>::get(segmented_partition_site(
+                    HPX_FORWARD(ExPolicy, policy), first, last, basename,
+                    num_sites, this_site, HPX_FORWARD(Pred, pred)));
+            }
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename IsSeq>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_partition_impl(
+            SegIter first, SegIter last, Pred&& pred, IsSeq is_seq)
+        {
+            return segmented_collective_result<ExPolicy>(
+                segmented_collective_dispatch(segmented_partition(),
+                    "partition", first, last, is_seq, HPX_FORWARD(Pred, pred)),
+                advance_segmented<SegIter>{first});
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx { namespace segmented {
+
+    // clang-format off
+    template <typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::partition_t, SegIter first, SegIter last, Pred&& pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator<SegIter>::value,
+            "Requires at least forward iterator.");
+
+        if (first == last)
+        {
+            return first;
+        }
+
+        return hpx::parallel::v1::detail::segmented_partition_impl<
+            hpx::execution::sequenced_policy>(
+            first, last, HPX_FORWARD(Pred, pred), std::true_type());
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        SegIter>::type
+    tag_invoke(hpx::partition_t, ExPolicy&& /* policy */, SegIter first,
+        SegIter last, Pred&& pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator<SegIter>::value,
+            "Requires at least forward iterator.");
+
+        using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+        if (first == last)
+        {
+            return hpx::parallel::util::detail::algorithm_result<ExPolicy,
+                SegIter>::get(HPX_MOVE(first));
+        }
+
+        return hpx::parallel::v1::detail::segmented_partition_impl<ExPolicy>(
+            first, last, HPX_FORWARD(Pred, pred), is_seq());
+    }
+}}    // namespace hpx::segmented
@@ -0,0 +1,238 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/remove.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_remove_if
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Move the elements kept by all sites to the front of the overall
+        // range, returns the overall number of elements kept.
+        template <typename T, typename Iter>
+        std::size_t compact_sites(collectives::communicator const& comm,
+            std::size_t this_site, std::vector<T>&& kept, std::size_t size,
+            Iter first)
+        {
+            std::vector<std::vector<std::size_t>> counts = gather_counts(
+                comm, this_site, std::vector<std::size_t>{kept.size(), size});
+
+            exchange_elements(comm, this_site, HPX_MOVE(kept),
+                exclusive_offsets(counts[0]), counts[0], counts[1], first);
+
+            return std::accumulate(
+                counts[0].begin(), counts[0].end(), std::size_t(0));
+        }
+
+        template <typename ExPolicy, typename Iter, typename Pred>
+        std::size_t segmented_remove_if_site(ExPolicy&& policy, Iter first,
+            Iter last, std::string const& basename, std::size_t num_sites,
+            std::size_t this_site, Pred&& pred)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            Iter new_last = hpx::remove_if(
+                HPX_FORWARD(ExPolicy, policy), first, last, pred);
+
+            std::size_t const size = std::distance(first, last);
+            if (num_sites == 1)
+            {
+                return std::distance(first, new_last);
+            }
+
+            std::vector<value_type> kept(std::make_move_iterator(first),
+                std::make_move_iterator(new_last));
+
+            return compact_sites(
+                collectives::create_communicator(basename.c_str(),
+                    collectives::num_sites_arg(num_sites),
+                    collectives::this_site_arg(this_site)),
+                this_site, HPX_MOVE(kept), size, first);
+        }
+
+        struct segmented_remove_if
+          : public detail::algorithm<segmented_remove_if, std::size_t>
+        {
+            segmented_remove_if()
+              : segmented_remove_if::algorithm("segmented_remove_if")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Pred>
+            static std::size_t sequential(ExPolicy&& policy, Iter first,
+                Iter last, std::string const& basename, std::size_t num_sites,
+                std::size_t this_site, Pred&& pred)
+            {
+                return segmented_remove_if_site(HPX_FORWARD(ExPolicy, policy),
+                    first, last, basename, num_sites, this_site,
+                    HPX_FORWARD(Pred, pred));
+            }
+
+            template <typename ExPolicy, typename Iter, typename Pred>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::size_t>::type
+            parallel(ExPolicy&& policy, Iter first, Iter last,
+                std::string const& basename, std::size_t num_sites,
+                std::size_t this_site, Pred&& pred)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::size_t>::get(segmented_remove_if_site(
+                    HPX_FORWARD(ExPolicy, policy), first, last, basename,
+                    num_sites, this_site, HPX_FORWARD(Pred, pred)));
+            }
+        };
+
+        template <typename T>
+        struct equal_to_value
+        {
+            equal_to_value(T val = T())
+              : value_(val)
+            {
+            }
+
+            T value_;
+
+            bool operator()(T const& val) const
+            {
+                return val == value_;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned /* version */)
+            {
+                // clang-format off
+                ar & value_;
+                // clang-format on
+            }
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename IsSeq>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_remove_if_impl(
+            SegIter first, SegIter last, Pred&& pred, IsSeq is_seq)
+        {
+            return segmented_collective_result<ExPolicy>(
+                segmented_collective_dispatch(segmented_remove_if(),
+                    "remove_if", first, last, is_seq, HPX_FORWARD(Pred, pred)),
+                advance_segmented<SegIter>{first});
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx { namespace segmented {
+
+    // clang-format off
+    template <typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::remove_if_t, SegIter first, SegIter last, Pred&& pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator<SegIter>::value,
+            "Requires at least forward iterator.");
+
+        if (first == last)
+        {
+            return first;
+        }
+
+        return hpx::parallel::v1::detail::segmented_remove_if_impl<
+            hpx::execution::sequenced_policy>(
+            first, last, HPX_FORWARD(Pred, pred), std::true_type());
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        SegIter>::type
+    tag_invoke(hpx::remove_if_t, ExPolicy&& /* policy */, SegIter first,
+        SegIter last, Pred&& pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator<SegIter>::value,
+            "Requires at least forward iterator.");
+
+        using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+        if (first == last)
+        {
+            return hpx::parallel::util::detail::algorithm_result<ExPolicy,
+                SegIter>::get(HPX_MOVE(first));
+        }
+
+        return hpx::parallel::v1::detail::segmented_remove_if_impl<ExPolicy>(
+            first, last, HPX_FORWARD(Pred, pred), is_seq());
+    }
+
+    // clang-format off
+    template <typename SegIter, typename T,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::remove_t, SegIter first, SegIter last, T const& value)
+    {
+        using value_type = typename std::iterator_traits<SegIter>::value_type;
+
+        return hpx::remove_if(first, last,
+            hpx::parallel::v1::detail::equal_to_value<value_type>(value));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename T,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        SegIter>::type
+    tag_invoke(hpx::remove_t, ExPolicy&& policy, SegIter first, SegIter last,
+        T const& value)
+    {
+        using value_type = typename std::iterator_traits<SegIter>::value_type;
+
+        return hpx::remove_if(HPX_FORWARD(ExPolicy, policy), first, last,
+            hpx::parallel::v1::detail::equal_to_value<value_type>(value));
+    }
+}}    // namespace hpx::segmented
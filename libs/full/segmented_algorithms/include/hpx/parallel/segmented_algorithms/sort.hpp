@@ -0,0 +1,255 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // merge the given sorted runs into one sorted sequence
+        template <typename T, typename Comp>
+        std::vector<T> merge_sorted_runs(
+            std::vector<std::vector<T>>&& runs, Comp&& comp)
+        {
+            std::size_t size = 0;
+            for (auto const& run : runs)
+            {
+                size += run.size();
+            }
+
+            std::vector<T> result;
+            result.reserve(size);
+
+            std::vector<std::size_t> bounds;
+            bounds.reserve(runs.size() + 1);
+            bounds.push_back(0);
+
+            for (auto& run : runs)
+            {
+                std::move(run.begin(), run.end(), std::back_inserter(result));
+                bounds.push_back(result.size());
+            }
+
+            // merge neighboring runs until only one run is left
+            while (bounds.size() > 2)
+            {
+                std::vector<std::size_t> next;
+                next.reserve(bounds.size() / 2 + 1);
+                next.push_back(0);
+
+                std::size_t i = 0;
+                for (/**/; i + 2 < bounds.size(); i += 2)
+                {
+                    std::inplace_merge(result.begin() + bounds[i],
+                        result.begin() + bounds[i + 1],
+                        result.begin() + bounds[i + 2], comp);
+                    next.push_back(bounds[i + 2]);
+                }
+                if (i + 1 < bounds.size())
+                {
+                    next.push_back(bounds.back());
+                }
+                bounds = HPX_MOVE(next);
+            }
+
+            return result;
+        }
+
+        // Sample sort, executed by each of the sites:
+        //
+        //  - sort the local data and pick regularly spaced samples
+        //  - select the splitters from the combined samples of all sites
+        //  - send the elements between splitter j - 1 and j to site j
+        //  - merge the sorted runs received from all sites
+        //  - move the elements to the sites owning their final position
+        //
+        template <typename ExPolicy, typename Iter, typename Comp>
+        void segmented_sort_site(ExPolicy&& policy, Iter first, Iter last,
+            std::string const& basename, std::size_t num_sites,
+            std::size_t this_site, Comp&& comp)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            hpx::sort(HPX_FORWARD(ExPolicy, policy), first, last, comp);
+            if (num_sites == 1)
+            {
+                return;
+            }
+
+            collectives::communicator comm =
+                collectives::create_communicator(basename.c_str(),
+                    collectives::num_sites_arg(num_sites),
+                    collectives::this_site_arg(this_site));
+
+            std::size_t const size = std::distance(first, last);
+
+            std::vector<value_type> samples;
+            samples.reserve(num_sites - 1);
+            for (std::size_t i = 1; i != num_sites; ++i)
+            {
+                samples.push_back(*std::next(first, i * size / num_sites));
+            }
+
+            std::vector<value_type> all_samples = merge_sorted_runs(
+                collectives::all_gather(comm, HPX_MOVE(samples),
+                    collectives::this_site_arg(this_site))
+                    .get(),
+                comp);
+
+            // all sites select the same splitters
+            std::vector<std::vector<value_type>> buckets(num_sites);
+
+            Iter it = first;
+            for (std::size_t j = 0; j != num_sites - 1; ++j)
+            {
+                value_type const& splitter =
+                    all_samples[(j + 1) * all_samples.size() / num_sites];
+
+                Iter next = std::upper_bound(it, last, splitter, comp);
+                buckets[j].assign(std::make_move_iterator(it),
+                    std::make_move_iterator(next));
+                it = next;
+            }
+            buckets[num_sites - 1].assign(
+                std::make_move_iterator(it), std::make_move_iterator(last));
+
+            std::vector<value_type> merged = merge_sorted_runs(
+                collectives::all_to_all(comm, HPX_MOVE(buckets),
+                    collectives::this_site_arg(this_site))
+                    .get(),
+                comp);
+
+            // site j now holds the j-th part of the overall sorted sequence,
+            // the parts are however not sized like the segments
+            std::vector<std::vector<std::size_t>> counts = gather_counts(
+                comm, this_site, std::vector<std::size_t>{merged.size(), size});
+
+            exchange_elements(comm, this_site, HPX_MOVE(merged),
+                exclusive_offsets(counts[0]), counts[0], counts[1], first);
+        }
+
+        struct segmented_sort
+          : public detail::algorithm<segmented_sort, void>
+        {
+            segmented_sort()
+              : segmented_sort::algorithm("segmented_sort")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp>
+            static hpx::util::unused_type sequential(ExPolicy&& policy,
+                Iter first, Iter last, std::string const& basename,
+                std::size_t num_sites, std::size_t this_site, Comp&& comp)
+            {
+                segmented_sort_site(HPX_FORWARD(ExPolicy, policy), first, last,
+                    basename, num_sites, this_site, HPX_FORWARD(Comp, comp));
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy, Iter first, Iter last,
+                std::string const& basename, std::size_t num_sites,
+                std::size_t this_site, Comp&& comp)
+            {
+                segmented_sort_site(HPX_FORWARD(ExPolicy, policy), first, last,
+                    basename, num_sites, this_site, HPX_FORWARD(Comp, comp));
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx { namespace segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    void tag_invoke(
+        hpx::sort_t, SegIter first, SegIter last, Comp&& comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator<SegIter>::value,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return;
+        }
+
+        using hpx::parallel::v1::detail::segmented_collective_result;
+        segmented_collective_result<hpx::execution::sequenced_policy>(
+            hpx::parallel::v1::detail::segmented_collective_dispatch(
+                hpx::parallel::v1::detail::segmented_sort(), "sort", first,
+                last, std::true_type(), HPX_FORWARD(Comp, comp)),
+            [](auto&&) {});
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy>::type
+    tag_invoke(hpx::sort_t, ExPolicy&& /* policy */, SegIter first,
+        SegIter last, Comp&& comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator<SegIter>::value,
+            "Requires a random access iterator.");
+
+        using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+        if (first == last)
+        {
+            return hpx::parallel::util::detail::algorithm_result<
+                ExPolicy>::get();
+        }
+
+        using hpx::parallel::v1::detail::segmented_collective_result;
+        return segmented_collective_result<ExPolicy>(
+            hpx::parallel::v1::detail::segmented_collective_dispatch(
+                hpx::parallel::v1::detail::segmented_sort(), "sort", first,
+                last, is_seq(), HPX_FORWARD(Comp, comp)),
+            [](auto&&) {});
+    }
+}}    // namespace hpx::segmented
@@ -0,0 +1,180 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/unique.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/exchange.hpp>
+#include <hpx/parallel/segmented_algorithms/remove.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_unique
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        template <typename ExPolicy, typename Iter, typename Pred>
+        std::size_t segmented_unique_site(ExPolicy&& policy, Iter first,
+            Iter last, std::string const& basename, std::size_t num_sites,
+            std::size_t this_site, Pred&& pred)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            Iter new_last =
+                hpx::unique(HPX_FORWARD(ExPolicy, policy), first, last, pred);
+
+            std::size_t const size = std::distance(first, last);
+            if (num_sites == 1)
+            {
+                return std::distance(first, new_last);
+            }
+
+            std::vector<value_type> kept(std::make_move_iterator(first),
+                std::make_move_iterator(new_last));
+
+            collectives::communicator comm =
+                collectives::create_communicator(basename.c_str(),
+                    collectives::num_sites_arg(num_sites),
+                    collectives::this_site_arg(this_site));
+
+            // the first element is a duplicate if it is equal to the last
+            // element kept by the preceding site
+            std::vector<value_type> last_kept =
+                collectives::all_gather(comm, kept.back(),
+                    collectives::this_site_arg(this_site))
+                    .get();
+
+            if (this_site != 0 &&
+                HPX_INVOKE(pred, last_kept[this_site - 1], kept.front()))
+            {
+                kept.erase(kept.begin());
+            }
+
+            return compact_sites(comm, this_site, HPX_MOVE(kept), size, first);
+        }
+
+        struct segmented_unique
+          : public detail::algorithm<segmented_unique, std::size_t>
+        {
+            segmented_unique()
+              : segmented_unique::algorithm("segmented_unique")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Pred>
+            static std::size_t sequential(ExPolicy&& policy, Iter first,
+                Iter last, std::string const& basename, std::size_t num_sites,
+                std::size_t this_site, Pred&& pred)
+            {
+                return segmented_unique_site(HPX_FORWARD(ExPolicy, policy),
+                    first, last, basename, num_sites, this_site,
+                    HPX_FORWARD(Pred, pred));
+            }
+
+            template <typename ExPolicy, typename Iter, typename Pred>
+            static typename util::detail::algorithm_result<ExPolicy,
+                std::size_t>::type
+            parallel(ExPolicy&& policy, Iter first, Iter last,
+                std::string const& basename, std::size_t num_sites,
+                std::size_t this_site, Pred&& pred)
+            {
+                return util::detail::algorithm_result<ExPolicy,
+                    std::size_t>::get(segmented_unique_site(
+                    HPX_FORWARD(ExPolicy, policy), first, last, basename,
+                    num_sites, this_site, HPX_FORWARD(Pred, pred)));
+            }
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Pred,
+            typename IsSeq>
+        typename util::detail::algorithm_result<ExPolicy, SegIter>::type
+        segmented_unique_impl(
+            SegIter first, SegIter last, Pred&& pred, IsSeq is_seq)
+        {
+            return segmented_collective_result<ExPolicy>(
+                segmented_collective_dispatch(segmented_unique(), "unique",
+                    first, last, is_seq, HPX_FORWARD(Pred, pred)),
+                advance_segmented<SegIter>{first});
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx { namespace segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Pred = hpx::parallel::v1::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::unique_t, SegIter first, SegIter last, Pred&& pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator<SegIter>::value,
+            "Requires at least forward iterator.");
+
+        if (first == last)
+        {
+            return first;
+        }
+
+        return hpx::parallel::v1::detail::segmented_unique_impl<
+            hpx::execution::sequenced_policy>(
+            first, last, HPX_FORWARD(Pred, pred), std::true_type());
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Pred = hpx::parallel::v1::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy<ExPolicy>::value &&
+            hpx::traits::is_iterator<SegIter>::value &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename hpx::parallel::util::detail::algorithm_result<ExPolicy,
+        SegIter>::type
+    tag_invoke(hpx::unique_t, ExPolicy&& /* policy */, SegIter first,
+        SegIter last, Pred&& pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator<SegIter>::value,
+            "Requires at least forward iterator.");
+
+        using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+        if (first == last)
+        {
+            return hpx::parallel::util::detail::algorithm_result<ExPolicy,
+                SegIter>::get(HPX_MOVE(first));
+        }
+
+        return hpx::parallel::v1::detail::segmented_unique_impl<ExPolicy>(
+            first, last, HPX_FORWARD(Pred, pred), is_seq());
+    }
+}}    // namespace hpx::segmented
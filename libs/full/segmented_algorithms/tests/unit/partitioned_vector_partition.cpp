@@ -0,0 +1,125 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_partition.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+#define SIZE 1007
+
+template <typename T>
+std::vector<T> initialize(hpx::partitioned_vector<T>& xvalues, int max_value)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<T> values(xvalues.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = T(dist(gen));
+        xvalues.set_value(hpx::launch::sync, i, values[i]);
+    }
+    return values;
+}
+
+template <typename T>
+struct is_odd
+{
+    bool operator()(T const& val) const
+    {
+        return val % 2 != 0;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+template <typename ExPolicy, typename T>
+void test_partition(ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues)
+{
+    std::vector<T> values = initialize(xvalues, 100);
+
+    auto result =
+        hpx::partition(policy, xvalues.begin(), xvalues.end(), is_odd<T>());
+
+    std::size_t const count =
+        std::count_if(values.begin(), values.end(), is_odd<T>());
+    HPX_TEST_EQ(
+        std::size_t(std::distance(xvalues.begin(), result)), count);
+
+    // the partition is not stable, compare the sorted groups
+    std::vector<T> result_values(values.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        result_values[i] = xvalues.get_value(hpx::launch::sync, i);
+        HPX_TEST_EQ(is_odd<T>()(result_values[i]), i < count);
+    }
+
+    std::sort(values.begin(), values.end());
+    std::sort(result_values.begin(), result_values.end());
+    HPX_TEST(values == result_values);
+}
+
+template <typename ExPolicy, typename T>
+void test_partition_async(
+    ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues)
+{
+    std::vector<T> values = initialize(xvalues, 100);
+
+    auto result =
+        hpx::partition(policy, xvalues.begin(), xvalues.end(), is_odd<T>())
+            .get();
+
+    std::size_t const count =
+        std::count_if(values.begin(), values.end(), is_odd<T>());
+    HPX_TEST_EQ(
+        std::size_t(std::distance(xvalues.begin(), result)), count);
+
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(
+            is_odd<T>()(xvalues.get_value(hpx::launch::sync, i)), i < count);
+    }
+}
+
+template <typename T>
+void partition_tests(std::vector<hpx::id_type>& localities)
+{
+    // use more than one partition per locality
+    hpx::partitioned_vector<T> xvalues(
+        SIZE, T(0), hpx::container_layout(3 * localities.size(), localities));
+
+    test_partition(hpx::execution::seq, xvalues);
+    test_partition(hpx::execution::par, xvalues);
+    test_partition_async(hpx::execution::seq(hpx::execution::task), xvalues);
+    test_partition_async(hpx::execution::par(hpx::execution::task), xvalues);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    partition_tests<int>(localities);
+    return hpx::util::report_errors();
+}
+#endif
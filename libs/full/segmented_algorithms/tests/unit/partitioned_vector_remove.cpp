@@ -0,0 +1,139 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_remove.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+#define SIZE 1007
+
+template <typename T>
+std::vector<T> initialize(hpx::partitioned_vector<T>& xvalues, int max_value)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<T> values(xvalues.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = T(dist(gen));
+        xvalues.set_value(hpx::launch::sync, i, values[i]);
+    }
+    return values;
+}
+
+template <typename T>
+void verify(hpx::partitioned_vector<T>& xvalues, std::vector<T> const& values,
+    std::size_t count)
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(xvalues.get_value(hpx::launch::sync, i), values[i]);
+    }
+}
+
+template <typename T>
+struct is_odd
+{
+    bool operator()(T const& val) const
+    {
+        return val % 2 != 0;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+template <typename ExPolicy, typename T>
+void test_remove_if(ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues)
+{
+    std::vector<T> values = initialize(xvalues, 100);
+
+    auto result =
+        hpx::remove_if(policy, xvalues.begin(), xvalues.end(), is_odd<T>());
+
+    auto expected = std::remove_if(values.begin(), values.end(), is_odd<T>());
+    std::size_t const count = std::distance(values.begin(), expected);
+
+    HPX_TEST_EQ(
+        std::size_t(std::distance(xvalues.begin(), result)), count);
+    verify(xvalues, values, count);
+}
+
+template <typename ExPolicy, typename T>
+void test_remove_if_async(
+    ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues)
+{
+    std::vector<T> values = initialize(xvalues, 100);
+
+    auto result =
+        hpx::remove_if(policy, xvalues.begin(), xvalues.end(), is_odd<T>())
+            .get();
+
+    auto expected = std::remove_if(values.begin(), values.end(), is_odd<T>());
+    std::size_t const count = std::distance(values.begin(), expected);
+
+    HPX_TEST_EQ(
+        std::size_t(std::distance(xvalues.begin(), result)), count);
+    verify(xvalues, values, count);
+}
+
+template <typename ExPolicy, typename T>
+void test_remove(ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues)
+{
+    std::vector<T> values = initialize(xvalues, 3);
+
+    auto result = hpx::remove(policy, xvalues.begin(), xvalues.end(), T(2));
+
+    auto expected = std::remove(values.begin(), values.end(), T(2));
+    std::size_t const count = std::distance(values.begin(), expected);
+
+    HPX_TEST_EQ(
+        std::size_t(std::distance(xvalues.begin(), result)), count);
+    verify(xvalues, values, count);
+}
+
+template <typename T>
+void remove_tests(std::vector<hpx::id_type>& localities)
+{
+    // use more than one partition per locality
+    hpx::partitioned_vector<T> xvalues(
+        SIZE, T(0), hpx::container_layout(3 * localities.size(), localities));
+
+    test_remove_if(hpx::execution::seq, xvalues);
+    test_remove_if(hpx::execution::par, xvalues);
+    test_remove_if_async(hpx::execution::seq(hpx::execution::task), xvalues);
+    test_remove_if_async(hpx::execution::par(hpx::execution::task), xvalues);
+
+    test_remove(hpx::execution::seq, xvalues);
+    test_remove(hpx::execution::par, xvalues);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    remove_tests<int>(localities);
+    return hpx::util::report_errors();
+}
+#endif
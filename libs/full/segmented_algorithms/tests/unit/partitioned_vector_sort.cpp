@@ -0,0 +1,122 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+#define SIZE 1007
+
+template <typename T>
+std::vector<T> initialize(hpx::partitioned_vector<T>& xvalues)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 100);
+
+    std::vector<T> values(xvalues.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = T(dist(gen));
+        xvalues.set_value(hpx::launch::sync, i, values[i]);
+    }
+    return values;
+}
+
+template <typename T>
+void verify(hpx::partitioned_vector<T>& xvalues, std::vector<T> const& values)
+{
+    HPX_TEST_EQ(xvalues.size(), values.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(xvalues.get_value(hpx::launch::sync, i), values[i]);
+    }
+}
+
+template <typename ExPolicy, typename T, typename Comp>
+void test_sort(ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues,
+    Comp comp)
+{
+    std::vector<T> values = initialize(xvalues);
+
+    hpx::sort(policy, xvalues.begin(), xvalues.end(), comp);
+
+    std::sort(values.begin(), values.end(), comp);
+    verify(xvalues, values);
+}
+
+template <typename ExPolicy, typename T, typename Comp>
+void test_sort_async(ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues,
+    Comp comp)
+{
+    std::vector<T> values = initialize(xvalues);
+
+    hpx::sort(policy, xvalues.begin(), xvalues.end(), comp).get();
+
+    std::sort(values.begin(), values.end(), comp);
+    verify(xvalues, values);
+}
+
+template <typename T>
+void test_sort_subrange(hpx::partitioned_vector<T>& xvalues)
+{
+    std::vector<T> values = initialize(xvalues);
+
+    hpx::sort(hpx::execution::par, xvalues.begin() + 10, xvalues.end() - 10,
+        std::less<T>());
+
+    std::sort(values.begin() + 10, values.end() - 10, std::less<T>());
+    verify(xvalues, values);
+}
+
+template <typename T>
+void sort_tests(std::vector<hpx::id_type>& localities)
+{
+    // use more than one partition per locality
+    hpx::partitioned_vector<T> xvalues(
+        SIZE, T(0), hpx::container_layout(3 * localities.size(), localities));
+
+    {
+        std::vector<T> values = initialize(xvalues);
+        hpx::sort(xvalues.begin(), xvalues.end(), std::less<T>());
+
+        std::sort(values.begin(), values.end());
+        verify(xvalues, values);
+    }
+
+    test_sort(hpx::execution::seq, xvalues, std::less<T>());
+    test_sort(hpx::execution::par, xvalues, std::less<T>());
+    test_sort(hpx::execution::par, xvalues, std::greater<T>());
+    test_sort_async(
+        hpx::execution::seq(hpx::execution::task), xvalues, std::less<T>());
+    test_sort_async(
+        hpx::execution::par(hpx::execution::task), xvalues, std::greater<T>());
+
+    test_sort_subrange(xvalues);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    sort_tests<int>(localities);
+    return hpx::util::report_errors();
+}
+#endif
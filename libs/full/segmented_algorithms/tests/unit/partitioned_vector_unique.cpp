@@ -0,0 +1,122 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/parallel_unique.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+#define SIZE 1007
+
+template <typename T>
+std::vector<T> initialize(hpx::partitioned_vector<T>& xvalues, int max_value)
+{
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, max_value);
+
+    std::vector<T> values(xvalues.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        values[i] = T(dist(gen));
+        xvalues.set_value(hpx::launch::sync, i, values[i]);
+    }
+    return values;
+}
+
+template <typename T>
+void verify(hpx::partitioned_vector<T>& xvalues, std::vector<T> const& values,
+    std::size_t count)
+{
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(xvalues.get_value(hpx::launch::sync, i), values[i]);
+    }
+}
+
+
+template <typename ExPolicy, typename T>
+void test_unique(ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues)
+{
+    // few distinct values create long runs of duplicates, some of them
+    // crossing partition boundaries
+    std::vector<T> values = initialize(xvalues, 2);
+
+    auto result = hpx::unique(policy, xvalues.begin(), xvalues.end());
+
+    auto expected = std::unique(values.begin(), values.end());
+    std::size_t const count = std::distance(values.begin(), expected);
+
+    HPX_TEST_EQ(
+        std::size_t(std::distance(xvalues.begin(), result)), count);
+    verify(xvalues, values, count);
+}
+
+template <typename ExPolicy, typename T>
+void test_unique_async(ExPolicy&& policy, hpx::partitioned_vector<T>& xvalues)
+{
+    std::vector<T> values = initialize(xvalues, 2);
+
+    auto result = hpx::unique(policy, xvalues.begin(), xvalues.end()).get();
+
+    auto expected = std::unique(values.begin(), values.end());
+    std::size_t const count = std::distance(values.begin(), expected);
+
+    HPX_TEST_EQ(
+        std::size_t(std::distance(xvalues.begin(), result)), count);
+    verify(xvalues, values, count);
+}
+
+template <typename T>
+void test_unique_constant(hpx::partitioned_vector<T>& xvalues)
+{
+    // all elements are equal, only the very first one is kept
+    hpx::fill(hpx::execution::par, xvalues.begin(), xvalues.end(), T(42));
+
+    auto result =
+        hpx::unique(hpx::execution::par, xvalues.begin(), xvalues.end());
+
+    HPX_TEST_EQ(std::distance(xvalues.begin(), result), 1);
+    HPX_TEST_EQ(xvalues.get_value(hpx::launch::sync, 0), T(42));
+}
+
+template <typename T>
+void unique_tests(std::vector<hpx::id_type>& localities)
+{
+    // use more than one partition per locality
+    hpx::partitioned_vector<T> xvalues(
+        SIZE, T(0), hpx::container_layout(3 * localities.size(), localities));
+
+    test_unique(hpx::execution::seq, xvalues);
+    test_unique(hpx::execution::par, xvalues);
+    test_unique_async(hpx::execution::seq(hpx::execution::task), xvalues);
+    test_unique_async(hpx::execution::par(hpx::execution::task), xvalues);
+
+    test_unique_constant(xvalues);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    unique_tests<int>(localities);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,278 @@
+//  Copyright (c) 2022 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+
+namespace hpx { namespace util {
+
+    namespace tag {
+        // selects the statistics counters which are based on a
+        // log_linear_histogram
+        struct percentile
+        {
+        };
+    }    // namespace tag
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A histogram of non-negative integral values (e.g. latencies) using
+    /// log-linear buckets, similar to HdrHistogram: each power-of-two range is
+    /// split into 2^precision_bits equally sized buckets, which bounds the
+    /// relative error of any reported value by 2^-precision_bits. Values are
+    /// recorded into one of several shards (selected per OS-thread) without
+    /// any locking, the shards are merged whenever the histogram is queried.
+    class log_linear_histogram
+    {
+    public:
+        static constexpr std::size_t default_precision_bits = 5;
+
+        explicit log_linear_histogram(std::size_t num_shards = 0,
+            std::size_t precision_bits = default_precision_bits)
+          : precision_bits_(precision_bits)
+          , sub_buckets_(std::size_t(1) << precision_bits)
+          , num_buckets_((65 - precision_bits) * sub_buckets_)
+          , num_shards_(num_shards != 0 ? num_shards : default_num_shards())
+          , shards_(new shard_type[num_shards_])
+        {
+            HPX_ASSERT(precision_bits > 0 && precision_bits < 16);
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shards_[i].data_.init(num_buckets_);
+            }
+        }
+
+        log_linear_histogram(log_linear_histogram const&) = delete;
+        log_linear_histogram& operator=(log_linear_histogram const&) = delete;
+
+        /// Record the given value, negative values are recorded as zero.
+        void add(std::int64_t value) noexcept
+        {
+            std::uint64_t const v =
+                value < 0 ? 0 : static_cast<std::uint64_t>(value);
+
+            shard& s = shards_[get_shard_index()].data_;
+            s.buckets[bucket_index(v)].fetch_add(1, std::memory_order_relaxed);
+            s.count.fetch_add(1, std::memory_order_relaxed);
+            s.sum.fetch_add(v, std::memory_order_relaxed);
+
+            std::uint64_t current = s.max.load(std::memory_order_relaxed);
+            while (v > current &&
+                !s.max.compare_exchange_weak(
+                    current, v, std::memory_order_relaxed))
+            {
+            }
+
+            current = s.min.load(std::memory_order_relaxed);
+            while (v < current &&
+                !s.min.compare_exchange_weak(
+                    current, v, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        /// Return the number of recorded values
+        std::uint64_t count() const noexcept
+        {
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                result +=
+                    shards_[i].data_.count.load(std::memory_order_relaxed);
+            }
+            return result;
+        }
+
+        /// Return the smallest recorded value (zero if no values were
+        /// recorded)
+        std::uint64_t min() const noexcept
+        {
+            std::uint64_t result = (std::numeric_limits<std::uint64_t>::max)();
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                result = (std::min)(result,
+                    shards_[i].data_.min.load(std::memory_order_relaxed));
+            }
+            return count() != 0 ? result : 0;
+        }
+
+        /// Return the largest recorded value
+        std::uint64_t max() const noexcept
+        {
+            std::uint64_t result = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                result = (std::max)(result,
+                    shards_[i].data_.max.load(std::memory_order_relaxed));
+            }
+            return result;
+        }
+
+        /// Return the mean of all recorded values
+        double mean() const noexcept
+        {
+            std::uint64_t sum = 0;
+            std::uint64_t count = 0;
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                sum += shards_[i].data_.sum.load(std::memory_order_relaxed);
+                count +=
+                    shards_[i].data_.count.load(std::memory_order_relaxed);
+            }
+            return count != 0 ?
+                static_cast<double>(sum) / static_cast<double>(count) :
+                0.0;
+        }
+
+        /// Return the (upper bound of the) value below which the given
+        /// percentage (0..100) of all recorded values fall, e.g.
+        /// percentile(99.9) for the p999 latency.
+        std::uint64_t percentile(double p) const
+        {
+            p = (std::min)((std::max)(p, 0.0), 100.0);
+
+            // merge the shards
+            std::unique_ptr<std::uint64_t[]> merged(
+                new std::uint64_t[num_buckets_]);
+            std::uint64_t total = 0;
+            for (std::size_t b = 0; b != num_buckets_; ++b)
+            {
+                std::uint64_t c = 0;
+                for (std::size_t i = 0; i != num_shards_; ++i)
+                {
+                    c += shards_[i].data_.buckets[b].load(
+                        std::memory_order_relaxed);
+                }
+                merged[b] = c;
+                total += c;
+            }
+
+            if (total == 0)
+                return 0;
+
+            std::uint64_t rank = static_cast<std::uint64_t>(
+                p / 100.0 * static_cast<double>(total) + 0.5);
+            rank = (std::max)(rank, std::uint64_t(1));
+
+            std::uint64_t seen = 0;
+            for (std::size_t b = 0; b != num_buckets_; ++b)
+            {
+                seen += merged[b];
+                if (seen >= rank)
+                {
+                    return (std::min)(bucket_upper_bound(b), max());
+                }
+            }
+            return max();
+        }
+
+        /// Discard all recorded values. Values recorded concurrently may or
+        /// may not be discarded.
+        void reset() noexcept
+        {
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shards_[i].data_.reset(num_buckets_);
+            }
+        }
+
+        std::size_t num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+
+    private:
+        static std::size_t default_num_shards() noexcept
+        {
+            std::size_t const cores = std::thread::hardware_concurrency();
+            return (std::min)((std::max)(cores, std::size_t(1)),
+                std::size_t(16));
+        }
+
+        // OS-threads are assigned to the shards in round-robin fashion
+        std::size_t get_shard_index() const noexcept
+        {
+            static std::atomic<std::size_t> next_index(0);
+            thread_local std::size_t const index =
+                next_index.fetch_add(1, std::memory_order_relaxed);
+            return index % num_shards_;
+        }
+
+        static std::size_t most_significant_bit(std::uint64_t v) noexcept
+        {
+            std::size_t msb = 0;
+            while (v >>= 1)
+                ++msb;
+            return msb;
+        }
+
+        std::size_t bucket_index(std::uint64_t v) const noexcept
+        {
+            if (v < sub_buckets_)
+                return static_cast<std::size_t>(v);
+
+            // v is in [2^msb, 2^(msb+1)), keep precision_bits+1 leading bits
+            std::size_t const shift = most_significant_bit(v) - precision_bits_;
+            return shift * sub_buckets_ + static_cast<std::size_t>(v >> shift);
+        }
+
+        std::uint64_t bucket_upper_bound(std::size_t index) const noexcept
+        {
+            if (index < sub_buckets_)
+                return index;
+
+            std::size_t const shift = index / sub_buckets_ - 1;
+            std::uint64_t const top = index - shift * sub_buckets_;
+            return ((top + 1) << shift) - 1;
+        }
+
+        struct shard
+        {
+            void init(std::size_t num_buckets)
+            {
+                buckets.reset(new std::atomic<std::uint64_t>[num_buckets]);
+                reset(num_buckets);
+            }
+
+            void reset(std::size_t num_buckets) noexcept
+            {
+                for (std::size_t b = 0; b != num_buckets; ++b)
+                {
+                    buckets[b].store(0, std::memory_order_relaxed);
+                }
+                count.store(0, std::memory_order_relaxed);
+                sum.store(0, std::memory_order_relaxed);
+                min.store((std::numeric_limits<std::uint64_t>::max)(),
+                    std::memory_order_relaxed);
+                max.store(0, std::memory_order_relaxed);
+            }
+
+            std::unique_ptr<std::atomic<std::uint64_t>[]> buckets;
+            std::atomic<std::uint64_t> count{0};
+            std::atomic<std::uint64_t> sum{0};
+            std::atomic<std::uint64_t> min{0};
+            std::atomic<std::uint64_t> max{0};
+        };
+
+        using shard_type = util::cache_aligned_data<shard>;
+
+        std::size_t precision_bits_;
+        std::size_t sub_buckets_;
+        std::size_t num_buckets_;
+        std::size_t num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+    };
+}}    // namespace hpx::util